@@ -0,0 +1,128 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Keyple Core Service */
+#include "ApduResponseAdapter.h"
+#include "CardResponseAdapter.h"
+#include "CardSelectionManagerAdapter.h"
+#include "CardSelectionResponseAdapter.h"
+#include "ScheduledCardSelectionsResponseAdapter.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Stub */
+#include "CardSelectionStub.h"
+
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+static const std::vector<uint8_t> FCI = ByteArrayUtil::fromHex("6F0884061122334455669000");
+static const std::vector<uint8_t> AID = ByteArrayUtil::fromHex("A000000291");
+
+/**
+ * Parsing of range(0) matching selection responses (processCardSelectionResponses, reached
+ * through parseScheduledCardSelectionsResponse).
+ */
+static void BM_CardSelectionManagerAdapter_processCardSelectionResponses(benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+
+    CardSelectionManagerAdapter cardSelectionManager;
+    cardSelectionManager.setMultipleSelectionMode();
+
+    std::vector<std::shared_ptr<CardSelectionResponseApi>> cardSelectionResponses;
+    for (int i = 0; i < selectionCount; i++) {
+        cardSelectionManager.prepareSelection(
+            std::make_shared<CardSelectionSpiStub>(
+                std::make_shared<CardSelectionRequestSpiStub>(
+                    std::make_shared<CardSelectorSpiStub>(AID), nullptr)));
+
+        cardSelectionResponses.push_back(
+            std::make_shared<CardSelectionResponseAdapter>(
+                "",
+                std::make_shared<ApduResponseAdapter>(FCI),
+                true,
+                std::make_shared<CardResponseAdapter>(
+                    std::vector<std::shared_ptr<ApduResponseApi>>(), true)));
+    }
+
+    auto scheduledCardSelectionsResponse =
+        std::make_shared<ScheduledCardSelectionsResponseAdapter>(cardSelectionResponses);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            cardSelectionManager.parseScheduledCardSelectionsResponse(
+                scheduledCardSelectionsResponse));
+    }
+
+    state.SetItemsProcessed(state.iterations() * selectionCount);
+}
+BENCHMARK(BM_CardSelectionManagerAdapter_processCardSelectionResponses)
+    ->Arg(1)->Arg(4)->Arg(16);
+
+/**
+ * Parsing of 16 matching selection responses by card extensions spending range(1) microseconds
+ * each, on range(0) threads (1 meaning sequential parsing, the default).
+ *
+ * <p>Justifies the parallel parsing mode: with a negligible parsing cost, the hand-off to the
+ * worker pool costs more than it saves and the sequential parsing is kept as the default; with a
+ * costly parsing, the time decreases with the number of threads.
+ */
+static void BM_CardSelectionManagerAdapter_parallelParsing(benchmark::State& state)
+{
+    const int threadCount = static_cast<int>(state.range(0));
+    const int parsingCostMicros = static_cast<int>(state.range(1));
+    const int selectionCount = 16;
+
+    CardSelectionManagerAdapter cardSelectionManager;
+    cardSelectionManager.setMultipleSelectionMode();
+    cardSelectionManager.setParallelParsing(threadCount);
+
+    std::vector<std::shared_ptr<CardSelectionResponseApi>> cardSelectionResponses;
+    for (int i = 0; i < selectionCount; i++) {
+        cardSelectionManager.prepareSelection(
+            std::make_shared<CardSelectionSpiStub>(
+                std::make_shared<CardSelectionRequestSpiStub>(
+                    std::make_shared<CardSelectorSpiStub>(AID), nullptr),
+                parsingCostMicros));
+
+        cardSelectionResponses.push_back(
+            std::make_shared<CardSelectionResponseAdapter>(
+                "",
+                std::make_shared<ApduResponseAdapter>(FCI),
+                true,
+                std::make_shared<CardResponseAdapter>(
+                    std::vector<std::shared_ptr<ApduResponseApi>>(), true)));
+    }
+
+    auto scheduledCardSelectionsResponse =
+        std::make_shared<ScheduledCardSelectionsResponseAdapter>(cardSelectionResponses);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            cardSelectionManager.parseScheduledCardSelectionsResponse(
+                scheduledCardSelectionsResponse));
+    }
+
+    state.SetItemsProcessed(state.iterations() * selectionCount);
+    state.counters["parsing_threads"] = threadCount;
+}
+BENCHMARK(BM_CardSelectionManagerAdapter_parallelParsing)
+    ->Args({1, 0})->Args({2, 0})->Args({4, 0})
+    ->Args({1, 200})->Args({2, 200})->Args({4, 200})
+    ->UseRealTime();
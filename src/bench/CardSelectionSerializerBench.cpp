@@ -0,0 +1,199 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Keyple Core Service */
+#include "ApduResponseAdapter.h"
+#include "CardResponseAdapter.h"
+#include "CardSelectionResponseAdapter.h"
+#include "CardSelectionScenarioAdapter.h"
+#include "CardSelectionSerializer.h"
+#include "ScheduledCardSelectionsResponseAdapter.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Stub */
+#include "CardSelectionStub.h"
+
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+static const std::vector<uint8_t> FCI = ByteArrayUtil::fromHex("6F0884061122334455669000");
+static const std::vector<uint8_t> AID = ByteArrayUtil::fromHex("A000000291");
+static const std::vector<uint8_t> APDU = ByteArrayUtil::fromHex("00B2014400");
+static const std::vector<uint8_t> RECORD =
+    ByteArrayUtil::fromHex("00112233445566778899AABBCCDDEEFF00112233445566778899AABB9000");
+
+/* Number of APDU exchanged after each selection */
+static const int APDU_COUNT = 4;
+
+/**
+ * Scenario of range(0) selections, each one followed by APDU_COUNT APDU requests.
+ */
+static CardSelectionScenarioAdapter buildCardSelectionScenario(const int selectionCount)
+{
+    std::vector<std::shared_ptr<CardSelectionRequestSpi>> cardSelectionRequests;
+    for (int i = 0; i < selectionCount; i++) {
+        cardSelectionRequests.push_back(
+            std::make_shared<CardSelectionRequestSpiStub>(
+                std::make_shared<CardSelectorSpiStub>(AID),
+                std::make_shared<CardRequestSpiStub>(APDU, APDU_COUNT)));
+    }
+
+    return CardSelectionScenarioAdapter(cardSelectionRequests,
+                                        MultiSelectionProcessing::PROCESS_ALL,
+                                        ChannelControl::KEEP_OPEN);
+}
+
+/**
+ * Responses of range(0) matching selections, each one carrying APDU_COUNT APDU responses.
+ */
+static ScheduledCardSelectionsResponseAdapter buildScheduledCardSelectionsResponse(
+    const int selectionCount)
+{
+    std::vector<std::shared_ptr<ApduResponseApi>> apduResponses;
+    for (int i = 0; i < APDU_COUNT; i++) {
+        apduResponses.push_back(std::make_shared<ApduResponseAdapter>(RECORD));
+    }
+
+    std::vector<std::shared_ptr<CardSelectionResponseApi>> cardSelectionResponses;
+    for (int i = 0; i < selectionCount; i++) {
+        cardSelectionResponses.push_back(
+            std::make_shared<CardSelectionResponseAdapter>(
+                "",
+                std::make_shared<ApduResponseAdapter>(FCI),
+                true,
+                std::make_shared<CardResponseAdapter>(apduResponses, true)));
+    }
+
+    return ScheduledCardSelectionsResponseAdapter(cardSelectionResponses);
+}
+
+static void BM_CardSelectionSerializer_serializeCardSelectionScenario(benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+    const CardSelectionScenarioAdapter cardSelectionScenario =
+        buildCardSelectionScenario(selectionCount);
+
+    size_t length = 0;
+    for (auto _ : state) {
+        const std::vector<uint8_t> buffer =
+            CardSelectionSerializer::serialize(cardSelectionScenario);
+        length = buffer.size();
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * selectionCount);
+    state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(BM_CardSelectionSerializer_serializeCardSelectionScenario)
+    ->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_CardSelectionSerializer_deserializeCardSelectionScenario(benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+    const std::vector<uint8_t> buffer =
+        CardSelectionSerializer::serialize(buildCardSelectionScenario(selectionCount));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(CardSelectionSerializer::deserializeCardSelectionScenario(buffer));
+    }
+
+    state.SetItemsProcessed(state.iterations() * selectionCount);
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+BENCHMARK(BM_CardSelectionSerializer_deserializeCardSelectionScenario)
+    ->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_CardSelectionSerializer_serializeScheduledCardSelectionsResponse(
+    benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+    const ScheduledCardSelectionsResponseAdapter scheduledCardSelectionsResponse =
+        buildScheduledCardSelectionsResponse(selectionCount);
+
+    size_t length = 0;
+    for (auto _ : state) {
+        const std::vector<uint8_t> buffer =
+            CardSelectionSerializer::serialize(scheduledCardSelectionsResponse);
+        length = buffer.size();
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * selectionCount);
+    state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(BM_CardSelectionSerializer_serializeScheduledCardSelectionsResponse)
+    ->Arg(1)->Arg(4)->Arg(16);
+
+static void BM_CardSelectionSerializer_deserializeScheduledCardSelectionsResponse(
+    benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+    const std::vector<uint8_t> buffer =
+        CardSelectionSerializer::serialize(buildScheduledCardSelectionsResponse(selectionCount));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            CardSelectionSerializer::deserializeScheduledCardSelectionsResponse(buffer));
+    }
+
+    state.SetItemsProcessed(state.iterations() * selectionCount);
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+BENCHMARK(BM_CardSelectionSerializer_deserializeScheduledCardSelectionsResponse)
+    ->Arg(1)->Arg(4)->Arg(16);
+
+/**
+ * In-place reading of the match status of the last selection, without decoding the responses.
+ */
+static void BM_CardSelectionSerializer_hasMatched(benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+    const std::vector<uint8_t> buffer =
+        CardSelectionSerializer::serialize(buildScheduledCardSelectionsResponse(selectionCount));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(CardSelectionSerializer::hasMatched(buffer, selectionCount - 1));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CardSelectionSerializer_hasMatched)->Arg(1)->Arg(4)->Arg(16);
+
+/**
+ * In-place reading of the status words of the APDU responses of the last selection, to be compared
+ * with the full deserialization.
+ */
+static void BM_CardSelectionSerializer_getApduResponse(benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+    const std::vector<uint8_t> buffer =
+        CardSelectionSerializer::serialize(buildScheduledCardSelectionsResponse(selectionCount));
+    const size_t index = static_cast<size_t>(selectionCount - 1);
+
+    for (auto _ : state) {
+        const size_t count = CardSelectionSerializer::getApduResponseCount(buffer, index);
+        for (size_t i = 0; i < count; i++) {
+            benchmark::DoNotOptimize(CardSelectionSerializer::getStatusWord(
+                CardSelectionSerializer::getApduResponse(buffer, index, i)));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * APDU_COUNT);
+}
+BENCHMARK(BM_CardSelectionSerializer_getApduResponse)->Arg(1)->Arg(4)->Arg(16);
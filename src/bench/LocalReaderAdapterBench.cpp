@@ -0,0 +1,131 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Card */
+#include "ChannelControl.h"
+
+/* Keyple Core Service */
+#include "LocalReaderAdapter.h"
+#include "MultiSelectionProcessing.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Stub */
+#include "CardRequestStub.h"
+#include "CardSelectionStub.h"
+#include "ReaderSpiStub.h"
+
+using namespace calypsonet::terminal::card;
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+static const std::string PLUGIN_NAME = "benchPlugin";
+static const std::string READER_NAME = "benchReader";
+
+/* Response with data, so that the case 4 GET RESPONSE hack is never triggered */
+static const std::vector<uint8_t> RESPONSE = ByteArrayUtil::fromHex("6F0884061122334455669000");
+static const std::vector<uint8_t> APDU = ByteArrayUtil::fromHex("00B2014400");
+static const std::vector<uint8_t> AID = ByteArrayUtil::fromHex("A000000291");
+
+/**
+ * Card request of range(0) APDUs on a reader answering immediately.
+ */
+static void BM_LocalReaderAdapter_processCardRequest(benchmark::State& state)
+{
+    const int apduCount = static_cast<int>(state.range(0));
+
+    auto readerSpi = std::make_shared<ReaderSpiStub>(READER_NAME, RESPONSE);
+    LocalReaderAdapter reader(readerSpi, PLUGIN_NAME);
+    reader.doRegister();
+
+    auto cardRequest = std::make_shared<CardRequestSpiStub>(APDU, apduCount);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader.processCardRequest(cardRequest, ChannelControl::KEEP_OPEN));
+    }
+
+    state.SetItemsProcessed(state.iterations() * apduCount);
+}
+BENCHMARK(BM_LocalReaderAdapter_processCardRequest)->Arg(1)->Arg(4)->Arg(16);
+
+/**
+ * FIRST_MATCH scenario of range(0) selections, only the last one matching: all the selections are
+ * processed, the last one sending a card request of 2 APDUs.
+ */
+static void BM_LocalReaderAdapter_processCardSelectionRequests_firstMatch(benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+
+    auto readerSpi = std::make_shared<ReaderSpiStub>(READER_NAME, RESPONSE);
+    LocalReaderAdapter reader(readerSpi, PLUGIN_NAME);
+    reader.doRegister();
+
+    std::vector<std::shared_ptr<CardSelectionRequestSpi>> cardSelectionRequests;
+    for (int i = 0; i < selectionCount - 1; i++) {
+        /* The reader answers 9000, expecting 6283 makes the selection fail */
+        cardSelectionRequests.push_back(
+            std::make_shared<CardSelectionRequestSpiStub>(
+                std::make_shared<CardSelectorSpiStub>(AID, std::vector<int>({0x6283})),
+                nullptr));
+    }
+    cardSelectionRequests.push_back(
+        std::make_shared<CardSelectionRequestSpiStub>(
+            std::make_shared<CardSelectorSpiStub>(AID),
+            std::make_shared<CardRequestSpiStub>(APDU, 2)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            reader.processCardSelectionRequests(cardSelectionRequests,
+                                                MultiSelectionProcessing::FIRST_MATCH,
+                                                ChannelControl::KEEP_OPEN));
+    }
+
+    state.SetItemsProcessed(state.iterations() * selectionCount);
+}
+BENCHMARK(BM_LocalReaderAdapter_processCardSelectionRequests_firstMatch)->Arg(1)->Arg(4)->Arg(16);
+
+/**
+ * PROCESS_ALL scenario of range(0) matching selections, each one sending a card request of 2
+ * APDUs.
+ */
+static void BM_LocalReaderAdapter_processCardSelectionRequests_processAll(benchmark::State& state)
+{
+    const int selectionCount = static_cast<int>(state.range(0));
+
+    auto readerSpi = std::make_shared<ReaderSpiStub>(READER_NAME, RESPONSE);
+    LocalReaderAdapter reader(readerSpi, PLUGIN_NAME);
+    reader.doRegister();
+
+    std::vector<std::shared_ptr<CardSelectionRequestSpi>> cardSelectionRequests;
+    for (int i = 0; i < selectionCount; i++) {
+        cardSelectionRequests.push_back(
+            std::make_shared<CardSelectionRequestSpiStub>(
+                std::make_shared<CardSelectorSpiStub>(AID),
+                std::make_shared<CardRequestSpiStub>(APDU, 2)));
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            reader.processCardSelectionRequests(cardSelectionRequests,
+                                                MultiSelectionProcessing::PROCESS_ALL,
+                                                ChannelControl::KEEP_OPEN));
+    }
+
+    state.SetItemsProcessed(state.iterations() * selectionCount);
+}
+BENCHMARK(BM_LocalReaderAdapter_processCardSelectionRequests_processAll)->Arg(1)->Arg(4)->Arg(16);
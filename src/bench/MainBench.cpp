@@ -0,0 +1,51 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <cstring>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/**
+ * Runs the benchmarks, reporting in JSON on the standard output unless another format is given
+ * with --benchmark_format. Use --benchmark_out=<file> to keep the results in a file as well.
+ */
+int main(int argc, char **argv)
+{
+    std::vector<char*> args(argv, argv + argc);
+
+    bool hasFormat = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--benchmark_format", 18) == 0) {
+            hasFormat = true;
+        }
+    }
+
+    char jsonFormat[] = "--benchmark_format=json";
+    if (!hasFormat) {
+        args.push_back(jsonFormat);
+    }
+
+    int count = static_cast<int>(args.size());
+
+    /* Initialize Google Benchmark */
+    benchmark::Initialize(&count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(count, args.data())) {
+        return 1;
+    }
+
+    /* Run */
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
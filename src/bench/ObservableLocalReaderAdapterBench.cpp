@@ -0,0 +1,100 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Reader */
+#include "ObservableCardReader.h"
+
+/* Keyple Core Service */
+#include "ObservableLocalReaderAdapter.h"
+#include "ReaderEventAdapter.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Stub */
+#include "CardReaderObservationExceptionHandlerSpiStub.h"
+#include "ObservableReaderAutonomousSpiStub.h"
+#include "ReaderObserverSpiStub.h"
+
+using namespace calypsonet::terminal::reader;
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+static const std::string PLUGIN_NAME = "benchPlugin";
+static const std::string READER_NAME = "benchReader";
+
+static const std::vector<uint8_t> RESPONSE = ByteArrayUtil::fromHex("9000");
+
+/**
+ * Synchronous notification of one reader event to range(0) observers.
+ */
+static void BM_ObservableLocalReaderAdapter_notifyObservers(benchmark::State& state)
+{
+    const int observerCount = static_cast<int>(state.range(0));
+
+    auto readerSpi = std::make_shared<ObservableReaderAutonomousSpiStub>(READER_NAME, RESPONSE);
+    ObservableLocalReaderAdapter reader(readerSpi, PLUGIN_NAME);
+    reader.doRegister();
+    reader.setReaderObservationExceptionHandler(
+        std::make_shared<CardReaderObservationExceptionHandlerSpiStub>());
+
+    for (int i = 0; i < observerCount; i++) {
+        reader.addObserver(std::make_shared<ReaderObserverSpiStub>());
+    }
+
+    auto event = std::make_shared<ReaderEventAdapter>(PLUGIN_NAME,
+                                                      READER_NAME,
+                                                      CardReaderEvent::Type::CARD_INSERTED,
+                                                      nullptr);
+
+    for (auto _ : state) {
+        reader.notifyObservers(event);
+    }
+
+    state.SetItemsProcessed(state.iterations() * observerCount);
+
+    reader.doUnregister();
+}
+BENCHMARK(BM_ObservableLocalReaderAdapter_notifyObservers)->Arg(1)->Arg(8)->Arg(64);
+
+/**
+ * Full card cycle of the state machine in REPEATING mode, driven synchronously by an autonomous
+ * reader: insertion (notified to one observer), processing, removal. Each iteration makes 3
+ * state transitions.
+ */
+static void BM_ObservableLocalReaderAdapter_stateTransitions(benchmark::State& state)
+{
+    auto readerSpi = std::make_shared<ObservableReaderAutonomousSpiStub>(READER_NAME, RESPONSE);
+    ObservableLocalReaderAdapter reader(readerSpi, PLUGIN_NAME);
+    reader.doRegister();
+    reader.setReaderObservationExceptionHandler(
+        std::make_shared<CardReaderObservationExceptionHandlerSpiStub>());
+    reader.addObserver(std::make_shared<ReaderObserverSpiStub>());
+    reader.startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    for (auto _ : state) {
+        readerSpi->insertCard();
+        reader.finalizeCardProcessing();
+        readerSpi->removeCard();
+    }
+
+    state.SetItemsProcessed(state.iterations() * 3);
+
+    reader.stopCardDetection();
+    reader.doUnregister();
+}
+BENCHMARK(BM_ObservableLocalReaderAdapter_stateTransitions);
@@ -0,0 +1,223 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReaderEvent.h"
+#include "CardReaderObserverSpi.h"
+#include "ObservableCardReader.h"
+
+/* Keyple Core Service */
+#include "MonitoringState.h"
+#include "ObservableLocalReaderAdapter.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Stub */
+#include "CardReaderObservationExceptionHandlerSpiStub.h"
+#include "ObservableReaderPresenceProbeSpiStub.h"
+
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::spi;
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+using Clock = std::chrono::steady_clock;
+using PresenceProbeStrategy = ObservableLocalReaderAdapter::PresenceProbeStrategy;
+
+static const std::string PLUGIN_NAME = "benchPlugin";
+static const std::string READER_NAME = "benchReader";
+
+static const std::vector<uint8_t> RESPONSE = ByteArrayUtil::fromHex("9000");
+
+/* Constant cycle duration of the removal monitoring */
+static const int CYCLE_DURATION = 10;
+
+/* Beyond this delay a removal is considered lost and the benchmark is aborted */
+static const std::chrono::seconds REMOVAL_TIMEOUT(5);
+
+/* Strategies indexed by range(0) */
+static const PresenceProbeStrategy STRATEGIES[] = {PresenceProbeStrategy::DRIVER_PROBE,
+                                                   PresenceProbeStrategy::CHECK_CARD_PRESENCE,
+                                                   PresenceProbeStrategy::APDU_PING};
+static const char* const STRATEGY_NAMES[] = {"driver_probe", "check_card_presence", "apdu_ping"};
+
+/**
+ * Observer timestamping the CARD_REMOVED events.
+ */
+class RemovalObserver final : public CardReaderObserverSpi {
+public:
+    RemovalObserver() : mRemoved(false) {}
+
+    void onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent) override
+    {
+        const Clock::time_point now = Clock::now();
+
+        if (readerEvent->getType() != CardReaderEvent::Type::CARD_REMOVED) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mRemovedTime = now;
+        mRemoved = true;
+        mCondition.notify_all();
+    }
+
+    bool waitForRemoved(Clock::time_point& removedTime)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        if (!mCondition.wait_for(lock, REMOVAL_TIMEOUT, [this]() { return mRemoved; })) {
+            return false;
+        }
+
+        mRemoved = false;
+        removedTime = mRemovedTime;
+
+        return true;
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mRemoved;
+    Clock::time_point mRemovedTime;
+};
+
+/**
+ * Waits for the reader to reach a monitoring state.
+ */
+static bool waitForState(const ObservableLocalReaderAdapter& reader, const MonitoringState state)
+{
+    const Clock::time_point deadline = Clock::now() + REMOVAL_TIMEOUT;
+
+    while (reader.getCurrentMonitoringState() != state) {
+        if (Clock::now() > deadline) {
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+/**
+ * Cost of one presence probe (one cycle of the removal monitoring, wait excluded) with the
+ * strategy range(0), the card being present if range(1) is 1, absent otherwise.
+ */
+static void BM_PresenceProbe_probe(benchmark::State& state)
+{
+    auto readerSpi = std::make_shared<ObservableReaderPresenceProbeSpiStub>(READER_NAME, RESPONSE);
+    readerSpi->setCardPresent(state.range(1) != 0);
+
+    ObservableLocalReaderAdapter reader(readerSpi, PLUGIN_NAME);
+    reader.doRegister();
+    reader.setReaderObservationExceptionHandler(
+        std::make_shared<CardReaderObservationExceptionHandlerSpiStub>());
+    reader.setPresenceProbeStrategy(STRATEGIES[state.range(0)]);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader.probeCardPresence());
+    }
+
+    state.SetLabel(STRATEGY_NAMES[state.range(0)]);
+
+    reader.doUnregister();
+}
+BENCHMARK(BM_PresenceProbe_probe)->ArgsProduct({{0, 1, 2}, {0, 1}});
+
+/**
+ * Delay between the removal of the card and the delivery of the CARD_REMOVED event, with the
+ * strategy range(0) and a constant cycle duration. Each iteration time is the removal latency
+ * (manual time).
+ */
+static void BM_PresenceProbe_removalLatency(benchmark::State& state)
+{
+    auto readerSpi = std::make_shared<ObservableReaderPresenceProbeSpiStub>(READER_NAME, RESPONSE);
+
+    auto reader = std::make_shared<ObservableLocalReaderAdapter>(readerSpi, PLUGIN_NAME);
+    reader->doRegister();
+    reader->setReaderObservationExceptionHandler(
+        std::make_shared<CardReaderObservationExceptionHandlerSpiStub>());
+    reader->setPresenceProbeStrategy(STRATEGIES[state.range(0)]);
+    reader->getPollingPolicy()->setCycleDurationBounds(CYCLE_DURATION, CYCLE_DURATION);
+
+    auto observer = std::make_shared<RemovalObserver>();
+    reader->addObserver(observer);
+    reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    std::vector<double> latencies;
+
+    for (auto _ : state) {
+        readerSpi->setCardPresent(true);
+
+        if (!waitForState(*reader, MonitoringState::WAIT_FOR_CARD_PROCESSING)) {
+            state.SkipWithError("CARD_INSERTED not received");
+            break;
+        }
+
+        reader->finalizeCardProcessing();
+
+        if (!waitForState(*reader, MonitoringState::WAIT_FOR_CARD_REMOVAL)) {
+            state.SkipWithError("WAIT_FOR_CARD_REMOVAL not reached");
+            break;
+        }
+
+        /*
+         * Let the removal monitoring run a few cycles, the removal being spread over the cycle
+         * from an iteration to the next
+         */
+        const size_t phase = (latencies.size() * 7) % CYCLE_DURATION;
+        std::this_thread::sleep_for(std::chrono::milliseconds(3 * CYCLE_DURATION + phase));
+
+        const Clock::time_point removalTime = Clock::now();
+        readerSpi->setCardPresent(false);
+
+        Clock::time_point removedTime;
+        if (!observer->waitForRemoved(removedTime) ||
+            !waitForState(*reader, MonitoringState::WAIT_FOR_CARD_INSERTION)) {
+            state.SkipWithError("CARD_REMOVED not received");
+            break;
+        }
+
+        const double latency = std::chrono::duration<double>(removedTime - removalTime).count();
+        state.SetIterationTime(latency);
+        latencies.push_back(latency * 1e6);
+    }
+
+    reader->stopCardDetection();
+    reader->doUnregister();
+
+    state.SetLabel(STRATEGY_NAMES[state.range(0)]);
+
+    if (latencies.empty()) {
+        return;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    state.counters["p50_us"] = latencies[latencies.size() / 2];
+    state.counters["max_us"] = latencies.back();
+}
+BENCHMARK(BM_PresenceProbe_removalLatency)
+    ->DenseRange(0, 2)->Iterations(20)->UseManualTime()->Unit(benchmark::kMicrosecond);
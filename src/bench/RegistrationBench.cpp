@@ -0,0 +1,73 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Keyple Core Service */
+#include "LocalPluginAdapter.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Stub */
+#include "ParallelPluginSpiStub.h"
+
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+using Clock = std::chrono::steady_clock;
+
+static const std::string PLUGIN_NAME = "registrationPlugin";
+
+static const std::vector<uint8_t> RESPONSE = ByteArrayUtil::fromHex("9000");
+
+static const int READER_COUNT = 1000;
+
+/**
+ * Measures the registration of a plugin exposing 1000 observable readers (one executor thread
+ * each), depending on the number of registration threads (1 meaning sequential registration).
+ *
+ * <p>Only LocalPluginAdapter::doRegister() is timed, the unregistration is excluded.
+ */
+static void BM_Registration_localPlugin(benchmark::State& state)
+{
+    const int threadCount = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        auto pluginSpi =
+            std::make_shared<ParallelPluginSpiStub>(PLUGIN_NAME, READER_COUNT, threadCount, RESPONSE);
+        auto plugin = std::make_shared<LocalPluginAdapter>(pluginSpi);
+
+        const Clock::time_point start = Clock::now();
+        plugin->doRegister();
+        const Clock::duration elapsed = Clock::now() - start;
+
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+
+        if (plugin->getReaderNames().size() != static_cast<size_t>(READER_COUNT)) {
+            state.SkipWithError("Missing readers");
+        }
+
+        plugin->doUnregister();
+    }
+
+    state.counters["readers"] = READER_COUNT;
+    state.counters["registration_threads"] = threadCount;
+}
+BENCHMARK(BM_Registration_localPlugin)
+    ->Arg(1)->Arg(2)->Arg(4)->Arg(8)
+    ->Iterations(1)->UseManualTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,376 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <unistd.h>
+#endif
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReaderEvent.h"
+#include "CardReaderObserverSpi.h"
+#include "ObservableCardReader.h"
+
+/* Keyple Core Service */
+#include "ObservableLocalPluginAdapter.h"
+#include "ObservableLocalReaderAdapter.h"
+#include "PluginEvent.h"
+#include "PluginObservationExceptionHandlerSpi.h"
+#include "PluginObserverSpi.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Stub */
+#include "CardReaderObservationExceptionHandlerSpiStub.h"
+#include "ObservablePluginSpiStub.h"
+
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::spi;
+using namespace keyple::core::service;
+using namespace keyple::core::service::spi;
+using namespace keyple::core::util;
+
+using Clock = std::chrono::steady_clock;
+
+static const std::string PLUGIN_NAME = "scalabilityPlugin";
+static const std::string PLUGGED_READER_NAME = "reader-plugged";
+
+static const std::vector<uint8_t> RESPONSE = ByteArrayUtil::fromHex("6F0884061122334455669000");
+
+static const int MONITORING_CYCLE_DURATION = 50;
+
+/* Beyond this delay an event is considered lost and the benchmark is aborted */
+static const std::chrono::seconds EVENT_TIMEOUT(60);
+
+/**
+ * Observer shared by all the readers, timestamping the first CARD_INSERTED and CARD_REMOVED
+ * events of each reader.
+ */
+class WaveObserver final : public CardReaderObserverSpi {
+public:
+    void onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent) override
+    {
+        const Clock::time_point now = Clock::now();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (readerEvent->getType() == CardReaderEvent::Type::CARD_INSERTED) {
+            mInsertedTimes.insert({readerEvent->getReaderName(), now});
+        } else if (readerEvent->getType() == CardReaderEvent::Type::CARD_REMOVED) {
+            mRemovedTimes.insert({readerEvent->getReaderName(), now});
+        }
+
+        mCondition.notify_all();
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mInsertedTimes.clear();
+        mRemovedTimes.clear();
+    }
+
+    bool waitForInserted(const size_t readerCount, std::map<std::string, Clock::time_point>& times)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        if (!mCondition.wait_for(lock, EVENT_TIMEOUT, [this, readerCount]() {
+                return mInsertedTimes.size() >= readerCount;
+            })) {
+            return false;
+        }
+
+        times = mInsertedTimes;
+
+        return true;
+    }
+
+    bool waitForRemoved(const size_t readerCount)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        return mCondition.wait_for(lock, EVENT_TIMEOUT, [this, readerCount]() {
+            return mRemovedTimes.size() >= readerCount;
+        });
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::map<std::string, Clock::time_point> mInsertedTimes;
+    std::map<std::string, Clock::time_point> mRemovedTimes;
+};
+
+/**
+ * Plugin observer signaling the connection of a given reader.
+ */
+class ConnectionObserver final : public PluginObserverSpi {
+public:
+    explicit ConnectionObserver(const std::string& readerName)
+    : mReaderName(readerName), mConnected(false) {}
+
+    void onPluginEvent(const std::shared_ptr<PluginEvent> pluginEvent) override
+    {
+        const std::vector<std::string> readerNames = pluginEvent->getReaderNames();
+
+        if (pluginEvent->getType() == PluginEvent::Type::READER_CONNECTED &&
+            std::find(readerNames.begin(), readerNames.end(), mReaderName) != readerNames.end()) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mConnectedTime = Clock::now();
+            mConnected = true;
+            mCondition.notify_all();
+        }
+    }
+
+    bool waitForConnected(Clock::time_point& connectedTime)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        if (!mCondition.wait_for(lock, EVENT_TIMEOUT, [this]() { return mConnected; })) {
+            return false;
+        }
+
+        connectedTime = mConnectedTime;
+
+        return true;
+    }
+
+private:
+    const std::string mReaderName;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mConnected;
+    Clock::time_point mConnectedTime;
+};
+
+/**
+ * Plugin observation exception handler ignoring the errors.
+ */
+class PluginObservationExceptionHandlerSpiStub final
+: public PluginObservationExceptionHandlerSpi {
+public:
+    void onPluginObservationError(const std::string& pluginName,
+                                  const std::shared_ptr<Exception> e) override
+    {
+        (void)pluginName;
+        (void)e;
+    }
+};
+
+/**
+ * Gets the number of threads of the process, -1 if unknown.
+ */
+static double getThreadCount()
+{
+#if defined(__linux__)
+    DIR* dir = opendir("/proc/self/task");
+    if (dir == nullptr) {
+        return -1;
+    }
+
+    int count = 0;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_name[0] != '.') {
+            count++;
+        }
+    }
+    closedir(dir);
+
+    return count;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * Gets the resident set size of the process in MB, -1 if unknown.
+ */
+static double getResidentSetSizeMb()
+{
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    long size = 0;
+    long resident = 0;
+    if (!(statm >> size >> resident)) {
+        return -1;
+    }
+
+    return static_cast<double>(resident) * sysconf(_SC_PAGESIZE) / (1024.0 * 1024.0);
+#else
+    return -1;
+#endif
+}
+
+static double toMillis(const Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+/**
+ * Registers an observable plugin exposing range(0) blocking readers, all of them monitored in
+ * REPEATING mode, then measures:
+ * <ul>
+ *   <li>the cost of the registration and of the teardown,
+ *   <li>the threads, the resident memory and the CPU consumed while idle,
+ *   <li>the CARD_INSERTED latencies when a card is tapped on all the readers at once,
+ *   <li>the delay for the plugin monitoring thread to notify a newly connected reader.
+ * </ul>
+ *
+ * <p>The iteration time (manual time) is the duration of the tap wave, i.e. the delay until the
+ * last reader notified its CARD_INSERTED event.
+ */
+static void BM_Scalability_observablePlugin(benchmark::State& state)
+{
+    const int readerCount = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        const double threadsBefore = getThreadCount();
+
+        /* Registration */
+        Clock::time_point start = Clock::now();
+
+        auto pluginSpi = std::make_shared<ObservablePluginSpiStub>(PLUGIN_NAME,
+                                                                   readerCount,
+                                                                   MONITORING_CYCLE_DURATION,
+                                                                   RESPONSE);
+        auto plugin = std::make_shared<ObservableLocalPluginAdapter>(pluginSpi);
+        plugin->doRegister();
+
+        const double registerMillis = toMillis(Clock::now() - start);
+
+        plugin->setPluginObservationExceptionHandler(
+            std::make_shared<PluginObservationExceptionHandlerSpiStub>());
+        auto connectionObserver = std::make_shared<ConnectionObserver>(PLUGGED_READER_NAME);
+        plugin->addObserver(connectionObserver);
+
+        /* Detection start */
+        auto exceptionHandler = std::make_shared<CardReaderObservationExceptionHandlerSpiStub>();
+        auto waveObserver = std::make_shared<WaveObserver>();
+        std::vector<std::shared_ptr<ObservableLocalReaderAdapter>> readers;
+
+        start = Clock::now();
+
+        for (const auto& reader : plugin->getReaders()) {
+            auto observableReader = std::dynamic_pointer_cast<ObservableLocalReaderAdapter>(reader);
+            observableReader->setReaderObservationExceptionHandler(exceptionHandler);
+            observableReader->addObserver(waveObserver);
+            observableReader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+            readers.push_back(observableReader);
+        }
+
+        const double startDetectionMillis = toMillis(Clock::now() - start);
+
+        /* Idle footprint */
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        const Clock::time_point idleStart = Clock::now();
+        const std::clock_t idleCpuStart = std::clock();
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const double idleCpuSeconds = static_cast<double>(std::clock() - idleCpuStart) /
+                                      CLOCKS_PER_SEC;
+        const double idleSeconds = std::chrono::duration<double>(Clock::now() - idleStart).count();
+
+        const double threads = getThreadCount() - threadsBefore;
+        const double rssMb = getResidentSetSizeMb();
+
+        /* Tap wave: a card is tapped on all the readers at once */
+        start = Clock::now();
+
+        for (const auto& reader : readers) {
+            pluginSpi->getReaderSpi(reader->getName())->setCardPresent(true);
+        }
+
+        std::map<std::string, Clock::time_point> insertedTimes;
+        if (!waveObserver->waitForInserted(readers.size(), insertedTimes)) {
+            state.SkipWithError("CARD_INSERTED not received from all the readers");
+            break;
+        }
+
+        std::vector<double> latencies;
+        for (const auto& entry : insertedTimes) {
+            latencies.push_back(toMillis(entry.second - start));
+        }
+        std::sort(latencies.begin(), latencies.end());
+
+        state.SetIterationTime(latencies.back() / 1000.0);
+
+        for (const auto& reader : readers) {
+            reader->finalizeCardProcessing();
+            pluginSpi->getReaderSpi(reader->getName())->setCardPresent(false);
+        }
+
+        if (!waveObserver->waitForRemoved(readers.size())) {
+            state.SkipWithError("CARD_REMOVED not received from all the readers");
+            break;
+        }
+
+        /* Plugin change detection */
+        start = Clock::now();
+        pluginSpi->plugReader(PLUGGED_READER_NAME);
+
+        Clock::time_point connectedTime;
+        if (!connectionObserver->waitForConnected(connectedTime)) {
+            state.SkipWithError("READER_CONNECTED not received");
+            break;
+        }
+
+        const double readerConnectedMillis = toMillis(connectedTime - start);
+
+        /* Teardown */
+        start = Clock::now();
+
+        for (const auto& reader : readers) {
+            reader->stopCardDetection();
+        }
+        readers.clear();
+        plugin->doUnregister();
+        plugin.reset();
+
+        const double teardownMillis = toMillis(Clock::now() - start);
+
+        const auto percentile = [&latencies](const double p) {
+            return latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+        };
+
+        state.counters["readers"] = readerCount;
+        state.counters["threads"] = threads;
+        state.counters["rss_mb"] = rssMb;
+        state.counters["idle_cpu_pct"] = 100.0 * idleCpuSeconds / idleSeconds;
+        state.counters["register_ms"] = registerMillis;
+        state.counters["start_detection_ms"] = startDetectionMillis;
+        state.counters["inserted_p50_ms"] = percentile(0.50);
+        state.counters["inserted_p99_ms"] = percentile(0.99);
+        state.counters["inserted_max_ms"] = latencies.back();
+        state.counters["reader_connected_ms"] = readerConnectedMillis;
+        state.counters["teardown_ms"] = teardownMillis;
+    }
+}
+BENCHMARK(BM_Scalability_observablePlugin)
+    ->Arg(1)->Arg(10)->Arg(100)->Arg(500)->Arg(1000)->Arg(2000)
+    ->Iterations(1)->UseManualTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,272 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReaderEvent.h"
+#include "CardReaderObserverSpi.h"
+#include "ObservableCardReader.h"
+
+/* Keyple Core Service */
+#include "CardSelectionManagerAdapter.h"
+#include "MonitoringState.h"
+#include "ObservableLocalReaderAdapter.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Stub */
+#include "CardReaderObservationExceptionHandlerSpiStub.h"
+#include "CardSelectionStub.h"
+#include "ObservableReaderAutonomousSpiStub.h"
+#include "ObservableReaderBlockingSpiStub.h"
+#include "ObservableReaderNonBlockingSpiStub.h"
+
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::spi;
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+using Clock = std::chrono::steady_clock;
+
+static const std::string PLUGIN_NAME = "benchPlugin";
+static const std::string READER_NAME = "benchReader";
+
+static const std::vector<uint8_t> RESPONSE = ByteArrayUtil::fromHex("6F0884061122334455669000");
+static const std::vector<uint8_t> AID = ByteArrayUtil::fromHex("A000000291");
+
+/* Beyond this delay a tap is considered lost and the benchmark is aborted */
+static const std::chrono::seconds TAP_TIMEOUT(5);
+
+/**
+ * Observer timestamping the CARD_MATCHED events and signaling the CARD_REMOVED events.
+ */
+class TapLatencyObserver final : public CardReaderObserverSpi {
+public:
+    TapLatencyObserver() : mMatched(false), mRemoved(false) {}
+
+    void onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent) override
+    {
+        const Clock::time_point now = Clock::now();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (readerEvent->getType() == CardReaderEvent::Type::CARD_MATCHED) {
+            mMatchedTime = now;
+            mMatched = true;
+        } else if (readerEvent->getType() == CardReaderEvent::Type::CARD_REMOVED) {
+            mRemoved = true;
+        }
+
+        mCondition.notify_all();
+    }
+
+    bool waitForMatched(Clock::time_point& matchedTime)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        if (!mCondition.wait_for(lock, TAP_TIMEOUT, [this]() { return mMatched; })) {
+            return false;
+        }
+
+        mMatched = false;
+        matchedTime = mMatchedTime;
+
+        return true;
+    }
+
+    bool waitForRemoved()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        if (!mCondition.wait_for(lock, TAP_TIMEOUT, [this]() { return mRemoved; })) {
+            return false;
+        }
+
+        mRemoved = false;
+
+        return true;
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mMatched;
+    bool mRemoved;
+    Clock::time_point mMatchedTime;
+};
+
+/**
+ * Waits for the reader to reach a monitoring state.
+ */
+static bool waitForState(const ObservableLocalReaderAdapter& reader, const MonitoringState state)
+{
+    const Clock::time_point deadline = Clock::now() + TAP_TIMEOUT;
+
+    while (reader.getCurrentMonitoringState() != state) {
+        if (Clock::now() > deadline) {
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+/**
+ * Simulates a card insertion or removal, signaled by the SPI itself for an autonomous reader.
+ */
+static void setCardPresent(ObservableReaderAutonomousSpiStub& readerSpi, const bool cardPresent)
+{
+    if (cardPresent) {
+        readerSpi.insertCard();
+    } else {
+        readerSpi.removeCard();
+    }
+}
+
+/**
+ * Simulates a card insertion or removal, detected by the monitoring jobs of the service.
+ */
+static void setCardPresent(ReaderSpiStub& readerSpi, const bool cardPresent)
+{
+    readerSpi.setCardPresent(cardPresent);
+}
+
+/**
+ * Measures the delay between a card insertion signal and the delivery of the CARD_MATCHED event
+ * to the observer, a default selection scenario being scheduled in REPEATING mode.
+ *
+ * <p>range(0) is the pause (ms) between the end of a card cycle and the next tap, 0 meaning
+ * back-to-back taps (saturation). Each iteration time is the tap latency (manual time), the
+ * counters give its distribution and the sustained tap rate (full cycles per second).
+ */
+template <typename S>
+static void runTapLatency(benchmark::State& state, std::shared_ptr<S> readerSpi)
+{
+    const std::chrono::milliseconds pause(state.range(0));
+
+    auto reader = std::make_shared<ObservableLocalReaderAdapter>(readerSpi, PLUGIN_NAME);
+    reader->doRegister();
+    reader->setReaderObservationExceptionHandler(
+        std::make_shared<CardReaderObservationExceptionHandlerSpiStub>());
+
+    auto observer = std::make_shared<TapLatencyObserver>();
+    reader->addObserver(observer);
+
+    CardSelectionManagerAdapter cardSelectionManager;
+    cardSelectionManager.prepareSelection(
+        std::make_shared<CardSelectionSpiStub>(
+            std::make_shared<CardSelectionRequestSpiStub>(
+                std::make_shared<CardSelectorSpiStub>(AID), nullptr)));
+    cardSelectionManager.scheduleCardSelectionScenario(reader,
+                                                       ObservableCardReader::DetectionMode::REPEATING,
+                                                       ObservableCardReader::NotificationMode::ALWAYS);
+
+    reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    std::vector<double> latencies;
+    const Clock::time_point start = Clock::now();
+
+    for (auto _ : state) {
+        std::this_thread::sleep_for(pause);
+
+        /* Tap */
+        const Clock::time_point tapTime = Clock::now();
+        setCardPresent(*readerSpi, true);
+
+        Clock::time_point matchedTime;
+        if (!observer->waitForMatched(matchedTime) ||
+            !waitForState(*reader, MonitoringState::WAIT_FOR_CARD_PROCESSING)) {
+            state.SkipWithError("CARD_MATCHED not received");
+            break;
+        }
+
+        const double latency = std::chrono::duration<double>(matchedTime - tapTime).count();
+        state.SetIterationTime(latency);
+        latencies.push_back(latency * 1e6);
+
+        /* Release the card */
+        reader->finalizeCardProcessing();
+        setCardPresent(*readerSpi, false);
+
+        if (!observer->waitForRemoved() ||
+            !waitForState(*reader, MonitoringState::WAIT_FOR_CARD_INSERTION)) {
+            state.SkipWithError("CARD_REMOVED not received");
+            break;
+        }
+    }
+
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    reader->stopCardDetection();
+    reader->doUnregister();
+
+    if (latencies.empty()) {
+        return;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](const double p) {
+        return latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+    };
+
+    state.counters["p50_us"] = percentile(0.50);
+    state.counters["p90_us"] = percentile(0.90);
+    state.counters["p99_us"] = percentile(0.99);
+    state.counters["max_us"] = latencies.back();
+    state.counters["taps_per_second"] = latencies.size() / elapsed;
+}
+
+/**
+ * Autonomous reader, the insertion is signaled by the SPI through onCardInserted().
+ */
+static void BM_TapLatency_autonomous(benchmark::State& state)
+{
+    runTapLatency(state,
+                  std::make_shared<ObservableReaderAutonomousSpiStub>(READER_NAME, RESPONSE));
+}
+BENCHMARK(BM_TapLatency_autonomous)
+    ->Arg(0)->Arg(10)->Iterations(200)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+/**
+ * Blocking reader, the insertion is detected by a monitoring job blocked in
+ * waitForCardInsertion().
+ */
+static void BM_TapLatency_blocking(benchmark::State& state)
+{
+    runTapLatency(state, std::make_shared<ObservableReaderBlockingSpiStub>(READER_NAME, RESPONSE));
+}
+BENCHMARK(BM_TapLatency_blocking)
+    ->Arg(0)->Arg(100)->Iterations(30)->UseManualTime()->Unit(benchmark::kMicrosecond);
+
+/**
+ * Non-blocking reader, the insertion is detected by a monitoring job polling
+ * checkCardPresence().
+ */
+static void BM_TapLatency_nonBlocking(benchmark::State& state)
+{
+    runTapLatency(state,
+                  std::make_shared<ObservableReaderNonBlockingSpiStub>(READER_NAME, RESPONSE));
+}
+BENCHMARK(BM_TapLatency_nonBlocking)
+    ->Arg(0)->Arg(100)->Iterations(20)->UseManualTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,41 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+/* Calypsonet Terminal Reader */
+#include "CardReaderObservationExceptionHandlerSpi.h"
+
+/* Keyple Core Util */
+#include "Exception.h"
+
+using namespace calypsonet::terminal::reader::spi;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Exception handler ignoring all errors.
+ */
+class CardReaderObservationExceptionHandlerSpiStub final
+: public CardReaderObservationExceptionHandlerSpi {
+public:
+    void onReaderObservationError(const std::string& contextInfo,
+                                  const std::string& readerName,
+                                  const std::shared_ptr<Exception> e) override
+    {
+        (void)contextInfo;
+        (void)readerName;
+        (void)e;
+    }
+};
@@ -0,0 +1,79 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Card */
+#include "ApduRequestSpi.h"
+#include "CardRequestSpi.h"
+
+using namespace calypsonet::terminal::card;
+using namespace calypsonet::terminal::card::spi;
+
+/**
+ * Immutable APDU request.
+ */
+class ApduRequestSpiStub final : public ApduRequestSpi {
+public:
+    ApduRequestSpiStub(const std::vector<uint8_t>& apdu)
+    : mApdu(apdu), mSuccessfulStatusWords({0x9000}), mInfo("bench") {}
+
+    const std::vector<uint8_t>& getApdu() const override
+    {
+        return mApdu;
+    }
+
+    const std::vector<int>& getSuccessfulStatusWords() const override
+    {
+        return mSuccessfulStatusWords;
+    }
+
+    const std::string& getInfo() const override
+    {
+        return mInfo;
+    }
+
+private:
+    const std::vector<uint8_t> mApdu;
+    const std::vector<int> mSuccessfulStatusWords;
+    const std::string mInfo;
+};
+
+/**
+ * Immutable card request made of a given number of identical APDU requests.
+ */
+class CardRequestSpiStub final : public CardRequestSpi {
+public:
+    CardRequestSpiStub(const std::vector<uint8_t>& apdu, const int apduCount)
+    {
+        for (int i = 0; i < apduCount; i++) {
+            mApduRequests.push_back(std::make_shared<ApduRequestSpiStub>(apdu));
+        }
+    }
+
+    const std::vector<std::shared_ptr<ApduRequestSpi>>& getApduRequests() const override
+    {
+        return mApduRequests;
+    }
+
+    bool stopOnUnsuccessfulStatusWord() const override
+    {
+        return true;
+    }
+
+private:
+    std::vector<std::shared_ptr<ApduRequestSpi>> mApduRequests;
+};
@@ -0,0 +1,170 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Card */
+#include "CardSelectionRequestSpi.h"
+#include "CardSelectionSpi.h"
+#include "CardSelectorSpi.h"
+#include "SmartCardSpi.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardSelection.h"
+#include "SmartCard.h"
+
+/* Stub */
+#include "CardRequestStub.h"
+
+using namespace calypsonet::terminal::card;
+using namespace calypsonet::terminal::card::spi;
+using namespace calypsonet::terminal::reader::selection::spi;
+
+/**
+ * Card selector by AID, without protocol nor power-on data filtering.
+ */
+class CardSelectorSpiStub final : public CardSelectorSpi {
+public:
+    CardSelectorSpiStub(const std::vector<uint8_t>& aid)
+    : CardSelectorSpiStub(aid, {0x9000}) {}
+
+    CardSelectorSpiStub(const std::vector<uint8_t>& aid,
+                        const std::vector<int>& successfulSelectionStatusWords)
+    : mAid(aid), mSuccessfulSelectionStatusWords(successfulSelectionStatusWords) {}
+
+    const std::string& getCardProtocol() const override
+    {
+        return mEmpty;
+    }
+
+    const std::string& getPowerOnDataRegex() const override
+    {
+        return mEmpty;
+    }
+
+    const std::vector<uint8_t> getAid() const override
+    {
+        return mAid;
+    }
+
+    FileOccurrence getFileOccurrence() const override
+    {
+        return FileOccurrence::FIRST;
+    }
+
+    FileControlInformation getFileControlInformation() const override
+    {
+        return FileControlInformation::FCI;
+    }
+
+    const std::vector<int>& getSuccessfulSelectionStatusWords() const override
+    {
+        return mSuccessfulSelectionStatusWords;
+    }
+
+private:
+    const std::string mEmpty;
+    const std::vector<uint8_t> mAid;
+    const std::vector<int> mSuccessfulSelectionStatusWords;
+};
+
+/**
+ * Card selection request made of a selector and an optional card request.
+ */
+class CardSelectionRequestSpiStub final : public CardSelectionRequestSpi {
+public:
+    CardSelectionRequestSpiStub(std::shared_ptr<CardSelectorSpi> cardSelector,
+                                std::shared_ptr<CardRequestSpi> cardRequest)
+    : mCardSelector(cardSelector), mCardRequest(cardRequest) {}
+
+    std::shared_ptr<CardSelectorSpi> getCardSelector() const override
+    {
+        return mCardSelector;
+    }
+
+    std::shared_ptr<CardRequestSpi> getCardRequest() const override
+    {
+        return mCardRequest;
+    }
+
+private:
+    const std::shared_ptr<CardSelectorSpi> mCardSelector;
+    const std::shared_ptr<CardRequestSpi> mCardRequest;
+};
+
+/**
+ * Smart card built by CardSelectionSpiStub.
+ */
+class SmartCardStub final : public SmartCard, public SmartCardSpi {
+public:
+    SmartCardStub(const std::string& powerOnData,
+                  const std::vector<uint8_t>& selectApplicationResponse)
+    : mPowerOnData(powerOnData), mSelectApplicationResponse(selectApplicationResponse) {}
+
+    const std::string& getPowerOnData() const override
+    {
+        return mPowerOnData;
+    }
+
+    const std::vector<uint8_t>& getSelectApplicationResponse() const override
+    {
+        return mSelectApplicationResponse;
+    }
+
+private:
+    const std::string mPowerOnData;
+    const std::vector<uint8_t> mSelectApplicationResponse;
+};
+
+/**
+ * Card extension selection, parsing a response into a SmartCardStub.
+ *
+ * <p>An optional parsing cost simulates a card extension decoding the response (busy wait).
+ */
+class CardSelectionSpiStub final : public CardSelection, public CardSelectionSpi {
+public:
+    CardSelectionSpiStub(std::shared_ptr<CardSelectionRequestSpi> cardSelectionRequest)
+    : CardSelectionSpiStub(cardSelectionRequest, 0) {}
+
+    CardSelectionSpiStub(std::shared_ptr<CardSelectionRequestSpi> cardSelectionRequest,
+                         const int parsingCostMicros)
+    : mCardSelectionRequest(cardSelectionRequest), mParsingCostMicros(parsingCostMicros) {}
+
+    const std::shared_ptr<CardSelectionRequestSpi> getCardSelectionRequest() override
+    {
+        return mCardSelectionRequest;
+    }
+
+    const std::shared_ptr<SmartCardSpi> parse(
+        const std::shared_ptr<CardSelectionResponseApi> cardSelectionResponse) override
+    {
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::microseconds(mParsingCostMicros);
+        while (std::chrono::steady_clock::now() < deadline) {}
+
+        const auto selectApplicationResponse = cardSelectionResponse->getSelectApplicationResponse();
+
+        return std::make_shared<SmartCardStub>(
+                   cardSelectionResponse->getPowerOnData(),
+                   selectApplicationResponse != nullptr ? selectApplicationResponse->getApdu()
+                                                        : std::vector<uint8_t>());
+    }
+
+private:
+    const std::shared_ptr<CardSelectionRequestSpi> mCardSelectionRequest;
+    const int mParsingCostMicros;
+};
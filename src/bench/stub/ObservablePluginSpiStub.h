@@ -0,0 +1,116 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* Keyple Core Plugin */
+#include "ObservablePluginSpi.h"
+
+/* Stub */
+#include "ObservableReaderBlockingSpiStub.h"
+
+using namespace keyple::core::plugin::spi;
+
+/**
+ * Observable plugin exposing a variable number of zero-latency blocking readers, named
+ * "reader-0", "reader-1", etc. plugReader() simulates the connection of a new reader, detected
+ * by the monitoring thread of the plugin at its next cycle.
+ */
+class ObservablePluginSpiStub final : public ObservablePluginSpi {
+public:
+    ObservablePluginSpiStub(const std::string& name,
+                            const int readerCount,
+                            const int monitoringCycleDuration,
+                            const std::vector<uint8_t>& response)
+    : mName(name), mMonitoringCycleDuration(monitoringCycleDuration), mResponse(response)
+    {
+        for (int i = 0; i < readerCount; i++) {
+            plugReader("reader-" + std::to_string(i));
+        }
+    }
+
+    const std::string& getName() const override
+    {
+        return mName;
+    }
+
+    const std::vector<std::shared_ptr<ReaderSpi>> searchAvailableReaders() override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        std::vector<std::shared_ptr<ReaderSpi>> readers;
+        for (const auto& entry : mReaders) {
+            readers.push_back(entry.second);
+        }
+
+        return readers;
+    }
+
+    void onUnregister() override {}
+
+    int getMonitoringCycleDuration() const override
+    {
+        return mMonitoringCycleDuration;
+    }
+
+    const std::vector<std::string> searchAvailableReaderNames() override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        std::vector<std::string> readerNames;
+        for (const auto& entry : mReaders) {
+            readerNames.push_back(entry.first);
+        }
+
+        return readerNames;
+    }
+
+    std::shared_ptr<ReaderSpi> searchReader(const std::string& readerName) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        const auto it = mReaders.find(readerName);
+
+        return it != mReaders.end() ? it->second : nullptr;
+    }
+
+    std::shared_ptr<ObservableReaderBlockingSpiStub> plugReader(const std::string& readerName)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        auto readerSpi = std::make_shared<ObservableReaderBlockingSpiStub>(readerName, mResponse);
+        mReaders[readerName] = readerSpi;
+
+        return readerSpi;
+    }
+
+    std::shared_ptr<ObservableReaderBlockingSpiStub> getReaderSpi(const std::string& readerName)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mReaders.at(readerName);
+    }
+
+private:
+    const std::string mName;
+    const int mMonitoringCycleDuration;
+    const std::vector<uint8_t> mResponse;
+    std::mutex mMutex;
+    std::map<std::string, std::shared_ptr<ObservableReaderBlockingSpiStub>> mReaders;
+};
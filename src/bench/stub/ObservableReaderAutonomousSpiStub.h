@@ -0,0 +1,78 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+/* Keyple Core Plugin */
+#include "DontWaitForCardRemovalDuringProcessingSpi.h"
+#include "ObservableReaderSpi.h"
+#include "WaitForCardInsertionAutonomousReaderApi.h"
+#include "WaitForCardInsertionAutonomousSpi.h"
+#include "WaitForCardRemovalAutonomousReaderApi.h"
+#include "WaitForCardRemovalAutonomousSpi.h"
+
+/* Stub */
+#include "ReaderSpiStub.h"
+
+using namespace keyple::core::plugin;
+using namespace keyple::core::plugin::spi::reader::observable;
+using namespace keyple::core::plugin::spi::reader::observable::state::insertion;
+using namespace keyple::core::plugin::spi::reader::observable::state::processing;
+using namespace keyple::core::plugin::spi::reader::observable::state::removal;
+
+/**
+ * Zero-latency autonomous observable reader: card insertions and removals are signaled
+ * synchronously by the benchmark itself, no monitoring thread is involved.
+ */
+class ObservableReaderAutonomousSpiStub final
+: public ReaderSpiStub,
+  public ObservableReaderSpi,
+  public WaitForCardInsertionAutonomousSpi,
+  public WaitForCardRemovalAutonomousSpi,
+  public DontWaitForCardRemovalDuringProcessingSpi {
+public:
+    ObservableReaderAutonomousSpiStub(const std::string& name,
+                                      const std::vector<uint8_t>& response)
+    : ReaderSpiStub(name, response),
+      mWaitForCardInsertionAutonomousReaderApi(nullptr),
+      mWaitForCardRemovalAutonomousReaderApi(nullptr) {}
+
+    void onStartDetection() override {}
+
+    void onStopDetection() override {}
+
+    void connect(WaitForCardInsertionAutonomousReaderApi* api) override
+    {
+        mWaitForCardInsertionAutonomousReaderApi = api;
+    }
+
+    void connect(WaitForCardRemovalAutonomousReaderApi* api) override
+    {
+        mWaitForCardRemovalAutonomousReaderApi = api;
+    }
+
+    void insertCard()
+    {
+        setCardPresent(true);
+        mWaitForCardInsertionAutonomousReaderApi->onCardInserted();
+    }
+
+    void removeCard()
+    {
+        setCardPresent(false);
+        mWaitForCardRemovalAutonomousReaderApi->onCardRemoved();
+    }
+
+private:
+    WaitForCardInsertionAutonomousReaderApi* mWaitForCardInsertionAutonomousReaderApi;
+    WaitForCardRemovalAutonomousReaderApi* mWaitForCardRemovalAutonomousReaderApi;
+};
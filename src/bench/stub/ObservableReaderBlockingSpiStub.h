@@ -0,0 +1,114 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+/* Keyple Core Plugin */
+#include "DontWaitForCardRemovalDuringProcessingSpi.h"
+#include "ObservableReaderSpi.h"
+#include "TaskCanceledException.h"
+#include "WaitForCardInsertionBlockingSpi.h"
+#include "WaitForCardRemovalBlockingSpi.h"
+
+/* Stub */
+#include "ReaderSpiStub.h"
+
+using namespace keyple::core::plugin;
+using namespace keyple::core::plugin::spi::reader::observable;
+using namespace keyple::core::plugin::spi::reader::observable::state::insertion;
+using namespace keyple::core::plugin::spi::reader::observable::state::processing;
+using namespace keyple::core::plugin::spi::reader::observable::state::removal;
+
+/**
+ * Zero-latency blocking observable reader: the monitoring jobs block in waitForCardInsertion()
+ * and waitForCardRemoval() until setCardPresent() changes the card presence.
+ */
+class ObservableReaderBlockingSpiStub final
+: public ReaderSpiStub,
+  public ObservableReaderSpi,
+  public WaitForCardInsertionBlockingSpi,
+  public WaitForCardRemovalBlockingSpi,
+  public DontWaitForCardRemovalDuringProcessingSpi {
+public:
+    ObservableReaderBlockingSpiStub(const std::string& name, const std::vector<uint8_t>& response)
+    : ReaderSpiStub(name, response), mWaiting(false), mStopRequested(false)
+    {
+        mCardPresent = false;
+    }
+
+    void setCardPresent(const bool cardPresent) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCardPresent = cardPresent;
+        mCondition.notify_all();
+    }
+
+    void onStartDetection() override {}
+
+    void onStopDetection() override {}
+
+    void waitForCardInsertion() override
+    {
+        waitForCardPresence(true);
+    }
+
+    void stopWaitForCardInsertion() override
+    {
+        stopWait();
+    }
+
+    void waitForCardRemoval() override
+    {
+        waitForCardPresence(false);
+    }
+
+    void stopWaitForCardRemoval() override
+    {
+        stopWait();
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mWaiting;
+    bool mStopRequested;
+
+    void waitForCardPresence(const bool cardPresent)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mWaiting = true;
+        mStopRequested = false;
+        mCondition.wait(lock, [this, cardPresent]() {
+            return mCardPresent == cardPresent || mStopRequested;
+        });
+        mWaiting = false;
+
+        if (mCardPresent != cardPresent) {
+            throw TaskCanceledException("The wait has been stopped.");
+        }
+    }
+
+    void stopWait()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        /* Only a pending wait is stopped, the monitoring job may stop itself from its own thread */
+        if (mWaiting) {
+            mStopRequested = true;
+            mCondition.notify_all();
+        }
+    }
+};
@@ -0,0 +1,50 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+/* Keyple Core Plugin */
+#include "DontWaitForCardRemovalDuringProcessingSpi.h"
+#include "ObservableReaderSpi.h"
+#include "WaitForCardInsertionNonBlockingSpi.h"
+#include "WaitForCardRemovalNonBlockingSpi.h"
+
+/* Stub */
+#include "ReaderSpiStub.h"
+
+using namespace keyple::core::plugin::spi::reader::observable;
+using namespace keyple::core::plugin::spi::reader::observable::state::insertion;
+using namespace keyple::core::plugin::spi::reader::observable::state::processing;
+using namespace keyple::core::plugin::spi::reader::observable::state::removal;
+
+/**
+ * Zero-latency non-blocking observable reader: the service polls checkCardPresence() for the
+ * insertion and pings the card with transmitApdu() for the removal.
+ */
+class ObservableReaderNonBlockingSpiStub
+: public ReaderSpiStub,
+  public ObservableReaderSpi,
+  public WaitForCardInsertionNonBlockingSpi,
+  public WaitForCardRemovalNonBlockingSpi,
+  public DontWaitForCardRemovalDuringProcessingSpi {
+public:
+    ObservableReaderNonBlockingSpiStub(const std::string& name,
+                                       const std::vector<uint8_t>& response)
+    : ReaderSpiStub(name, response)
+    {
+        mCardPresent = false;
+    }
+
+    void onStartDetection() override {}
+
+    void onStopDetection() override {}
+};
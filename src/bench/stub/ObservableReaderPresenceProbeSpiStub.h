@@ -0,0 +1,37 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+/* Keyple Core Service */
+#include "CardPresenceProbeSpi.h"
+
+/* Stub */
+#include "ObservableReaderNonBlockingSpiStub.h"
+
+using namespace keyple::core::service::spi;
+
+/**
+ * Zero-latency non-blocking observable reader also providing a driver-level presence probe.
+ */
+class ObservableReaderPresenceProbeSpiStub final
+: public ObservableReaderNonBlockingSpiStub, public CardPresenceProbeSpi {
+public:
+    ObservableReaderPresenceProbeSpiStub(const std::string& name,
+                                         const std::vector<uint8_t>& response)
+    : ObservableReaderNonBlockingSpiStub(name, response) {}
+
+    Result probeCardPresence() override
+    {
+        return mCardPresent ? Result::CARD_PRESENT : Result::CARD_ABSENT;
+    }
+};
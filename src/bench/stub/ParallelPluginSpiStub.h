@@ -0,0 +1,72 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Keyple Core Plugin */
+#include "PluginSpi.h"
+
+/* Keyple Core Service */
+#include "ParallelReaderRegistrationSpi.h"
+
+/* Stub */
+#include "ObservableReaderBlockingSpiStub.h"
+
+using namespace keyple::core::plugin::spi;
+using namespace keyple::core::service::spi;
+
+/**
+ * Plugin exposing a fixed number of zero-latency blocking readers, named "reader-0",
+ * "reader-1", etc., registered on a configurable number of threads (1 meaning sequentially).
+ */
+class ParallelPluginSpiStub final : public PluginSpi, public ParallelReaderRegistrationSpi {
+public:
+    ParallelPluginSpiStub(const std::string& name,
+                          const int readerCount,
+                          const int registrationThreadCount,
+                          const std::vector<uint8_t>& response)
+    : mName(name), mRegistrationThreadCount(registrationThreadCount)
+    {
+        for (int i = 0; i < readerCount; i++) {
+            mReaders.push_back(
+                std::make_shared<ObservableReaderBlockingSpiStub>("reader-" + std::to_string(i),
+                                                                  response));
+        }
+    }
+
+    const std::string& getName() const override
+    {
+        return mName;
+    }
+
+    const std::vector<std::shared_ptr<ReaderSpi>> searchAvailableReaders() override
+    {
+        return mReaders;
+    }
+
+    void onUnregister() override {}
+
+    int getReaderRegistrationThreadCount() const override
+    {
+        return mRegistrationThreadCount;
+    }
+
+private:
+    const std::string mName;
+    const int mRegistrationThreadCount;
+    std::vector<std::shared_ptr<ReaderSpi>> mReaders;
+};
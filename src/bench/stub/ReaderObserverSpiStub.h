@@ -0,0 +1,45 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+/* Calypsonet Terminal Reader */
+#include "CardReaderEvent.h"
+#include "CardReaderObserverSpi.h"
+
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::spi;
+
+/**
+ * Observer only counting the received events.
+ */
+class ReaderObserverSpiStub final : public CardReaderObserverSpi {
+public:
+    ReaderObserverSpiStub() : mEventCount(0) {}
+
+    void onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent) override
+    {
+        (void)readerEvent;
+
+        mEventCount++;
+    }
+
+    uint64_t getEventCount() const
+    {
+        return mEventCount;
+    }
+
+private:
+    uint64_t mEventCount;
+};
@@ -0,0 +1,99 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+/* Keyple Core Common */
+#include "KeypleReaderExtension.h"
+
+/* Keyple Core Plugin */
+#include "CardIOException.h"
+#include "ReaderSpi.h"
+
+using namespace keyple::core::common;
+using namespace keyple::core::plugin;
+using namespace keyple::core::plugin::spi::reader;
+
+/**
+ * Zero-latency reader: while a card is present (default), every APDU is answered immediately with
+ * the same response.
+ */
+class ReaderSpiStub : virtual public ReaderSpi, public KeypleReaderExtension {
+public:
+    ReaderSpiStub(const std::string& name, const std::vector<uint8_t>& response)
+    : mName(name), mResponse(response), mPhysicalChannelOpen(false), mCardPresent(true) {}
+
+    virtual void setCardPresent(const bool cardPresent)
+    {
+        mCardPresent = cardPresent;
+    }
+
+    const std::string& getName() const override
+    {
+        return mName;
+    }
+
+    void openPhysicalChannel() override
+    {
+        mPhysicalChannelOpen = true;
+    }
+
+    void closePhysicalChannel() override
+    {
+        mPhysicalChannelOpen = false;
+    }
+
+    bool isPhysicalChannelOpen() const override
+    {
+        return mPhysicalChannelOpen;
+    }
+
+    bool checkCardPresence() override
+    {
+        return mCardPresent;
+    }
+
+    const std::string getPowerOnData() const override
+    {
+        return "";
+    }
+
+    const std::vector<uint8_t> transmitApdu(const std::vector<uint8_t>& apduIn) override
+    {
+        (void)apduIn;
+
+        if (!mCardPresent) {
+            throw CardIOException("Card is not present.");
+        }
+
+        return mResponse;
+    }
+
+    bool isContactless() override
+    {
+        return true;
+    }
+
+    void onUnregister() override {}
+
+private:
+    const std::string mName;
+    const std::vector<uint8_t> mResponse;
+    bool mPhysicalChannelOpen;
+
+protected:
+    std::atomic<bool> mCardPresent;
+};
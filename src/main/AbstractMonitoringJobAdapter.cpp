@@ -12,10 +12,18 @@
 
 #include "AbstractMonitoringJobAdapter.h"
 
+/* Keyple Core Util */
+#include "Thread.h"
+
 namespace keyple {
 namespace core {
 namespace service {
 
+using namespace keyple::core::util::cpp;
+
+/* Longest sleep between two checks of the loop flag */
+static const long WAIT_SLICE_MILLIS = 50;
+
 AbstractMonitoringJobAdapter::AbstractMonitoringJobAdapter(ObservableLocalReaderAdapter* reader)
 : mReader(reader) {}
 
@@ -24,6 +32,18 @@ ObservableLocalReaderAdapter* AbstractMonitoringJobAdapter::getReader() const
     return mReader;
 }
 
+void AbstractMonitoringJobAdapter::waitForNextPoll(const long unsuccessfulPolls,
+                                                   const std::atomic<bool>& loop) const
+{
+    long remaining = mReader->getPollingPolicy()->getCycleDuration(unsuccessfulPolls);
+
+    while (loop && remaining > 0) {
+        const long slice = remaining < WAIT_SLICE_MILLIS ? remaining : WAIT_SLICE_MILLIS;
+        Thread::sleep(slice);
+        remaining -= slice;
+    }
+}
+
 }
 }
 }
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 /* Keyple Core Service */
@@ -77,6 +78,23 @@ public:
      */
     virtual void stop() = 0;
 
+protected:
+    /**
+     * (package-private)<br>
+     * Waits before the next presence poll, for the cycle duration given by the polling policy of
+     * the reader.
+     *
+     * <p>The wait is sliced so that the monitoring job remains responsive to stop() after a long
+     * back-off.
+     *
+     * @param unsuccessfulPolls The number of unsuccessful polls since the start of the job.
+     * @param loop The loop flag of the job, the wait ends as soon as it is reset.
+     * @throw InterruptedException If the thread is interrupted while waiting.
+     * @since 2.0.0
+     */
+    virtual void waitForNextPoll(const long unsuccessfulPolls,
+                                 const std::atomic<bool>& loop) const final;
+
 private:
     /**
      *
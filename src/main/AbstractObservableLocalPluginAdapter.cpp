@@ -48,7 +48,17 @@ AbstractObservableLocalPluginAdapter::AbstractObservableLocalPluginAdapter(
 : LocalPluginAdapter(pluginSpi),
   mObservationManager(
       std::make_shared<ObservationManagerAdapter<PluginObserverSpi,
-                                                 PluginObservationExceptionHandlerSpi>>("", "")) {}
+                                                 PluginObservationExceptionHandlerSpi>>("", ""))
+{
+    const auto metrics = MetricsRegistry::getInstance();
+    mReaderConnectedCounter = metrics->getCounter(MetricsRegistry::PLUGIN_READER_CONNECTED,
+                                                  "Number of readers connected to the plugin.",
+                                                  {{"plugin", getName()}});
+    mReaderDisconnectedCounter = metrics->getCounter(MetricsRegistry::PLUGIN_READER_DISCONNECTED,
+                                                     "Number of readers disconnected from the " \
+                                                     "plugin.",
+                                                     {{"plugin", getName()}});
+}
 
 std::shared_ptr<ObservationManagerAdapter<PluginObserverSpi, PluginObservationExceptionHandlerSpi>>
     AbstractObservableLocalPluginAdapter::getObservationManager() const
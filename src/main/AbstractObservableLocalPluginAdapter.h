@@ -20,6 +20,7 @@
 /* Keyple Core Service */
 #include "Job.h"
 #include "LocalPluginAdapter.h"
+#include "MetricsRegistry.h"
 #include "PluginObserverSpi.h"
 #include "ObservationManagerAdapter.h"
 #include "ObservablePlugin.h"
@@ -125,6 +126,16 @@ public:
     virtual void setPluginObservationExceptionHandler(
         std::shared_ptr<PluginObservationExceptionHandlerSpi> exceptionHandler) override final;
 
+protected:
+    /**
+     * (package-private)<br>
+     * Metrics of the plugin, registered once at construction.
+     *
+     * @since 2.0.0
+     */
+    std::shared_ptr<MetricsRegistry::Counter> mReaderConnectedCounter;
+    std::shared_ptr<MetricsRegistry::Counter> mReaderDisconnectedCounter;
+
 private:
     /**
      *
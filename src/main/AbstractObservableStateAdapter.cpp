@@ -66,19 +66,25 @@ void AbstractObservableStateAdapter::onDeactivate()
     mLogger->trace("[%] onDeactivate => %\n", mReader->getName(), getMonitoringState());
 
     /* Cancel the monitoringJob if necessary */
+    stopMonitoringJob();
+
+    /* Make sure pointer is set to nullptr to force Job/Thread destruction */
+    mMonitoringEvent = nullptr;
+}
+
+void AbstractObservableStateAdapter::stopMonitoringJob()
+{
     if (mMonitoringEvent != nullptr && !mMonitoringEvent->isDone()) {
         mMonitoringJob->stop();
 
         const bool canceled = mMonitoringEvent->cancel(false);
         const auto& id = *mMonitoringJob.get();
-        mLogger->trace("[%] onDeactivate => cancel monitoring job % by thread interruption %\n",
+        mLogger->trace("[%] stopMonitoringJob => cancel monitoring job % by thread interruption " \
+                       "%\n",
                        mReader->getName(),
                        typeid(id).name(),
                        canceled);
     }
-
-    /* Make sure pointer is set to nullptr to force Job/Thread destruction */
-    mMonitoringEvent = nullptr;
 }
 
 }
@@ -127,6 +127,16 @@ public:
      */
     virtual void onDeactivate() final;
 
+    /**
+     * (package-private)<br>
+     * Stops the monitoring job if it is running, the state remaining active.
+     *
+     * <p>Frees the monitoring thread, e.g. for an event handed over to it.
+     *
+     * @since 2.0.0
+     */
+    virtual void stopMonitoringJob() final;
+
     /**
      * (package-private)<br>
      * Handle Internal Event.
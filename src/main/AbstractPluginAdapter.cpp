@@ -28,7 +28,10 @@ using namespace keyple::core::util::cpp::exception;
 
 AbstractPluginAdapter::AbstractPluginAdapter(const std::string& pluginName,
                                              std::shared_ptr<KeyplePluginExtension> pluginExtension)
-: mPluginName(pluginName), mPluginExtension(pluginExtension) {}
+: mPluginName(pluginName),
+  mPluginExtension(pluginExtension),
+  mIsRegistered(false),
+  mReaders(std::make_shared<const ReadersMap>()) {}
 
 std::shared_ptr<LocalReaderAdapter> AbstractPluginAdapter::buildLocalReaderAdapter(
     std::shared_ptr<ReaderSpi> readerSpi)
@@ -71,8 +74,15 @@ void AbstractPluginAdapter::doRegister()
 void AbstractPluginAdapter::doUnregister()
 {
     mIsRegistered = false;
-    
-    for (const auto& pair : mReaders) {
+
+    std::shared_ptr<const ReadersMap> readers;
+    {
+        std::lock_guard<std::mutex> lock(mReadersMutex);
+        readers = std::atomic_load(&mReaders);
+        std::atomic_store(&mReaders, std::make_shared<const ReadersMap>());
+    }
+
+    for (const auto& pair : *readers) {
         try {
             std::dynamic_pointer_cast<AbstractReaderAdapter>(pair.second)->doUnregister();
         } catch (const Exception& e) {
@@ -81,9 +91,6 @@ void AbstractPluginAdapter::doUnregister()
                            e);
         }
     }
-    
-    mReaders.clear();
-    mIsRegistered = false;
 }
 
 const std::string& AbstractPluginAdapter::getName() const
@@ -101,17 +108,61 @@ std::shared_ptr<KeyplePluginExtension> AbstractPluginAdapter::getExtension(
     return mPluginExtension;
 }
 
-std::map<const std::string, std::shared_ptr<Reader>>& AbstractPluginAdapter::getReadersMap()
+std::shared_ptr<const AbstractPluginAdapter::ReadersMap>
+    AbstractPluginAdapter::getReadersSnapshot() const
+{
+    return std::atomic_load(&mReaders);
+}
+
+void AbstractPluginAdapter::addReaderToMap(const std::shared_ptr<Reader> reader)
 {
-    return mReaders;
+    std::lock_guard<std::mutex> lock(mReadersMutex);
+
+    const std::shared_ptr<const ReadersMap> readers = std::atomic_load(&mReaders);
+    if (readers->find(reader->getName()) != readers->end()) {
+        return;
+    }
+
+    auto newReaders = std::make_shared<ReadersMap>(*readers);
+    newReaders->insert({reader->getName(), reader});
+    std::atomic_store(&mReaders, std::shared_ptr<const ReadersMap>(newReaders));
+}
+
+void AbstractPluginAdapter::addReadersToMap(const std::vector<std::shared_ptr<Reader>>& readers)
+{
+    std::lock_guard<std::mutex> lock(mReadersMutex);
+
+    auto newReaders = std::make_shared<ReadersMap>(*std::atomic_load(&mReaders));
+    for (const auto& reader : readers) {
+        newReaders->insert({reader->getName(), reader});
+    }
+
+    std::atomic_store(&mReaders, std::shared_ptr<const ReadersMap>(newReaders));
+}
+
+void AbstractPluginAdapter::removeReaderFromMap(const std::string& readerName)
+{
+    std::lock_guard<std::mutex> lock(mReadersMutex);
+
+    const std::shared_ptr<const ReadersMap> readers = std::atomic_load(&mReaders);
+    if (readers->find(readerName) == readers->end()) {
+        return;
+    }
+
+    auto newReaders = std::make_shared<ReadersMap>(*readers);
+    newReaders->erase(readerName);
+    std::atomic_store(&mReaders, std::shared_ptr<const ReadersMap>(newReaders));
 }
 
 const std::vector<std::string> AbstractPluginAdapter::getReaderNames() const
 {
     checkStatus();
 
+    const std::shared_ptr<const ReadersMap> readers = getReadersSnapshot();
+
     std::vector<std::string> readerNames;
-    for (const auto& pair : mReaders) {
+    readerNames.reserve(readers->size());
+    for (const auto& pair : *readers) {
         readerNames.push_back(pair.first);
     }
 
@@ -122,20 +173,26 @@ const std::vector<std::shared_ptr<Reader>> AbstractPluginAdapter::getReaders() c
 {
     checkStatus();
 
-    std::vector<std::shared_ptr<Reader>> readers;
-    for (const auto& pair : mReaders) {
-        readers.push_back(pair.second);
+    const std::shared_ptr<const ReadersMap> readers = getReadersSnapshot();
+
+    std::vector<std::shared_ptr<Reader>> readerList;
+    readerList.reserve(readers->size());
+    for (const auto& pair : *readers) {
+        readerList.push_back(pair.second);
     }
 
-    return readers;
+    return readerList;
 }
 
 std::shared_ptr<Reader> AbstractPluginAdapter::getReader(const std::string& name) const
 {
     checkStatus();
 
-    if (mReaders.find(name) != mReaders.end()) {
-        return mReaders.at(name);
+    const std::shared_ptr<const ReadersMap> readers = getReadersSnapshot();
+
+    const auto it = readers->find(name);
+    if (it != readers->end()) {
+        return it->second;
     }
 
     return nullptr;
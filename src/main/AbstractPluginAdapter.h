@@ -12,9 +12,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 /* Keyple Core Util */
 #include "LoggerFactory.h"
@@ -42,6 +46,14 @@ using namespace keyple::core::util::cpp;
  */
 class AbstractPluginAdapter : virtual public Plugin {
 public:
+    /**
+     * (package-private)<br>
+     * Readers indexed by name.
+     *
+     * @since 2.0.0
+     */
+    using ReadersMap = std::map<const std::string, std::shared_ptr<Reader>>;
+
     /**
      * (package-private)<br>
      * Constructor.
@@ -111,11 +123,46 @@ public:
 
     /**
      * (package-private)<br>
-     * Gets the Map of all connected readers.
+     * Gets an immutable snapshot of the map of all connected readers.
+     *
+     * <p>Getting it neither locks nor allocates, and it can be iterated from any thread while the
+     * readers are added or removed: those changes publish a new snapshot (copy-on-write).
+     *
+     * <p>The returned pointer must be kept while iterating (not iterated as a temporary).
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    std::shared_ptr<const ReadersMap> getReadersSnapshot() const;
+
+    /**
+     * (package-private)<br>
+     * Adds a reader to the map of connected readers, unless a reader with the same name is
+     * already present.
+     *
+     * @param reader The reader.
+     * @since 2.0.0
+     */
+    void addReaderToMap(const std::shared_ptr<Reader> reader);
+
+    /**
+     * (package-private)<br>
+     * Adds several readers to the map of connected readers in a single snapshot, skipping the
+     * readers whose name is already present.
      *
+     * @param readers The readers.
      * @since 2.0.0
      */
-    std::map<const std::string, std::shared_ptr<Reader>>& getReadersMap();
+    void addReadersToMap(const std::vector<std::shared_ptr<Reader>>& readers);
+
+    /**
+     * (package-private)<br>
+     * Removes a reader from the map of connected readers, if present.
+     *
+     * @param readerName The name of the reader.
+     * @since 2.0.0
+     */
+    void removeReaderFromMap(const std::string& readerName);
 
     /**
      * {@inheritDoc}
@@ -157,12 +204,17 @@ private:
     /**
      *
      */
-    bool mIsRegistered;
+    std::atomic<bool> mIsRegistered;
 
     /**
-     *
+     * Current snapshot, only accessed through the std::atomic_load/atomic_store functions.
+     */
+    std::shared_ptr<const ReadersMap> mReaders;
+
+    /**
+     * Serializes the writers of the snapshot.
      */
-    std::map<const std::string, std::shared_ptr<Reader>> mReaders;
+    std::mutex mReadersMutex;
 };
 
 }
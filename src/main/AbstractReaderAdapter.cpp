@@ -12,10 +12,16 @@
 
 #include "AbstractReaderAdapter.h"
 
+#include <thread>
+
 /* Calypsonet Terminal Card */
 #include "CardBrokenCommunicationException.h"
+#include "ReaderBrokenCommunicationException.h"
 #include "UnexpectedStatusWordException.h"
 
+/* Keyple Core Service */
+#include "TraceRecorder.h"
+
 /* Keyple Core Util */
 #include "IllegalStateException.h"
 #include "KeypleAssert.h"
@@ -39,6 +45,21 @@ AbstractReaderAdapter::AbstractReaderAdapter(const std::string& readerName,
   mIsRegistered(false),
   mBefore(0) {}
 
+AbstractReaderAdapter::~AbstractReaderAdapter()
+{
+    /*
+     * Released by the last job of its own executor, which cannot wait for itself: the executor is
+     * handed over to another thread, which waits for its termination (i.e. for the end of the job)
+     * before releasing it, so that it is never destroyed by its own thread.
+     */
+    if (mExecutorService != nullptr && mExecutorService->isExecutorThread()) {
+        std::thread([](const std::shared_ptr<ExecutorService>& executorService) {
+                        executorService->shutdown();
+                    },
+                    mExecutorService).detach();
+    }
+}
+
 const std::string& AbstractReaderAdapter::getPluginName() const
 {
     return mPluginName;
@@ -50,9 +71,22 @@ const std::vector<std::shared_ptr<CardSelectionResponseApi>>
         const MultiSelectionProcessing multiSelectionProcessing,
         const ChannelControl channelControl)
 {
+    return tryTransmitCardSelectionRequests(cardSelectionRequests,
+                                            multiSelectionProcessing,
+                                            channelControl).valueOrThrow();
+}
+
+TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+    AbstractReaderAdapter::tryTransmitCardSelectionRequests(
+        const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
+        const MultiSelectionProcessing multiSelectionProcessing,
+        const ChannelControl channelControl)
+{
+    TraceRecorder::Span span("AbstractReaderAdapter::transmitCardSelectionRequests", getName());
+
     checkStatus();
 
-    std::vector<std::shared_ptr<CardSelectionResponseApi>> cardSelectionResponses;
+    waitForPendingJobs();
 
     uint64_t timeStamp = System::nanoTime();
     uint64_t elapsed10ms = (timeStamp - mBefore) / 100000;
@@ -63,15 +97,24 @@ const std::vector<std::shared_ptr<CardSelectionResponseApi>>
                    cardSelectionRequests,
                    elapsed10ms / 10.0);
 
-    try {
-        cardSelectionResponses = processCardSelectionRequests(cardSelectionRequests,
-                                                              multiSelectionProcessing,
-                                                              channelControl);
-    } catch (const UnexpectedStatusWordException& e) {
-        throw CardBrokenCommunicationException(e.getCardResponse(),
-                                               false,
-                                               "An unexpected status word was received.",
-                                               std::make_shared<UnexpectedStatusWordException>(e));
+    TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>> result =
+        tryProcessCardSelectionRequests(cardSelectionRequests,
+                                        multiSelectionProcessing,
+                                        channelControl);
+
+    if (!result.isSuccess()) {
+        const std::shared_ptr<const TransmitFailure>& failure = result.getFailure();
+
+        if (failure->getType() == TransmitFailure::Type::UNEXPECTED_STATUS_WORD) {
+            return std::make_shared<const TransmitFailure>(
+                       TransmitFailure::Type::CARD_BROKEN_COMMUNICATION,
+                       failure->getCardResponse(),
+                       false,
+                       "An unexpected status word was received.",
+                       failure);
+        }
+
+        return result;
     }
 
     timeStamp = System::nanoTime();
@@ -80,11 +123,44 @@ const std::vector<std::shared_ptr<CardSelectionResponseApi>>
 
     mLogger->debug("[%] received => %, elapsed % ms\n",
                    getName(),
-                   cardSelectionResponses,
+                   result.getValue(),
                    elapsed10ms / 10.0);
 
+    return result;
+}
 
-    return cardSelectionResponses;
+TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+    AbstractReaderAdapter::tryProcessCardSelectionRequests(
+        const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
+        const MultiSelectionProcessing multiSelectionProcessing,
+        const ChannelControl channelControl)
+{
+    try {
+        return processCardSelectionRequests(cardSelectionRequests,
+                                            multiSelectionProcessing,
+                                            channelControl);
+    } catch (const ReaderBrokenCommunicationException& e) {
+        return std::make_shared<const TransmitFailure>(
+                   TransmitFailure::Type::READER_BROKEN_COMMUNICATION,
+                   e.getCardResponse(),
+                   e.isCardResponseComplete(),
+                   e.getMessage(),
+                   e.getCause());
+    } catch (const CardBrokenCommunicationException& e) {
+        return std::make_shared<const TransmitFailure>(
+                   TransmitFailure::Type::CARD_BROKEN_COMMUNICATION,
+                   e.getCardResponse(),
+                   e.isCardResponseComplete(),
+                   e.getMessage(),
+                   e.getCause());
+    } catch (const UnexpectedStatusWordException& e) {
+        return std::make_shared<const TransmitFailure>(
+                   TransmitFailure::Type::UNEXPECTED_STATUS_WORD,
+                   e.getCardResponse(),
+                   e.isCardResponseComplete(),
+                   e.getMessage(),
+                   e.getCause());
+    }
 }
 
 void AbstractReaderAdapter::checkStatus() const
@@ -104,6 +180,33 @@ void AbstractReaderAdapter::doRegister()
 void AbstractReaderAdapter::doUnregister()
 {
     mIsRegistered = false;
+
+    /* The work still in progress on the reader ends before it is released */
+    waitForPendingJobs();
+}
+
+std::shared_ptr<ExecutorService> AbstractReaderAdapter::getExecutorService()
+{
+    std::lock_guard<std::mutex> lock(mExecutorServiceMutex);
+
+    if (mExecutorService == nullptr) {
+        mExecutorService = std::make_shared<ExecutorService>();
+    }
+
+    return mExecutorService;
+}
+
+void AbstractReaderAdapter::waitForPendingJobs()
+{
+    std::shared_ptr<ExecutorService> executorService;
+    {
+        std::lock_guard<std::mutex> lock(mExecutorServiceMutex);
+        executorService = mExecutorService;
+    }
+
+    if (executorService != nullptr && !executorService->isExecutorThread()) {
+        executorService->drain();
+    }
 }
 
 const std::string& AbstractReaderAdapter::getName() const
@@ -129,6 +232,8 @@ const std::shared_ptr<CardResponseApi> AbstractReaderAdapter::transmitCardReques
 
     Assert::getInstance().notNull(cardRequest, "cardRequest");
 
+    waitForPendingJobs();
+
     std::shared_ptr<CardResponseApi> cardResponse = nullptr;
 
     uint64_t timeStamp = System::nanoTime();
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <typeinfo>
 #include <vector>
 
@@ -28,8 +29,10 @@
 #include "LoggerFactory.h"
 
 /* Keyple Core Service */
+#include "ExecutorService.h"
 #include "MultiSelectionProcessing.h"
 #include "Reader.h"
+#include "TransmitResult.h"
 
 namespace keyple {
 namespace core {
@@ -37,6 +40,7 @@ namespace service {
 
 using namespace calypsonet::terminal::card;
 using namespace keyple::core::common;
+using namespace keyple::core::service::cpp;
 using namespace keyple::core::util::cpp;
 
 /**
@@ -63,7 +67,7 @@ public:
     /**
      *
      */
-    virtual ~AbstractReaderAdapter() = default;
+    virtual ~AbstractReaderAdapter();
 
     /**
      * (package-private) <br>
@@ -103,6 +107,28 @@ public:
             const MultiSelectionProcessing multiSelectionProcessing,
             const ChannelControl channelControl);
 
+    /**
+     * (package-private)<br>
+     * Same as transmitCardSelectionRequests(), the communication failures being returned instead
+     * of thrown.
+     *
+     * <p>An unexpected status word is reported as a CARD_BROKEN_COMMUNICATION failure.
+     *
+     * C++: method should be final but cannot perform UTs if so...
+     *
+     * @param cardSelectionRequests A list of selection cases composed of one or more {@link
+     *        CardSelectionRequestSpi}.
+     * @param multiSelectionProcessing The multi selection policy.
+     * @param channelControl The channel control policy.
+     * @return The responses (an empty list if no response was received) or the failure.
+     * @since 2.0.0
+     */
+    virtual TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+        tryTransmitCardSelectionRequests(
+            const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
+            const MultiSelectionProcessing multiSelectionProcessing,
+            const ChannelControl channelControl);
+
     /**
      * (package-private)<br>
      * Check if the reader status is "registered".
@@ -124,6 +150,8 @@ public:
      * (package-private)<br>
      * Changes the reader status to unregistered if is not already unregistered.
      *
+     * <p>The jobs already submitted to the executor of the reader are waited for.
+     *
      * <p>This method may be overridden in order to meet specific needs in certain implementations
      * of readers.
      *
@@ -131,6 +159,29 @@ public:
      */
     virtual void doUnregister();
 
+    /**
+     * (package-private)<br>
+     * Gets the single-thread executor of the reader, created on first use.
+     *
+     * <p>It runs the work done on the reader in the background, such as a selection executed
+     * concurrently on several readers. The card selections and card requests transmitted
+     * afterwards wait for the end of this work, so that the reader is never driven by two threads.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    std::shared_ptr<ExecutorService> getExecutorService();
+
+    /**
+     * (package-private)<br>
+     * Waits until the jobs submitted so far to the executor of the reader are finished.
+     *
+     * <p>Returns immediately if the reader has no executor or if called from one of its jobs.
+     *
+     * @since 2.0.0
+     */
+    void waitForPendingJobs();
+
     /**
      * (package-private)<br>
      * Abstract method performing the actual card selection process.
@@ -151,6 +202,27 @@ public:
         const MultiSelectionProcessing multiSelectionProcessing,
         const ChannelControl channelControl) = 0;
 
+    /**
+     * (package-private)<br>
+     * Same as processCardSelectionRequests(), the communication failures being returned instead
+     * of thrown.
+     *
+     * <p>By default, the exceptions thrown by processCardSelectionRequests() are converted into
+     * failures, readers able to report them without exceptions override this method.
+     *
+     * @param cardSelectionRequests A list of selection cases composed of one or more {@link
+     *     CardSelectionRequestSpi}.
+     * @param multiSelectionProcessing The multi selection policy.
+     * @param channelControl The channel control policy.
+     * @return The responses (an empty list if no response was received) or the failure.
+     * @since 2.0.0
+     */
+    virtual TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+        tryProcessCardSelectionRequests(
+            const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
+            const MultiSelectionProcessing multiSelectionProcessing,
+            const ChannelControl channelControl);
+
     /**
      * (package-private)<br>
      * Abstract method performing the actual transmission of the card request.
@@ -222,6 +294,12 @@ private:
      *
      */
     uint64_t mBefore;
+
+    /**
+     * Executor of the reader, null until first used.
+     */
+    std::mutex mExecutorServiceMutex;
+    std::shared_ptr<ExecutorService> mExecutorService;
 };
 
 }
@@ -24,6 +24,11 @@ const int ApduRequestAdapter::DEFAULT_SUCCESSFUL_CODE = 0x9000;
 ApduRequestAdapter::ApduRequestAdapter(const std::vector<uint8_t>& apdu)
 : mApdu(apdu), mSuccessfulStatusWords({DEFAULT_SUCCESSFUL_CODE}) {}
 
+ApduRequestAdapter::ApduRequestAdapter(const std::vector<uint8_t>& apdu,
+                                       const std::vector<int>& successfulStatusWords,
+                                       const std::string& info)
+: mApdu(apdu), mSuccessfulStatusWords(successfulStatusWords), mInfo(info) {}
+
 ApduRequestAdapter& ApduRequestAdapter::addSuccessfulStatusWord(const int successfulStatusWord)
 {
     mSuccessfulStatusWords.push_back(successfulStatusWord);
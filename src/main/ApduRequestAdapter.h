@@ -45,6 +45,19 @@ public:
      */
     ApduRequestAdapter(const std::vector<uint8_t>& apdu);
 
+    /**
+     * Builds an APDU request with all its properties, used when a serialized card request is
+     * restored.
+     *
+     * @param apdu An array of at least 4 bytes.
+     * @param successfulStatusWords The status words considered successful for the APDU.
+     * @param info The request information (free text).
+     * @since 2.0.0
+     */
+    ApduRequestAdapter(const std::vector<uint8_t>& apdu,
+                       const std::vector<int>& successfulStatusWords,
+                       const std::string& info);
+
     /**
      * Adds a status word to the list of those that should be considered successful for the APDU.
      *
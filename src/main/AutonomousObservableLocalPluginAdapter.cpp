@@ -71,7 +71,8 @@ void AutonomousObservableLocalPluginAdapter::onReaderDisconnected(
         } else {
             /* Unregister and remove reader */
             std::dynamic_pointer_cast<LocalReaderAdapter>(reader)->doUnregister();
-            getReadersMap().erase(reader->getName());
+            removeReaderFromMap(reader->getName());
+            mReaderDisconnectedCounter->increment();
             mLogger->trace("[%] ObservableLocalPlugin => Remove reader '%' from readers list\n",
                            getName(),
                            reader->getName());
@@ -90,7 +91,8 @@ void AutonomousObservableLocalPluginAdapter::addReader(std::shared_ptr<ReaderSpi
 {
     std::shared_ptr<LocalReaderAdapter> reader = buildLocalReaderAdapter(readerSpi);
     reader->doRegister();
-    getReadersMap().insert({reader->getName(), reader});
+    addReaderToMap(reader);
+    mReaderConnectedCounter->increment();
 
     mLogger->trace("[%] ObservableLocalPlugin => Add reader '%' to readers list\n",
                    getName(),
@@ -15,9 +15,6 @@
 /* Keyple Core Util */
 #include "InterruptedException.h"
 
-/* Keyple Core Service */
-#include "Thread.h"
-
 namespace keyple {
 namespace core {
 namespace service {
@@ -68,8 +65,8 @@ void CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob::
                                     mRetries);
 
             try {
-                /* Wait a bit */
-                Thread::sleep(mParent->mCycleDurationMillis);
+                /* Wait a bit, backing off while the state remains unchanged */
+                mParent->waitForNextPoll(mRetries, mParent->mLoop);
             } catch (const InterruptedException& ignored) {
                 (void)ignored;
                 /* Restore interrupted state... */
@@ -93,11 +90,8 @@ void CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJob::
 /* CARD INSERTION ACTIVE MONITORING JOB ADAPTER ------------------------------------------------- */
 
 CardInsertionActiveMonitoringJobAdapter::CardInsertionActiveMonitoringJobAdapter(
-  ObservableLocalReaderAdapter* reader,
-  const long cycleDurationMillis,
-  const bool monitorInsertion)
+  ObservableLocalReaderAdapter* reader, const bool monitorInsertion)
 : AbstractMonitoringJobAdapter(reader),
-  mCycleDurationMillis(cycleDurationMillis),
   mMonitorInsertion(monitorInsertion),
   mReader(reader) {}
 
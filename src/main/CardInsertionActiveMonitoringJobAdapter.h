@@ -49,13 +49,14 @@ public:
      *
      * /!\ C++: cannot use a shared_ptr for reader as this is called from constructors
      *
+     * <p>The time interval between two presence polls is given by the polling policy of the
+     * reader.
+     *
      * @param reader reader that will be polled with the method isCardPresent()
-     * @param cycleDurationMillis time interval between two presence polls.
      * @param monitorInsertion if true, polls for CARD_INSERTED, else CARD_REMOVED
      * @since 2.0.0
      */
     CardInsertionActiveMonitoringJobAdapter(ObservableLocalReaderAdapter* reader,
-                                            const long cycleDurationMillis,
                                             const bool monitorInsertion);
 
     /**
@@ -83,11 +84,6 @@ private:
     const std::unique_ptr<Logger> mLogger =
         LoggerFactory::getLogger(typeid(CardInsertionActiveMonitoringJobAdapter));
 
-    /**
-     *
-     */
-    const long mCycleDurationMillis;
-
     /**
      *
      */
@@ -66,9 +66,7 @@ void CardInsertionPassiveMonitoringJobAdapter::CardInsertionPassiveMonitoringJob
 CardInsertionPassiveMonitoringJobAdapter::CardInsertionPassiveMonitoringJobAdapter(
   ObservableLocalReaderAdapter* reader)
 : AbstractMonitoringJobAdapter(reader),
-  mReaderSpi(
-      std::dynamic_pointer_cast<WaitForCardInsertionBlockingSpi>(reader->getObservableReaderSpi()))
-{}
+  mReaderSpi(reader->getCapabilities().getWaitForCardInsertionBlockingSpi()) {}
 
 std::shared_ptr<Job> CardInsertionPassiveMonitoringJobAdapter::getMonitoringJob(
     std::shared_ptr<AbstractObservableStateAdapter> monitoringState)
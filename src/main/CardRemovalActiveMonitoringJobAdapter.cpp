@@ -22,7 +22,6 @@
 
 /* Keyple Core Service */
 #include "ObservableLocalReaderAdapter.h"
-#include "Thread.h"
 
 namespace keyple {
 namespace core {
@@ -46,15 +45,17 @@ CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob
 void CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob::execute()
 {
     try {
-        mParent->mLogger->debug("[%] Polling from isCardPresentPing\n",
+        mParent->mLogger->debug("[%] Polling from probeCardPresence\n",
                                 mParent->getReader()->getName());
 
         /* Re-init loop value to true */
         mParent->mLoop = true;
 
         while (mParent->mLoop) {
-            if (!mParent->getReader()->isCardPresentPing()) {
-                mParent->mLogger->debug("[%] the card stopped responding\n",
+            /* A failed probe is notified by the reader, the card is then assumed present */
+            if (mParent->getReader()->probeCardPresence() ==
+                    CardPresenceProbeSpi::Result::CARD_ABSENT) {
+                mParent->mLogger->debug("[%] the card is absent\n",
                                         mParent->getReader()->getName());
                 mMonitoringState->onEvent(InternalEvent::CARD_REMOVED);
                 return;
@@ -67,8 +68,8 @@ void CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob::exec
                                     mRetries);
 
             try {
-                /* Wait a bit */
-                Thread::sleep(mParent->mCycleDurationMillis);
+                /* Wait a bit, backing off while the state remains unchanged */
+                mParent->waitForNextPoll(mRetries, mParent->mLoop);
             } catch (const InterruptedException& ignored) {
                 (void)ignored;
                 /* Restore interrupted state... */
@@ -90,11 +91,9 @@ void CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJob::exec
 /* CARD REMOVAL ACTIVE MONITORING JOB ADAPTER --------------------------------------------------- */
 
 CardRemovalActiveMonitoringJobAdapter::CardRemovalActiveMonitoringJobAdapter(
-  ObservableLocalReaderAdapter* reader, const long cycleDurationMillis)
+  ObservableLocalReaderAdapter* reader)
 : AbstractMonitoringJobAdapter(reader),
-  mReaderSpi(
-      std::dynamic_pointer_cast<WaitForCardRemovalBlockingSpi>(reader->getObservableReaderSpi())),
-  mCycleDurationMillis(cycleDurationMillis) {}
+  mReaderSpi(reader->getCapabilities().getWaitForCardRemovalBlockingSpi()) {}
 
 std::shared_ptr<Job> CardRemovalActiveMonitoringJobAdapter::getMonitoringJob(
     std::shared_ptr<AbstractObservableStateAdapter> monitoringState)
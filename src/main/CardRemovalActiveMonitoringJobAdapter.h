@@ -36,18 +36,19 @@ using namespace keyple::core::util::cpp;
 
 /**
  * (package-private)<br>
- * Ping the card to detect removal thanks to the method {@link
- * ObservableLocalReaderAdapter#isCardPresentPing()}.
+ * Probes the card to detect removal thanks to the method {@link
+ * ObservableLocalReaderAdapter#probeCardPresence()}.
  *
  * <p>This method is invoked in another thread.
  *
  * <p>This job should be used by readers who do not have the ability to natively detect the
  * disappearance of the card at the end of the transaction.
  *
- * <p>It is based on sending a neutral APDU command as long as the card is responding, an internal
- * CARD_REMOVED event is fired when the card is no longer responding.
+ * <p>It is based on probing the presence of the card with the presence probe strategy of the
+ * reader (driver-level probe, checkCardPresence() or neutral APDU command) as long as the card is
+ * present, an internal CARD_REMOVED event is fired when the card is absent.
  *
- * <p>By default a delay of 200 ms is inserted between each APDU sending .
+ * <p>The delay inserted between each probe is given by the polling policy of the reader.
  *
  * <p>All runtime exceptions that may occur during the monitoring process are caught and notified at
  * the application level through the appropriate exception handler.
@@ -58,16 +59,16 @@ class CardRemovalActiveMonitoringJobAdapter final : public AbstractMonitoringJob
 public:
     /**
      * (package-private)<br>
-     * Create a job monitor job that ping the card with the method isCardPresentPing()
+     * Create a job monitor job that probes the card with the method probeCardPresence()
      *
      * /!\ C++: cannot use a shared_ptr for reader as this is called from constructors
      *
+     * <p>The delay between each probe is given by the polling policy of the reader.
+     *
      * @param reader reference to the reader
-     * @param cycleDurationMillis delay between between each APDU sending
      * @since 2.0.0
      */
-    CardRemovalActiveMonitoringJobAdapter(ObservableLocalReaderAdapter* reader,
-                                          const long cycleDurationMillis);
+    CardRemovalActiveMonitoringJobAdapter(ObservableLocalReaderAdapter* reader);
 
     /**
      * (package-private)<br>
@@ -99,11 +100,6 @@ private:
      */
     std::shared_ptr<WaitForCardRemovalBlockingSpi> mReaderSpi;
 
-    /**
-     *
-     */
-    const long mCycleDurationMillis;
-
     /**
      *
      */
@@ -140,7 +136,7 @@ private:
         /**
          *
          */
-        long mRetries;
+        long mRetries = 0;
     };
 };
 
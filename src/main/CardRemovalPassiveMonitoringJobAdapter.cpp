@@ -80,17 +80,14 @@ CardRemovalPassiveMonitoringJobAdapter::CardRemovalPassiveMonitoringJobAdapter(
   ObservableLocalReaderAdapter* reader)
 : AbstractMonitoringJobAdapter(reader)
 {
-    const auto waitForCardRemovalBlockingSpi =
-        std::dynamic_pointer_cast<WaitForCardRemovalBlockingSpi>(reader->getObservableReaderSpi());
+    const ReaderCapabilities& capabilities = reader->getCapabilities();
 
-    if (waitForCardRemovalBlockingSpi) {
-        mReaderSpi = waitForCardRemovalBlockingSpi;
+    if (capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_REMOVAL_BLOCKING)) {
+        mReaderSpi = capabilities.getWaitForCardRemovalBlockingSpi();
         mReaderProcessingSpi = nullptr;
     } else {
         mReaderSpi = nullptr;
-        mReaderProcessingSpi =
-            std::dynamic_pointer_cast<WaitForCardRemovalDuringProcessingBlockingSpi>(
-                reader->getObservableReaderSpi());
+        mReaderProcessingSpi = capabilities.getWaitForCardRemovalDuringProcessingBlockingSpi();
     }
 }
 
@@ -0,0 +1,77 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+/* Calypsonet Terminal Card */
+#include "ApduRequestSpi.h"
+#include "CardRequestSpi.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace calypsonet::terminal::card::spi;
+
+/**
+ * (package-private)<br>
+ * Immutable implementation of {@link CardRequestSpi}, used when a serialized card request is
+ * restored.
+ *
+ * @since 2.0.0
+ */
+class CardRequestAdapter final : public CardRequestSpi {
+public:
+    /**
+     * (package-private)<br>
+     * Constructor.
+     *
+     * @param apduRequests The APDU requests.
+     * @param stopOnUnsuccessfulStatusWord True if the processing must stop on the first
+     *        unsuccessful status word.
+     * @since 2.0.0
+     */
+    CardRequestAdapter(const std::vector<std::shared_ptr<ApduRequestSpi>>& apduRequests,
+                       const bool stopOnUnsuccessfulStatusWord);
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    const std::vector<std::shared_ptr<ApduRequestSpi>>& getApduRequests() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    bool stopOnUnsuccessfulStatusWord() const override;
+
+private:
+    /**
+     *
+     */
+    const std::vector<std::shared_ptr<ApduRequestSpi>> mApduRequests;
+
+    /**
+     *
+     */
+    const bool mStopOnUnsuccessfulStatusWord;
+};
+
+}
+}
+}
@@ -15,20 +15,7 @@
 /* Keyple Core Util */
 #include "KeypleAssert.h"
 
-/* Calypsonet Terminal Card */
-#include "CardBrokenCommunicationException.h"
-#include "CardSelectionResponseApi.h"
-#include "ParseException.h"
-#include "ReaderBrokenCommunicationException.h"
-
-/* Calypsonet Terminal Reader */
-#include "InvalidCardResponseException.h"
-#include "ReaderCommunicationException.h"
-
 /* Keyple Core Service */
-#include "AbstractReaderAdapter.h"
-#include "CardCommunicationException.h"
-#include "CardSelectionResultAdapter.h"
 #include "CardSelectionScenarioAdapter.h"
 #include "ObservableLocalReaderAdapter.h"
 #include "ScheduledCardSelectionsResponseAdapter.h"
@@ -45,7 +32,8 @@ using namespace keyple::core::util;
 
 CardSelectionManagerAdapter::CardSelectionManagerAdapter()
 : mMultiSelectionProcessing(MultiSelectionProcessing::FIRST_MATCH),
-  mChannelControl(ChannelControl::KEEP_OPEN) {}
+  mChannelControl(ChannelControl::KEEP_OPEN),
+  mParsingThreadCount(1) {}
 
 void CardSelectionManagerAdapter::setMultipleSelectionMode()
 {
@@ -72,36 +60,71 @@ void CardSelectionManagerAdapter::prepareReleaseChannel()
     mChannelControl = ChannelControl::CLOSE_AFTER;
 }
 
+void CardSelectionManagerAdapter::setParallelParsing(const int threadCount)
+{
+    Assert::getInstance().greaterOrEqual(threadCount, 1, "threadCount");
+
+    mParsingThreadCount = threadCount;
+}
+
 const std::shared_ptr<CardSelectionResult>
     CardSelectionManagerAdapter::processCardSelectionScenario(std::shared_ptr<CardReader> reader)
 {
-        Assert::getInstance().notNull(reader, "reader");
-
-        /* Communicate with the card to make the actual selection */
-        std::vector<std::shared_ptr<CardSelectionResponseApi>> cardSelectionResponses;
-
-        try {
-            cardSelectionResponses =
-                std::dynamic_pointer_cast<AbstractReaderAdapter>(reader)
-                    ->transmitCardSelectionRequests(mCardSelectionRequests,
-                                                    mMultiSelectionProcessing,
-                                                    mChannelControl);
-        } catch (const ReaderBrokenCommunicationException& e) {
-            throw ReaderCommunicationException(
-                e.getMessage(), std::make_shared<ReaderBrokenCommunicationException>(e));
-        } catch (const CardBrokenCommunicationException& e) {
-            throw CardCommunicationException(e.getMessage(),
-                                             std::make_shared<CardBrokenCommunicationException>(e));
-        }
-
-        /* Clear the selection requests list */
-        mCardSelectionRequests.clear();
-
-        /* Analyze the received responses */
-        return processCardSelectionResponses(cardSelectionResponses);
-    }
+    Assert::getInstance().notNull(reader, "reader");
+
+    const std::shared_ptr<CardSelectionResult> cardSelectionResult =
+        buildCardSelectionScenario(false)->processCardSelectionScenario(reader);
+
+    /* Clear the selection requests list */
+    mCardSelectionRequests.clear();
 
-    void CardSelectionManagerAdapter::scheduleCardSelectionScenario(
+    return cardSelectionResult;
+}
+
+const std::map<std::string, std::shared_ptr<CardSelectionResult>>
+    CardSelectionManagerAdapter::processCardSelectionScenario(
+        const std::vector<std::shared_ptr<CardReader>>& readers)
+{
+    const std::map<std::string, std::shared_ptr<CardSelectionResult>> cardSelectionResults =
+        compileCardSelectionScenario()->processCardSelectionScenario(readers);
+
+    /* Clear the selection requests list */
+    mCardSelectionRequests.clear();
+
+    return cardSelectionResults;
+}
+
+const std::map<std::string, std::shared_ptr<CardSelectionResult>>
+    CardSelectionManagerAdapter::processCardSelectionScenarioUntilFirstMatch(
+        const std::vector<std::shared_ptr<CardReader>>& readers)
+{
+    const std::map<std::string, std::shared_ptr<CardSelectionResult>> cardSelectionResults =
+        compileCardSelectionScenario()->processCardSelectionScenarioUntilFirstMatch(readers);
+
+    /* Clear the selection requests list */
+    mCardSelectionRequests.clear();
+
+    return cardSelectionResults;
+}
+
+const std::shared_ptr<CompiledCardSelectionScenario>
+    CardSelectionManagerAdapter::compileCardSelectionScenario() const
+{
+    return buildCardSelectionScenario(true);
+}
+
+const std::shared_ptr<CompiledCardSelectionScenario>
+    CardSelectionManagerAdapter::buildCardSelectionScenario(const bool compileCardSelectors) const
+{
+    return std::make_shared<CompiledCardSelectionScenario>(mCardSelections,
+                                                           mCardSelectionRequests,
+                                                           mMultiSelectionProcessing,
+                                                           mChannelControl,
+                                                           mParsingThreadCount,
+                                                           compileCardSelectors);
+}
+
+void CardSelectionManagerAdapter::scheduleCardSelectionScenario(
         std::shared_ptr<ObservableCardReader> observableCardReader,
         const DetectionMode detectionMode,
         const NotificationMode notificationMode)
@@ -109,10 +132,8 @@ const std::shared_ptr<CardSelectionResult>
 
     Assert::getInstance().notNull(observableCardReader, "observableCardReader");
 
-    auto cardSelectionScenario =
-        std::make_shared<CardSelectionScenarioAdapter>(mCardSelectionRequests,
-                                                        mMultiSelectionProcessing,
-                                                        mChannelControl);
+    /* The selectors are compiled once for all the cards presented to the reader */
+    const auto cardSelectionScenario = compileCardSelectionScenario()->getCardSelectionScenario();
 
     auto local = std::dynamic_pointer_cast<ObservableLocalReaderAdapter>(observableCardReader);
 //        auto remote =std::dynamic_pointer_cast<ObservableRemoteReaderAdapter>(observableCardReader);
@@ -138,42 +159,11 @@ const std::shared_ptr<CardSelectionResult>
     Assert::getInstance().notNull(scheduledCardSelectionsResponse,
                                   "scheduledCardSelectionsResponse");
 
-    return processCardSelectionResponses(
+    return CompiledCardSelectionScenario::processCardSelectionResponses(
+        mCardSelections,
         std::static_pointer_cast<ScheduledCardSelectionsResponseAdapter>(scheduledCardSelectionsResponse)
-            ->getCardSelectionResponses());
-}
-
-const std::shared_ptr<CardSelectionResult>
-    CardSelectionManagerAdapter::processCardSelectionResponses(
-        const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponses) const
-{
-    Assert::getInstance().notEmpty(cardSelectionResponses, "cardSelectionResponses");
-
-    auto cardSelectionsResult = std::make_shared<CardSelectionResultAdapter>();
-
-    int index = 0;
-
-    /* Check card responses */
-    for (const auto& cardSelectionResponse : cardSelectionResponses) {
-        if (cardSelectionResponse->hasMatched()) {
-            /* Invoke the parse method defined by the card extension to retrieve the smart card */
-            std::shared_ptr<SmartCard> smartCard = nullptr;
-            try {
-                smartCard = std::dynamic_pointer_cast<SmartCard>(
-                                mCardSelections[index]->parse(cardSelectionResponse));
-            } catch (const ParseException& e) {
-                throw InvalidCardResponseException(
-                          "Error occurred while parsing the card response: " + e.getMessage(),
-                          std::make_shared<ParseException>(e));
-            }
-
-            cardSelectionsResult->addSmartCard(index, smartCard);
-        }
-
-        index++;
-    }
-
-    return cardSelectionsResult;
+            ->getCardSelectionResponses(),
+        mParsingThreadCount);
 }
 
 }
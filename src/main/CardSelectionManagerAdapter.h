@@ -12,6 +12,11 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 /* Calypsonet Terminal Reader */
 #include "CardSelectionManager.h"
 #include "ObservableCardReader.h"
@@ -21,6 +26,7 @@
 #include "ChannelControl.h"
 
 /* Keple Core Service */
+#include "CompiledCardSelectionScenario.h"
 #include "MultiSelectionProcessing.h"
 
 namespace keyple {
@@ -72,14 +78,94 @@ public:
      */
     virtual void prepareReleaseChannel() override final;
 
+    /**
+     * Allows the matching card responses of a multiple selection scenario (see
+     * {@link #setMultipleSelectionMode()}) to be parsed concurrently by the card extensions.
+     *
+     * <p>The result is the same as with a sequential parsing, the smart cards being kept in the
+     * order of the selection indexes. The card extensions must support concurrent invocations of
+     * CardSelectionSpi::parse.
+     *
+     * <p>The threads are taken from a pool shared by the service and bounded by the hardware
+     * concurrency. Parsing in parallel pays off only when the card extensions parse slowly (see
+     * CardSelectionManagerAdapterBench).
+     *
+     * @param threadCount The maximum number of threads parsing the responses, 1 (default) to
+     *        parse them sequentially.
+     * @throw IllegalArgumentException If the thread count is less than 1.
+     * @since 2.0.0
+     */
+    void setParallelParsing(const int threadCount);
+
     /**
      * {@inheritDoc}
      *
+     * <p>The scenario is executed once, its card selectors are not compiled since they are not
+     * reused.
+     *
      * @since 2.0.0
      */
     virtual const std::shared_ptr<CardSelectionResult> processCardSelectionScenario(
         std::shared_ptr<CardReader> reader) override final;
 
+    /**
+     * Explicitly executes the prepared card selection scenario concurrently on several readers and
+     * returns the result obtained on each of them.
+     *
+     * <p>The duration of the call is that of the slowest reader. The prepared selections are
+     * cleared as with {@link #processCardSelectionScenario(std::shared_ptr<CardReader>)}.
+     *
+     * @param readers The readers to communicate with the cards, each one present only once.
+     * @return A map of the results by reader name, one for each reader.
+     * @throw IllegalArgumentException If the list is empty, contains a reader twice or a reader
+     *        which is null or not a Keyple reader.
+     * @throw ReaderCommunicationException If the communication with a reader has failed.
+     * @throw CardCommunicationException If the communication with a card has failed.
+     * @throw InvalidCardResponseException If a card response could not be parsed.
+     * @since 2.0.0
+     */
+    const std::map<std::string, std::shared_ptr<CardSelectionResult>>
+        processCardSelectionScenario(const std::vector<std::shared_ptr<CardReader>>& readers);
+
+    /**
+     * Explicitly executes the prepared card selection scenario concurrently on several readers and
+     * returns as soon as a card has been selected on one of them, the scenario being no longer
+     * started on the other readers.
+     *
+     * <p>The prepared selections are cleared as with
+     * {@link #processCardSelectionScenario(std::shared_ptr<CardReader>)}.
+     *
+     * @param readers The readers to communicate with the cards, each one present only once.
+     * @return A map containing the result of the first reader on which a card has been selected,
+     *         empty if none.
+     * @throw IllegalArgumentException If the list is empty, contains a reader twice or a reader
+     *        which is null or not a Keyple reader.
+     * @throw ReaderCommunicationException If the communication with a reader has failed and no
+     *        card has been selected.
+     * @throw CardCommunicationException If the communication with a card has failed and no card
+     *        has been selected.
+     * @throw InvalidCardResponseException If a card response could not be parsed and no card has
+     *        been selected.
+     * @since 2.0.0
+     */
+    const std::map<std::string, std::shared_ptr<CardSelectionResult>>
+        processCardSelectionScenarioUntilFirstMatch(
+            const std::vector<std::shared_ptr<CardReader>>& readers);
+
+    /**
+     * Compiles the card selection scenario prepared so far into an immutable object which can be
+     * executed repeatedly, and concurrently on several readers, without preparing the selections
+     * again.
+     *
+     * <p>Unlike {@link #processCardSelectionScenario(std::shared_ptr<CardReader>)}, the prepared
+     * selections are kept in the manager.
+     *
+     * @return A not null reference.
+     * @throw IllegalArgumentException If no selection has been prepared.
+     * @since 2.0.0
+     */
+    const std::shared_ptr<CompiledCardSelectionScenario> compileCardSelectionScenario() const;
+
     /**
      * {@inheritDoc}
      *
@@ -120,17 +206,22 @@ private:
      */
     ChannelControl mChannelControl;
 
+    /**
+     * Maximum number of threads parsing the matching card responses.
+     */
+    int mParsingThreadCount;
+
     /**
      * (private)<br>
-     * Analyzes the responses received in return of the execution of a card selection scenario and
-     * returns the CardSelectionResult.
+     * Builds the scenario prepared so far.
      *
-     * @param cardSelectionResponses The card selection responses.
+     * @param compileCardSelectors True if the scenario is reused and its card selectors must be
+     *        compiled, false if it is executed only once.
      * @return A not null reference.
-     * @throw IllegalArgumentException If the list is null or empty.
+     * @throw IllegalArgumentException If no selection has been prepared.
      */
-    const std::shared_ptr<CardSelectionResult> processCardSelectionResponses(
-        const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponses) const;
+    const std::shared_ptr<CompiledCardSelectionScenario> buildCardSelectionScenario(
+        const bool compileCardSelectors) const;
 };
 
 }
@@ -14,19 +14,42 @@
 
 /* Keyple Core Util */
 #include "IllegalStateException.h"
+#include "KeypleAssert.h"
 
 namespace keyple {
 namespace core {
 namespace service {
 
+using namespace keyple::core::util;
 using namespace keyple::core::util::cpp::exception;
 
-CardSelectionResultAdapter::CardSelectionResultAdapter() : mActiveSelectionIndex(-1) {}
+CardSelectionResultAdapter::CardSelectionResultAdapter() : CardSelectionResultAdapter(0) {}
+
+CardSelectionResultAdapter::CardSelectionResultAdapter(const size_t selectionCount)
+: mActiveSelectionIndex(-1),
+  mSmartCards(selectionCount),
+  mIsPresent(selectionCount, false),
+  mIsSmartCardMapUpToDate(false) {}
 
 void CardSelectionResultAdapter::addSmartCard(const int selectionIndex,
                                               std::shared_ptr<SmartCard> smartCard)
 {
-    mSmartCardMap.insert({selectionIndex, smartCard});
+    Assert::getInstance().greaterOrEqual(selectionIndex, 0, "selectionIndex");
+
+    const size_t index = static_cast<size_t>(selectionIndex);
+
+    if (index >= mSmartCards.size()) {
+        mSmartCards.resize(index + 1);
+        mIsPresent.resize(index + 1, false);
+    }
+
+    if (!mIsPresent[index]) {
+        mSmartCards[index] = smartCard;
+        mIsPresent[index] = true;
+
+        std::lock_guard<std::mutex> lock(mSmartCardMapMutex);
+        mIsSmartCardMapUpToDate = false;
+    }
 
     /* Keep the current selection index */
     mActiveSelectionIndex = selectionIndex;
@@ -34,17 +57,34 @@ void CardSelectionResultAdapter::addSmartCard(const int selectionIndex,
 
 const std::map<int, std::shared_ptr<SmartCard>>& CardSelectionResultAdapter::getSmartCards() const
 {
+    /*
+     * The map is only ever completed, never cleared: a smart card is never replaced, and a
+     * reference previously returned remains valid. The completion is guarded, the result may be
+     * read by several threads.
+     */
+    std::lock_guard<std::mutex> lock(mSmartCardMapMutex);
+
+    if (!mIsSmartCardMapUpToDate) {
+        for (size_t i = 0; i < mSmartCards.size(); i++) {
+            if (mIsPresent[i]) {
+                mSmartCardMap.insert({static_cast<int>(i), mSmartCards[i]});
+            }
+        }
+
+        mIsSmartCardMapUpToDate = true;
+    }
+
     return mSmartCardMap;
 }
 
 const std::shared_ptr<SmartCard> CardSelectionResultAdapter::getActiveSmartCard() const
 {
-    const auto& it = mSmartCardMap.find(mActiveSelectionIndex);
-    if (it == mSmartCardMap.end()) {
+    if (mActiveSelectionIndex < 0 ||
+        !mIsPresent[static_cast<size_t>(mActiveSelectionIndex)]) {
         throw IllegalStateException("No active matching card is available");
     }
 
-    return it->second;
+    return mSmartCards[static_cast<size_t>(mActiveSelectionIndex)];
 }
 
 int CardSelectionResultAdapter::getActiveSelectionIndex() const
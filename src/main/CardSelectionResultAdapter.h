@@ -14,6 +14,8 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 /* Calypsonet Terminal Reader */
 #include "CardSelectionResult.h"
@@ -30,6 +32,9 @@ using namespace calypsonet::terminal::reader::selection::spi;
  * (package-private)<br>
  * Implementation of {@link CardSelectionResult}.
  *
+ * <p>The smart cards are stored in a flat list addressed by selection index, along with a presence
+ * bitmap. The map returned by {@link #getSmartCards()} is only built when requested.
+ *
  * @since 2.0.0
  */
 class CardSelectionResultAdapter final : public CardSelectionResult {
@@ -42,12 +47,25 @@ public:
      */
     CardSelectionResultAdapter();
 
+    /**
+     * (package-private)<br>
+     * Constructor sizing the storage for the given number of selections.
+     *
+     * @param selectionCount The number of selections of the scenario.
+     * @since 2.0.0
+     */
+    explicit CardSelectionResultAdapter(const size_t selectionCount);
+
     /**
      * (package-private)<br>
      * Append a {@link SmartCard} to the internal list
      *
+     * <p>The storage grows if the index is beyond the expected number of selections. A smart card
+     * already present at this index is kept.
+     *
      * @param selectionIndex The index of the selection that resulted in the smart card.
      * @param smartCard The smart card.
+     * @throw IllegalArgumentException If the index is negative.
      * @since 2.0.0
      */
     void addSmartCard(const int selectionIndex, std::shared_ptr<SmartCard> smartCard);
@@ -55,6 +73,10 @@ public:
     /**
      * {@inheritDoc}
      *
+     * <p>The map is completed on the first call following the addition of a smart card, the
+     * returned reference remains valid for the lifetime of the result. Concurrent calls are
+     * supported.
+     *
      * @since 2.0.0
      */
     virtual const std::map<int, std::shared_ptr<SmartCard>>& getSmartCards() const override;
@@ -80,9 +102,17 @@ private:
     int mActiveSelectionIndex;
 
     /**
-     *
+     * Smart cards by selection index, meaningful only where the presence bit is set.
+     */
+    std::vector<std::shared_ptr<SmartCard>> mSmartCards;
+    std::vector<bool> mIsPresent;
+
+    /**
+     * Map view of the smart cards, completed on demand under the mutex.
      */
-    std::map<int, std::shared_ptr<SmartCard>> mSmartCardMap;
+    mutable std::mutex mSmartCardMapMutex;
+    mutable std::map<int, std::shared_ptr<SmartCard>> mSmartCardMap;
+    mutable bool mIsSmartCardMapUpToDate;
 };
 
 }
@@ -0,0 +1,747 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "CardSelectionSerializer.h"
+
+#include <algorithm>
+#include <regex>
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+/* Keyple Core Service */
+#include "ApduRequestAdapter.h"
+#include "ApduResponseAdapter.h"
+#include "CardRequestAdapter.h"
+#include "CardSelectionResponseAdapter.h"
+#include "CompiledCardSelectionRequest.h"
+#include "CompiledCardSelector.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util::cpp::exception;
+
+/* Header: magic (3 bytes), version, kind, reserved (3 bytes) */
+static const uint8_t MAGIC[] = {'K', 'S', 'B'};
+static const size_t HEADER_LENGTH = 8;
+static const size_t VERSION_POSITION = 3;
+static const size_t KIND_POSITION = 4;
+
+const uint8_t CardSelectionSerializer::FORMAT_VERSION = 1;
+
+/* WRITER ************************************************************************************** */
+
+CardSelectionSerializer::Writer::Writer(const Kind kind)
+{
+    mBuffer.reserve(256);
+    mBuffer.insert(mBuffer.end(), MAGIC, MAGIC + sizeof(MAGIC));
+    mBuffer.push_back(FORMAT_VERSION);
+    mBuffer.push_back(static_cast<uint8_t>(kind));
+    mBuffer.insert(mBuffer.end(), HEADER_LENGTH - mBuffer.size(), 0);
+}
+
+void CardSelectionSerializer::Writer::writeByte(const uint8_t value)
+{
+    mBuffer.push_back(value);
+}
+
+void CardSelectionSerializer::Writer::writeShort(const uint16_t value)
+{
+    mBuffer.push_back(static_cast<uint8_t>(value));
+    mBuffer.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void CardSelectionSerializer::Writer::writeInt(const uint32_t value)
+{
+    mBuffer.push_back(static_cast<uint8_t>(value));
+    mBuffer.push_back(static_cast<uint8_t>(value >> 8));
+    mBuffer.push_back(static_cast<uint8_t>(value >> 16));
+    mBuffer.push_back(static_cast<uint8_t>(value >> 24));
+}
+
+void CardSelectionSerializer::Writer::writeBytes(const std::vector<uint8_t>& value)
+{
+    writeInt(static_cast<uint32_t>(value.size()));
+    mBuffer.insert(mBuffer.end(), value.begin(), value.end());
+}
+
+void CardSelectionSerializer::Writer::writeString(const std::string& value)
+{
+    writeInt(static_cast<uint32_t>(value.size()));
+    mBuffer.insert(mBuffer.end(), value.begin(), value.end());
+}
+
+size_t CardSelectionSerializer::Writer::reserveOffset()
+{
+    const size_t position = mBuffer.size();
+    writeInt(0);
+
+    return position;
+}
+
+void CardSelectionSerializer::Writer::patchOffset(const size_t position)
+{
+    const uint32_t offset = static_cast<uint32_t>(mBuffer.size());
+
+    mBuffer[position] = static_cast<uint8_t>(offset);
+    mBuffer[position + 1] = static_cast<uint8_t>(offset >> 8);
+    mBuffer[position + 2] = static_cast<uint8_t>(offset >> 16);
+    mBuffer[position + 3] = static_cast<uint8_t>(offset >> 24);
+}
+
+std::vector<uint8_t>& CardSelectionSerializer::Writer::getBuffer()
+{
+    return mBuffer;
+}
+
+/* READER ************************************************************************************** */
+
+CardSelectionSerializer::Reader::Reader(const std::vector<uint8_t>& buffer, const Kind kind)
+: mBuffer(buffer)
+{
+    if (buffer.size() < HEADER_LENGTH ||
+        !std::equal(MAGIC, MAGIC + sizeof(MAGIC), buffer.begin())) {
+        throw IllegalArgumentException("Not a serialized card selection object.");
+    }
+
+    if (buffer[VERSION_POSITION] != FORMAT_VERSION) {
+        throw IllegalArgumentException("Unsupported serialization format version: " +
+                                       std::to_string(buffer[VERSION_POSITION]) + ".");
+    }
+
+    if (buffer[KIND_POSITION] != static_cast<uint8_t>(kind)) {
+        throw IllegalArgumentException("Unexpected serialized object kind: " +
+                                       std::to_string(buffer[KIND_POSITION]) + ".");
+    }
+}
+
+size_t CardSelectionSerializer::Reader::getRootPosition() const
+{
+    return HEADER_LENGTH;
+}
+
+void CardSelectionSerializer::Reader::checkAvailable(const size_t position,
+                                                     const size_t length) const
+{
+    if (position > mBuffer.size() || length > mBuffer.size() - position) {
+        throw IllegalArgumentException("Truncated serialized card selection object.");
+    }
+}
+
+uint8_t CardSelectionSerializer::Reader::readByte(size_t& position) const
+{
+    checkAvailable(position, 1);
+
+    return mBuffer[position++];
+}
+
+uint16_t CardSelectionSerializer::Reader::readShort(size_t& position) const
+{
+    checkAvailable(position, 2);
+
+    const uint16_t value = static_cast<uint16_t>(mBuffer[position] | mBuffer[position + 1] << 8);
+    position += 2;
+
+    return value;
+}
+
+uint32_t CardSelectionSerializer::Reader::readInt(size_t& position) const
+{
+    checkAvailable(position, 4);
+
+    const uint32_t value = static_cast<uint32_t>(mBuffer[position]) |
+                           static_cast<uint32_t>(mBuffer[position + 1]) << 8 |
+                           static_cast<uint32_t>(mBuffer[position + 2]) << 16 |
+                           static_cast<uint32_t>(mBuffer[position + 3]) << 24;
+    position += 4;
+
+    return value;
+}
+
+std::vector<uint8_t> CardSelectionSerializer::Reader::readBytes(size_t& position) const
+{
+    const size_t length = readInt(position);
+    checkAvailable(position, length);
+
+    const auto begin = mBuffer.begin() + position;
+    position += length;
+
+    return std::vector<uint8_t>(begin, begin + length);
+}
+
+std::string CardSelectionSerializer::Reader::readString(size_t& position) const
+{
+    const size_t length = readInt(position);
+    checkAvailable(position, length);
+
+    const auto begin = mBuffer.begin() + position;
+    position += length;
+
+    return std::string(begin, begin + length);
+}
+
+CardSelectionSerializer::ByteView CardSelectionSerializer::Reader::readView(
+    size_t& position) const
+{
+    const size_t length = readInt(position);
+    checkAvailable(position, length);
+
+    const ByteView view = {length != 0 ? mBuffer.data() + position : nullptr, length};
+    position += length;
+
+    return view;
+}
+
+size_t CardSelectionSerializer::Reader::readOffset(size_t& position) const
+{
+    const size_t offset = readInt(position);
+
+    if (offset != 0 && (offset < HEADER_LENGTH || offset >= mBuffer.size())) {
+        throw IllegalArgumentException("Invalid offset in serialized card selection object: " +
+                                       std::to_string(offset) + ".");
+    }
+
+    return offset;
+}
+
+size_t CardSelectionSerializer::Reader::readCount(size_t& position) const
+{
+    const size_t count = readInt(position);
+
+    /* Each element has at least a 4 bytes entry, this prevents oversized allocations */
+    checkAvailable(position, count * 4);
+
+    return count;
+}
+
+/* SERIALIZATION ******************************************************************************* */
+
+std::vector<uint8_t> CardSelectionSerializer::serialize(
+    const CardSelectionScenarioAdapter& cardSelectionScenario)
+{
+    Writer writer(Kind::CARD_SELECTION_SCENARIO);
+
+    const auto& cardSelectionRequests = cardSelectionScenario.getCardSelectionRequests();
+
+    writer.writeByte(static_cast<uint8_t>(cardSelectionScenario.getMultiSelectionProcessing()));
+    writer.writeByte(static_cast<uint8_t>(cardSelectionScenario.getChannelControl()));
+    writer.writeInt(static_cast<uint32_t>(cardSelectionRequests.size()));
+
+    std::vector<size_t> offsets;
+    for (size_t i = 0; i < cardSelectionRequests.size(); i++) {
+        offsets.push_back(writer.reserveOffset());
+    }
+
+    for (size_t i = 0; i < cardSelectionRequests.size(); i++) {
+        writer.patchOffset(offsets[i]);
+        writeCardSelectionRequest(writer, *cardSelectionRequests[i]);
+    }
+
+    return std::move(writer.getBuffer());
+}
+
+std::vector<uint8_t> CardSelectionSerializer::serialize(
+    const ScheduledCardSelectionsResponseAdapter& scheduledCardSelectionsResponse)
+{
+    Writer writer(Kind::SCHEDULED_CARD_SELECTIONS_RESPONSE);
+
+    const auto& cardSelectionResponses =
+        scheduledCardSelectionsResponse.getCardSelectionResponses();
+
+    writer.writeInt(static_cast<uint32_t>(cardSelectionResponses.size()));
+
+    std::vector<size_t> offsets;
+    for (size_t i = 0; i < cardSelectionResponses.size(); i++) {
+        offsets.push_back(writer.reserveOffset());
+    }
+
+    for (size_t i = 0; i < cardSelectionResponses.size(); i++) {
+        writer.patchOffset(offsets[i]);
+        writeCardSelectionResponse(writer, *cardSelectionResponses[i]);
+    }
+
+    return std::move(writer.getBuffer());
+}
+
+std::vector<uint8_t> CardSelectionSerializer::serialize(const CardResponseApi& cardResponse)
+{
+    Writer writer(Kind::CARD_RESPONSE);
+
+    writeCardResponse(writer, cardResponse);
+
+    return std::move(writer.getBuffer());
+}
+
+void CardSelectionSerializer::writeCardSelectionRequest(
+    Writer& writer, const CardSelectionRequestSpi& cardSelectionRequest)
+{
+    const std::shared_ptr<CardRequestSpi> cardRequest = cardSelectionRequest.getCardRequest();
+
+    const size_t cardSelectorOffset = writer.reserveOffset();
+    const size_t cardRequestOffset = writer.reserveOffset();
+
+    writer.patchOffset(cardSelectorOffset);
+    writeCardSelector(writer, *cardSelectionRequest.getCardSelector());
+
+    if (cardRequest != nullptr) {
+        writer.patchOffset(cardRequestOffset);
+        writeCardRequest(writer, *cardRequest);
+    }
+}
+
+void CardSelectionSerializer::writeCardSelector(Writer& writer,
+                                                const CardSelectorSpi& cardSelector)
+{
+    writer.writeByte(static_cast<uint8_t>(cardSelector.getFileOccurrence()));
+    writer.writeByte(static_cast<uint8_t>(cardSelector.getFileControlInformation()));
+    writer.writeString(cardSelector.getCardProtocol());
+    writer.writeString(cardSelector.getPowerOnDataRegex());
+    writer.writeBytes(cardSelector.getAid());
+    writeStatusWords(writer, cardSelector.getSuccessfulSelectionStatusWords());
+}
+
+void CardSelectionSerializer::writeCardRequest(Writer& writer, const CardRequestSpi& cardRequest)
+{
+    const auto& apduRequests = cardRequest.getApduRequests();
+
+    writer.writeByte(cardRequest.stopOnUnsuccessfulStatusWord() ? 1 : 0);
+    writer.writeInt(static_cast<uint32_t>(apduRequests.size()));
+
+    std::vector<size_t> offsets;
+    for (size_t i = 0; i < apduRequests.size(); i++) {
+        offsets.push_back(writer.reserveOffset());
+    }
+
+    for (size_t i = 0; i < apduRequests.size(); i++) {
+        writer.patchOffset(offsets[i]);
+        writeApduRequest(writer, *apduRequests[i]);
+    }
+}
+
+void CardSelectionSerializer::writeApduRequest(Writer& writer, const ApduRequestSpi& apduRequest)
+{
+    writer.writeBytes(apduRequest.getApdu());
+    writeStatusWords(writer, apduRequest.getSuccessfulStatusWords());
+    writer.writeString(apduRequest.getInfo());
+}
+
+void CardSelectionSerializer::writeStatusWords(Writer& writer, const std::vector<int>& statusWords)
+{
+    writer.writeInt(static_cast<uint32_t>(statusWords.size()));
+
+    for (const int statusWord : statusWords) {
+        if (statusWord < 0 || statusWord > 0xFFFF) {
+            throw IllegalArgumentException("Invalid status word: " + std::to_string(statusWord) +
+                                           ".");
+        }
+
+        writer.writeShort(static_cast<uint16_t>(statusWord));
+    }
+}
+
+void CardSelectionSerializer::writeCardSelectionResponse(
+    Writer& writer, const CardSelectionResponseApi& cardSelectionResponse)
+{
+    const std::shared_ptr<ApduResponseApi> selectApplicationResponse =
+        cardSelectionResponse.getSelectApplicationResponse();
+    const std::shared_ptr<CardResponseApi> cardResponse = cardSelectionResponse.getCardResponse();
+
+    writer.writeByte(cardSelectionResponse.hasMatched() ? 1 : 0);
+    const size_t selectApplicationResponseOffset = writer.reserveOffset();
+    const size_t cardResponseOffset = writer.reserveOffset();
+    writer.writeString(cardSelectionResponse.getPowerOnData());
+
+    if (selectApplicationResponse != nullptr) {
+        writer.patchOffset(selectApplicationResponseOffset);
+        writeApduResponse(writer, *selectApplicationResponse);
+    }
+
+    if (cardResponse != nullptr) {
+        writer.patchOffset(cardResponseOffset);
+        writeCardResponse(writer, *cardResponse);
+    }
+}
+
+void CardSelectionSerializer::writeCardResponse(Writer& writer, const CardResponseApi& cardResponse)
+{
+    const auto& apduResponses = cardResponse.getApduResponses();
+
+    writer.writeByte(cardResponse.isLogicalChannelOpen() ? 1 : 0);
+    writer.writeInt(static_cast<uint32_t>(apduResponses.size()));
+
+    std::vector<size_t> offsets;
+    for (size_t i = 0; i < apduResponses.size(); i++) {
+        offsets.push_back(writer.reserveOffset());
+    }
+
+    for (size_t i = 0; i < apduResponses.size(); i++) {
+        writer.patchOffset(offsets[i]);
+        writeApduResponse(writer, *apduResponses[i]);
+    }
+}
+
+void CardSelectionSerializer::writeApduResponse(Writer& writer, const ApduResponseApi& apduResponse)
+{
+    writer.writeBytes(apduResponse.getApdu());
+}
+
+/* DESERIALIZATION ***************************************************************************** */
+
+std::shared_ptr<CardSelectionScenarioAdapter>
+    CardSelectionSerializer::deserializeCardSelectionScenario(const std::vector<uint8_t>& buffer)
+{
+    const Reader reader(buffer, Kind::CARD_SELECTION_SCENARIO);
+    size_t position = reader.getRootPosition();
+
+    const uint8_t multiSelectionProcessing = reader.readByte(position);
+    const uint8_t channelControl = reader.readByte(position);
+
+    if (multiSelectionProcessing > static_cast<uint8_t>(MultiSelectionProcessing::PROCESS_ALL) ||
+        channelControl > static_cast<uint8_t>(ChannelControl::CLOSE_AFTER)) {
+        throw IllegalArgumentException("Invalid card selection scenario indicators.");
+    }
+
+    const size_t count = reader.readCount(position);
+
+    std::vector<std::shared_ptr<CardSelectionRequestSpi>> cardSelectionRequests;
+    cardSelectionRequests.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        const size_t offset = reader.readOffset(position);
+        if (offset == 0) {
+            throw IllegalArgumentException("Null card selection request.");
+        }
+
+        cardSelectionRequests.push_back(readCardSelectionRequest(reader, offset));
+    }
+
+    return std::make_shared<CardSelectionScenarioAdapter>(
+               cardSelectionRequests,
+               static_cast<MultiSelectionProcessing>(multiSelectionProcessing),
+               static_cast<ChannelControl>(channelControl));
+}
+
+std::shared_ptr<ScheduledCardSelectionsResponseAdapter>
+    CardSelectionSerializer::deserializeScheduledCardSelectionsResponse(
+        const std::vector<uint8_t>& buffer)
+{
+    const Reader reader(buffer, Kind::SCHEDULED_CARD_SELECTIONS_RESPONSE);
+    size_t position = reader.getRootPosition();
+
+    const size_t count = reader.readCount(position);
+
+    std::vector<std::shared_ptr<CardSelectionResponseApi>> cardSelectionResponses;
+    cardSelectionResponses.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        const size_t offset = reader.readOffset(position);
+        if (offset == 0) {
+            throw IllegalArgumentException("Null card selection response.");
+        }
+
+        cardSelectionResponses.push_back(readCardSelectionResponse(reader, offset));
+    }
+
+    return std::make_shared<ScheduledCardSelectionsResponseAdapter>(cardSelectionResponses);
+}
+
+std::shared_ptr<CardResponseAdapter> CardSelectionSerializer::deserializeCardResponse(
+    const std::vector<uint8_t>& buffer)
+{
+    const Reader reader(buffer, Kind::CARD_RESPONSE);
+
+    return readCardResponse(reader, reader.getRootPosition());
+}
+
+size_t CardSelectionSerializer::getCardSelectionResponseCount(const std::vector<uint8_t>& buffer)
+{
+    const Reader reader(buffer, Kind::SCHEDULED_CARD_SELECTIONS_RESPONSE);
+    size_t position = reader.getRootPosition();
+
+    return reader.readCount(position);
+}
+
+bool CardSelectionSerializer::hasMatched(const std::vector<uint8_t>& buffer, const size_t index)
+{
+    const Reader reader(buffer, Kind::SCHEDULED_CARD_SELECTIONS_RESPONSE);
+    size_t position = getCardSelectionResponsePosition(reader, index);
+
+    return reader.readByte(position) != 0;
+}
+
+CardSelectionSerializer::ByteView CardSelectionSerializer::getPowerOnData(
+    const std::vector<uint8_t>& buffer, const size_t index)
+{
+    const Reader reader(buffer, Kind::SCHEDULED_CARD_SELECTIONS_RESPONSE);
+
+    /* Skips the match status and the 2 offsets */
+    size_t position = getCardSelectionResponsePosition(reader, index) + 1 + 2 * 4;
+
+    return reader.readView(position);
+}
+
+CardSelectionSerializer::ByteView CardSelectionSerializer::getSelectApplicationResponse(
+    const std::vector<uint8_t>& buffer, const size_t index)
+{
+    const Reader reader(buffer, Kind::SCHEDULED_CARD_SELECTIONS_RESPONSE);
+
+    size_t position = getCardSelectionResponsePosition(reader, index) + 1;
+    const size_t selectApplicationResponsePosition = reader.readOffset(position);
+
+    if (selectApplicationResponsePosition == 0) {
+        return ByteView{nullptr, 0};
+    }
+
+    return readApduResponseView(reader, selectApplicationResponsePosition);
+}
+
+size_t CardSelectionSerializer::getApduResponseCount(const std::vector<uint8_t>& buffer,
+                                                     const size_t index)
+{
+    const Reader reader(buffer, Kind::SCHEDULED_CARD_SELECTIONS_RESPONSE);
+
+    size_t position = getCardSelectionResponsePosition(reader, index) + 1 + 4;
+    size_t cardResponsePosition = reader.readOffset(position);
+
+    if (cardResponsePosition == 0) {
+        return 0;
+    }
+
+    /* Skips the logical channel status */
+    cardResponsePosition++;
+
+    return reader.readCount(cardResponsePosition);
+}
+
+CardSelectionSerializer::ByteView CardSelectionSerializer::getApduResponse(
+    const std::vector<uint8_t>& buffer, const size_t index, const size_t apduIndex)
+{
+    const Reader reader(buffer, Kind::SCHEDULED_CARD_SELECTIONS_RESPONSE);
+
+    size_t position = getCardSelectionResponsePosition(reader, index) + 1 + 4;
+    size_t cardResponsePosition = reader.readOffset(position);
+
+    if (cardResponsePosition == 0) {
+        throw IllegalArgumentException("No card response.");
+    }
+
+    cardResponsePosition++;
+    if (apduIndex >= reader.readCount(cardResponsePosition)) {
+        throw IllegalArgumentException("APDU response index out of range: " +
+                                       std::to_string(apduIndex) + ".");
+    }
+
+    cardResponsePosition += apduIndex * 4;
+    const size_t offset = reader.readOffset(cardResponsePosition);
+    if (offset == 0) {
+        throw IllegalArgumentException("Null APDU response.");
+    }
+
+    return readApduResponseView(reader, offset);
+}
+
+int CardSelectionSerializer::getStatusWord(const ByteView& apduResponse)
+{
+    if (apduResponse.size < 2) {
+        throw IllegalArgumentException("Invalid APDU response length: " +
+                                       std::to_string(apduResponse.size) + ".");
+    }
+
+    return apduResponse.data[apduResponse.size - 2] << 8 | apduResponse.data[apduResponse.size - 1];
+}
+
+size_t CardSelectionSerializer::getCardSelectionResponsePosition(const Reader& reader,
+                                                                 const size_t index)
+{
+    size_t position = reader.getRootPosition();
+
+    if (index >= reader.readCount(position)) {
+        throw IllegalArgumentException("Card selection response index out of range: " +
+                                       std::to_string(index) + ".");
+    }
+
+    /* Jumps directly to the entry of the offset table */
+    position += index * 4;
+    const size_t offset = reader.readOffset(position);
+    if (offset == 0) {
+        throw IllegalArgumentException("Null card selection response.");
+    }
+
+    return offset;
+}
+
+CardSelectionSerializer::ByteView CardSelectionSerializer::readApduResponseView(
+    const Reader& reader, size_t position)
+{
+    const ByteView apdu = reader.readView(position);
+
+    /* The status word is read in the last 2 bytes */
+    if (apdu.size < 2) {
+        throw IllegalArgumentException("Invalid APDU response length: " +
+                                       std::to_string(apdu.size) + ".");
+    }
+
+    return apdu;
+}
+
+std::shared_ptr<CardSelectionRequestSpi> CardSelectionSerializer::readCardSelectionRequest(
+    const Reader& reader, size_t position)
+{
+    size_t cardSelectorPosition = reader.readOffset(position);
+    const size_t cardRequestPosition = reader.readOffset(position);
+
+    if (cardSelectorPosition == 0) {
+        throw IllegalArgumentException("Null card selector.");
+    }
+
+    const uint8_t fileOccurrence = reader.readByte(cardSelectorPosition);
+    const uint8_t fileControlInformation = reader.readByte(cardSelectorPosition);
+
+    if (fileOccurrence > static_cast<uint8_t>(CardSelectorSpi::FileOccurrence::PREVIOUS) ||
+        fileControlInformation >
+            static_cast<uint8_t>(CardSelectorSpi::FileControlInformation::NO_RESPONSE)) {
+        throw IllegalArgumentException("Invalid card selector indicators.");
+    }
+
+    const std::string cardProtocol = reader.readString(cardSelectorPosition);
+    const std::string powerOnDataRegex = reader.readString(cardSelectorPosition);
+    const std::vector<uint8_t> aid = reader.readBytes(cardSelectorPosition);
+    const std::vector<int> successfulSelectionStatusWords =
+        readStatusWords(reader, cardSelectorPosition);
+
+    std::shared_ptr<CompiledCardSelector> cardSelector;
+    try {
+        cardSelector = std::make_shared<CompiledCardSelector>(
+                           cardProtocol,
+                           powerOnDataRegex,
+                           aid,
+                           static_cast<CardSelectorSpi::FileOccurrence>(fileOccurrence),
+                           static_cast<CardSelectorSpi::FileControlInformation>(
+                               fileControlInformation),
+                           successfulSelectionStatusWords);
+    } catch (const std::regex_error& e) {
+        throw IllegalArgumentException("Invalid power on data regex: " + powerOnDataRegex + " (" +
+                                       e.what() + ").");
+    }
+
+    return std::make_shared<CompiledCardSelectionRequest>(
+               cardSelector,
+               cardRequestPosition != 0 ? readCardRequest(reader, cardRequestPosition) : nullptr);
+}
+
+std::shared_ptr<CardRequestSpi> CardSelectionSerializer::readCardRequest(const Reader& reader,
+                                                                         size_t position)
+{
+    const bool stopOnUnsuccessfulStatusWord = reader.readByte(position) != 0;
+    const size_t count = reader.readCount(position);
+
+    std::vector<std::shared_ptr<ApduRequestSpi>> apduRequests;
+    apduRequests.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        const size_t offset = reader.readOffset(position);
+        if (offset == 0) {
+            throw IllegalArgumentException("Null APDU request.");
+        }
+
+        apduRequests.push_back(readApduRequest(reader, offset));
+    }
+
+    return std::make_shared<CardRequestAdapter>(apduRequests, stopOnUnsuccessfulStatusWord);
+}
+
+std::shared_ptr<ApduRequestSpi> CardSelectionSerializer::readApduRequest(const Reader& reader,
+                                                                         size_t position)
+{
+    const std::vector<uint8_t> apdu = reader.readBytes(position);
+    const std::vector<int> successfulStatusWords = readStatusWords(reader, position);
+    const std::string info = reader.readString(position);
+
+    return std::make_shared<ApduRequestAdapter>(apdu, successfulStatusWords, info);
+}
+
+std::vector<int> CardSelectionSerializer::readStatusWords(const Reader& reader, size_t& position)
+{
+    const size_t count = reader.readInt(position);
+
+    /* No reservation: a corrupted count is detected by readShort() when reaching the end */
+    std::vector<int> statusWords;
+
+    for (size_t i = 0; i < count; i++) {
+        statusWords.push_back(reader.readShort(position));
+    }
+
+    return statusWords;
+}
+
+std::shared_ptr<CardSelectionResponseApi> CardSelectionSerializer::readCardSelectionResponse(
+    const Reader& reader, size_t position)
+{
+    const bool hasMatched = reader.readByte(position) != 0;
+    size_t selectApplicationResponsePosition = reader.readOffset(position);
+    const size_t cardResponsePosition = reader.readOffset(position);
+    const std::string powerOnData = reader.readString(position);
+
+    std::shared_ptr<ApduResponseAdapter> selectApplicationResponse = nullptr;
+    if (selectApplicationResponsePosition != 0) {
+        selectApplicationResponse = readApduResponse(reader, selectApplicationResponsePosition);
+    }
+
+    std::shared_ptr<CardResponseAdapter> cardResponse = nullptr;
+    if (cardResponsePosition != 0) {
+        cardResponse = readCardResponse(reader, cardResponsePosition);
+    }
+
+    return std::make_shared<CardSelectionResponseAdapter>(
+               powerOnData, selectApplicationResponse, hasMatched, cardResponse);
+}
+
+std::shared_ptr<CardResponseAdapter> CardSelectionSerializer::readCardResponse(
+    const Reader& reader, size_t position)
+{
+    const bool isLogicalChannelOpen = reader.readByte(position) != 0;
+    const size_t count = reader.readCount(position);
+
+    std::vector<std::shared_ptr<ApduResponseApi>> apduResponses;
+    apduResponses.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        const size_t offset = reader.readOffset(position);
+        if (offset == 0) {
+            throw IllegalArgumentException("Null APDU response.");
+        }
+
+        apduResponses.push_back(readApduResponse(reader, offset));
+    }
+
+    return std::make_shared<CardResponseAdapter>(apduResponses, isLogicalChannelOpen);
+}
+
+std::shared_ptr<ApduResponseAdapter> CardSelectionSerializer::readApduResponse(
+    const Reader& reader, size_t position)
+{
+    const std::vector<uint8_t> apdu = reader.readBytes(position);
+
+    /* The adapter reads the status word in the last 2 bytes */
+    if (apdu.size() < 2) {
+        throw IllegalArgumentException("Invalid APDU response length: " +
+                                       std::to_string(apdu.size()) + ".");
+    }
+
+    return std::make_shared<ApduResponseAdapter>(apdu);
+}
+
+}
+}
+}
@@ -0,0 +1,413 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Card */
+#include "ApduRequestSpi.h"
+#include "ApduResponseApi.h"
+#include "CardRequestSpi.h"
+#include "CardResponseApi.h"
+#include "CardSelectionRequestSpi.h"
+#include "CardSelectionResponseApi.h"
+#include "CardSelectorSpi.h"
+
+/* Keyple Core Service */
+#include "ApduResponseAdapter.h"
+#include "CardResponseAdapter.h"
+#include "CardSelectionScenarioAdapter.h"
+#include "KeypleServiceExport.h"
+#include "ScheduledCardSelectionsResponseAdapter.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace calypsonet::terminal::card;
+using namespace calypsonet::terminal::card::spi;
+
+/**
+ * (package-private)<br>
+ * Compact binary serialization of the card selection scenarios, of the scheduled card selection
+ * responses and of the card responses, to transfer them to another process or to store them.
+ *
+ * <p>A buffer starts with an 8 bytes header: the "KSB" magic, the format version, the kind of
+ * the serialized object and 3 reserved bytes. The integers are little-endian. Each object is a
+ * table whose fixed-size fields come first; the strings and byte arrays are prefixed by their
+ * 32-bit length and the nested objects are referenced by their 32-bit absolute offset in the
+ * buffer (0 for null). A list is a 32-bit count followed by the offsets of its elements, so that
+ * any element can be read in place without decoding the previous ones.
+ *
+ * <p>The fields of serialized card selection responses can be read in place, without any
+ * allocation nor copy: the match status, the power-on data, the select application response
+ * and the APDU responses of the card response are returned as {@link ByteView}s pointing into the
+ * buffer (see {@link #hasMatched(const std::vector<uint8_t>&, const size_t)}).
+ *
+ * <p>The restored card selection requests are {@link CompiledCardSelectionRequest}, ready to be
+ * executed.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API CardSelectionSerializer final {
+public:
+    /**
+     * (package-private)<br>
+     * Version of the format, rejected by the deserialization if different.
+     *
+     * @since 2.0.0
+     */
+    static const uint8_t FORMAT_VERSION;
+
+    /**
+     * (package-private)<br>
+     * Bytes read in place in a buffer, valid as long as the buffer is neither modified nor
+     * destroyed.
+     *
+     * @since 2.0.0
+     */
+    struct ByteView {
+        /**
+         * First byte, null if the view is empty.
+         */
+        const uint8_t* data;
+
+        /**
+         * Number of bytes.
+         */
+        size_t size;
+    };
+
+    /**
+     * (package-private)<br>
+     * Serializes a card selection scenario.
+     *
+     * @param cardSelectionScenario The scenario.
+     * @return A not empty buffer.
+     * @throw IllegalArgumentException If a status word exceeds FFFFh.
+     * @since 2.0.0
+     */
+    static std::vector<uint8_t> serialize(
+        const CardSelectionScenarioAdapter& cardSelectionScenario);
+
+    /**
+     * (package-private)<br>
+     * Restores a card selection scenario.
+     *
+     * @param buffer A buffer built by serialize(const CardSelectionScenarioAdapter&).
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the buffer is malformed, truncated or of another kind or
+     *        version.
+     * @since 2.0.0
+     */
+    static std::shared_ptr<CardSelectionScenarioAdapter> deserializeCardSelectionScenario(
+        const std::vector<uint8_t>& buffer);
+
+    /**
+     * (package-private)<br>
+     * Serializes the responses of a scheduled card selection.
+     *
+     * @param scheduledCardSelectionsResponse The responses.
+     * @return A not empty buffer.
+     * @since 2.0.0
+     */
+    static std::vector<uint8_t> serialize(
+        const ScheduledCardSelectionsResponseAdapter& scheduledCardSelectionsResponse);
+
+    /**
+     * (package-private)<br>
+     * Restores the responses of a scheduled card selection.
+     *
+     * @param buffer A buffer built by serialize(const ScheduledCardSelectionsResponseAdapter&).
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the buffer is malformed, truncated or of another kind or
+     *        version.
+     * @since 2.0.0
+     */
+    static std::shared_ptr<ScheduledCardSelectionsResponseAdapter>
+        deserializeScheduledCardSelectionsResponse(const std::vector<uint8_t>& buffer);
+
+    /**
+     * (package-private)<br>
+     * Serializes a card response.
+     *
+     * @param cardResponse The card response.
+     * @return A not empty buffer.
+     * @since 2.0.0
+     */
+    static std::vector<uint8_t> serialize(const CardResponseApi& cardResponse);
+
+    /**
+     * (package-private)<br>
+     * Restores a card response.
+     *
+     * @param buffer A buffer built by serialize(const CardResponseApi&).
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the buffer is malformed, truncated or of another kind or
+     *        version.
+     * @since 2.0.0
+     */
+    static std::shared_ptr<CardResponseAdapter> deserializeCardResponse(
+        const std::vector<uint8_t>& buffer);
+
+    /**
+     * (package-private)<br>
+     * Gets the number of card selection responses of serialized scheduled card selection
+     * responses, without decoding them.
+     *
+     * @param buffer A buffer built by serialize(const ScheduledCardSelectionsResponseAdapter&).
+     * @return A positive or null number.
+     * @throw IllegalArgumentException If the buffer is malformed or of another kind or version.
+     * @since 2.0.0
+     */
+    static size_t getCardSelectionResponseCount(const std::vector<uint8_t>& buffer);
+
+    /**
+     * (package-private)<br>
+     * Tells if a card selection response of serialized scheduled card selection responses has
+     * matched, reading it in place.
+     *
+     * @param buffer A buffer built by serialize(const ScheduledCardSelectionsResponseAdapter&).
+     * @param index The index of the card selection response.
+     * @return True if the card selection response has matched.
+     * @throw IllegalArgumentException If the buffer is malformed or of another kind or version,
+     *        or if the index is out of range.
+     * @since 2.0.0
+     */
+    static bool hasMatched(const std::vector<uint8_t>& buffer, const size_t index);
+
+    /**
+     * (package-private)<br>
+     * Gets the power-on data of a card selection response of serialized scheduled card selection
+     * responses, reading it in place.
+     *
+     * @param buffer A buffer built by serialize(const ScheduledCardSelectionsResponseAdapter&).
+     * @param index The index of the card selection response.
+     * @return A view of the characters of the power-on data, empty if none.
+     * @throw IllegalArgumentException If the buffer is malformed or of another kind or version,
+     *        or if the index is out of range.
+     * @since 2.0.0
+     */
+    static ByteView getPowerOnData(const std::vector<uint8_t>& buffer, const size_t index);
+
+    /**
+     * (package-private)<br>
+     * Gets the select application response of a card selection response of serialized scheduled
+     * card selection responses, reading it in place.
+     *
+     * @param buffer A buffer built by serialize(const ScheduledCardSelectionsResponseAdapter&).
+     * @param index The index of the card selection response.
+     * @return A view of the APDU, status word included, empty if there is no response.
+     * @throw IllegalArgumentException If the buffer is malformed or of another kind or version,
+     *        or if the index is out of range.
+     * @since 2.0.0
+     */
+    static ByteView getSelectApplicationResponse(const std::vector<uint8_t>& buffer,
+                                                 const size_t index);
+
+    /**
+     * (package-private)<br>
+     * Gets the number of APDU responses of the card response of a card selection response of
+     * serialized scheduled card selection responses, reading it in place.
+     *
+     * @param buffer A buffer built by serialize(const ScheduledCardSelectionsResponseAdapter&).
+     * @param index The index of the card selection response.
+     * @return A positive or null number, 0 if there is no card response.
+     * @throw IllegalArgumentException If the buffer is malformed or of another kind or version,
+     *        or if the index is out of range.
+     * @since 2.0.0
+     */
+    static size_t getApduResponseCount(const std::vector<uint8_t>& buffer, const size_t index);
+
+    /**
+     * (package-private)<br>
+     * Gets an APDU response of the card response of a card selection response of serialized
+     * scheduled card selection responses, reading it in place.
+     *
+     * @param buffer A buffer built by serialize(const ScheduledCardSelectionsResponseAdapter&).
+     * @param index The index of the card selection response.
+     * @param apduIndex The index of the APDU response in the card response.
+     * @return A view of the APDU, status word included, of at least 2 bytes.
+     * @throw IllegalArgumentException If the buffer is malformed or of another kind or version,
+     *        or if an index is out of range.
+     * @since 2.0.0
+     */
+    static ByteView getApduResponse(const std::vector<uint8_t>& buffer,
+                                    const size_t index,
+                                    const size_t apduIndex);
+
+    /**
+     * (package-private)<br>
+     * Gets the status word of an APDU response read in place.
+     *
+     * @param apduResponse A view returned by getSelectApplicationResponse() or getApduResponse().
+     * @return The status word, in the last 2 bytes of the APDU.
+     * @throw IllegalArgumentException If the view is shorter than 2 bytes.
+     * @since 2.0.0
+     */
+    static int getStatusWord(const ByteView& apduResponse);
+
+private:
+    /**
+     * Kind of the serialized object, stored in the header.
+     */
+    enum class Kind : uint8_t {
+        CARD_SELECTION_SCENARIO = 1,
+        SCHEDULED_CARD_SELECTIONS_RESPONSE = 2,
+        CARD_RESPONSE = 3
+    };
+
+    /**
+     * (private)<br>
+     * Appends the encoded values to a growing buffer.
+     */
+    class Writer final {
+    public:
+        /**
+         * Writes the header.
+         *
+         * @param kind The kind of the serialized object.
+         */
+        explicit Writer(const Kind kind);
+
+        void writeByte(const uint8_t value);
+        void writeShort(const uint16_t value);
+        void writeInt(const uint32_t value);
+        void writeBytes(const std::vector<uint8_t>& value);
+        void writeString(const std::string& value);
+
+        /**
+         * Writes a null offset to be set later with patchOffset().
+         *
+         * @return The position of the offset.
+         */
+        size_t reserveOffset();
+
+        /**
+         * Sets the offset at the given position to the current end of the buffer, where the
+         * referenced object is about to be written.
+         *
+         * @param position The position of the offset.
+         */
+        void patchOffset(const size_t position);
+
+        /**
+         * @return The buffer.
+         */
+        std::vector<uint8_t>& getBuffer();
+
+    private:
+        /**
+         *
+         */
+        std::vector<uint8_t> mBuffer;
+    };
+
+    /**
+     * (private)<br>
+     * Decodes the values of a buffer, checking the bounds.
+     */
+    class Reader final {
+    public:
+        /**
+         * Checks the header.
+         *
+         * @param buffer The buffer.
+         * @param kind The expected kind of the serialized object.
+         * @throw IllegalArgumentException If the header is not the expected one.
+         */
+        Reader(const std::vector<uint8_t>& buffer, const Kind kind);
+
+        /**
+         * @return The position of the root object.
+         */
+        size_t getRootPosition() const;
+
+        /*
+         * The following methods read a value at the given position and move it forward.
+         */
+        uint8_t readByte(size_t& position) const;
+        uint16_t readShort(size_t& position) const;
+        uint32_t readInt(size_t& position) const;
+        std::vector<uint8_t> readBytes(size_t& position) const;
+        std::string readString(size_t& position) const;
+
+        /**
+         * @return A view of a byte array or of a string, pointing into the buffer.
+         */
+        ByteView readView(size_t& position) const;
+
+        /**
+         * @return The referenced position, 0 for null.
+         * @throw IllegalArgumentException If the offset is out of the buffer.
+         */
+        size_t readOffset(size_t& position) const;
+
+        /**
+         * @return The number of elements of a list, checked against the size of the buffer.
+         */
+        size_t readCount(size_t& position) const;
+
+    private:
+        /**
+         * Checks that the given number of bytes can be read at the given position.
+         */
+        void checkAvailable(const size_t position, const size_t length) const;
+
+        /**
+         *
+         */
+        const std::vector<uint8_t>& mBuffer;
+    };
+
+    static void writeCardSelectionRequest(Writer& writer,
+                                          const CardSelectionRequestSpi& cardSelectionRequest);
+    static void writeCardSelector(Writer& writer, const CardSelectorSpi& cardSelector);
+    static void writeCardRequest(Writer& writer, const CardRequestSpi& cardRequest);
+    static void writeApduRequest(Writer& writer, const ApduRequestSpi& apduRequest);
+    static void writeStatusWords(Writer& writer, const std::vector<int>& statusWords);
+    static void writeCardSelectionResponse(Writer& writer,
+                                           const CardSelectionResponseApi& cardSelectionResponse);
+    static void writeCardResponse(Writer& writer, const CardResponseApi& cardResponse);
+    static void writeApduResponse(Writer& writer, const ApduResponseApi& apduResponse);
+
+    /**
+     * @return The position of the card selection response of the given index.
+     * @throw IllegalArgumentException If the index is out of range.
+     */
+    static size_t getCardSelectionResponsePosition(const Reader& reader, const size_t index);
+
+    /**
+     * @return The position of the APDU response, checked to hold a status word.
+     */
+    static ByteView readApduResponseView(const Reader& reader, size_t position);
+
+    static std::shared_ptr<CardSelectionRequestSpi> readCardSelectionRequest(
+        const Reader& reader, size_t position);
+    static std::shared_ptr<CardRequestSpi> readCardRequest(const Reader& reader, size_t position);
+    static std::shared_ptr<ApduRequestSpi> readApduRequest(const Reader& reader, size_t position);
+    static std::vector<int> readStatusWords(const Reader& reader, size_t& position);
+    static std::shared_ptr<CardSelectionResponseApi> readCardSelectionResponse(
+        const Reader& reader, size_t position);
+    static std::shared_ptr<CardResponseAdapter> readCardResponse(const Reader& reader,
+                                                                 size_t position);
+    static std::shared_ptr<ApduResponseAdapter> readApduResponse(const Reader& reader,
+                                                                 size_t position);
+};
+
+}
+}
+}
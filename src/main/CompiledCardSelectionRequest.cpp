@@ -0,0 +1,42 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "CompiledCardSelectionRequest.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+CompiledCardSelectionRequest::CompiledCardSelectionRequest(
+    const std::shared_ptr<CardSelectionRequestSpi> cardSelectionRequest)
+: mCardSelector(
+      std::make_shared<CompiledCardSelector>(cardSelectionRequest->getCardSelector())),
+  mCardRequest(cardSelectionRequest->getCardRequest()) {}
+
+CompiledCardSelectionRequest::CompiledCardSelectionRequest(
+    const std::shared_ptr<CompiledCardSelector> cardSelector,
+    const std::shared_ptr<CardRequestSpi> cardRequest)
+: mCardSelector(cardSelector), mCardRequest(cardRequest) {}
+
+std::shared_ptr<CardSelectorSpi> CompiledCardSelectionRequest::getCardSelector() const
+{
+    return mCardSelector;
+}
+
+std::shared_ptr<CardRequestSpi> CompiledCardSelectionRequest::getCardRequest() const
+{
+    return mCardRequest;
+}
+
+}
+}
+}
@@ -0,0 +1,90 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+/* Calypsonet Terminal Card */
+#include "CardRequestSpi.h"
+#include "CardSelectionRequestSpi.h"
+
+/* Keyple Core Service */
+#include "CompiledCardSelector.h"
+#include "KeypleServiceExport.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace calypsonet::terminal::card::spi;
+
+/**
+ * (package-private)<br>
+ * Immutable copy of a {@link CardSelectionRequestSpi}, whose card selector is compiled.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API CompiledCardSelectionRequest final : public CardSelectionRequestSpi {
+public:
+    /**
+     * (package-private)<br>
+     * Constructor.
+     *
+     * @param cardSelectionRequest The card selection request provided by the card extension.
+     * @since 2.0.0
+     */
+    explicit CompiledCardSelectionRequest(
+        const std::shared_ptr<CardSelectionRequestSpi> cardSelectionRequest);
+
+    /**
+     * (package-private)<br>
+     * Constructor from an already compiled card selector.
+     *
+     * @param cardSelector The compiled card selector.
+     * @param cardRequest The card request, null if none.
+     * @since 2.0.0
+     */
+    CompiledCardSelectionRequest(const std::shared_ptr<CompiledCardSelector> cardSelector,
+                                 const std::shared_ptr<CardRequestSpi> cardRequest);
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The returned selector is a {@link CompiledCardSelector}.
+     *
+     * @since 2.0.0
+     */
+    std::shared_ptr<CardSelectorSpi> getCardSelector() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    std::shared_ptr<CardRequestSpi> getCardRequest() const override;
+
+private:
+    /**
+     *
+     */
+    const std::shared_ptr<CompiledCardSelector> mCardSelector;
+
+    /**
+     *
+     */
+    const std::shared_ptr<CardRequestSpi> mCardRequest;
+};
+
+}
+}
+}
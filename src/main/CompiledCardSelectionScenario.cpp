@@ -0,0 +1,437 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "CompiledCardSelectionScenario.h"
+
+#include <algorithm>
+#include <set>
+#include <system_error>
+
+/* Calypsonet Terminal Card */
+#include "ParseException.h"
+
+/* Calypsonet Terminal Reader */
+#include "InvalidCardResponseException.h"
+#include "ReaderCommunicationException.h"
+
+/* Keyple Core Util */
+#include "Exception.h"
+#include "IllegalArgumentException.h"
+#include "KeypleAssert.h"
+
+/* Keyple Core Service */
+#include "AbstractReaderAdapter.h"
+#include "CardCommunicationException.h"
+#include "CardSelectionResultAdapter.h"
+#include "CompiledCardSelectionRequest.h"
+#include "WorkerPool.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+CompiledCardSelectionScenario::CompiledCardSelectionScenario(
+    const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+    const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
+    const MultiSelectionProcessing multiSelectionProcessing,
+    const ChannelControl channelControl,
+    const int parsingThreadCount,
+    const bool compileCardSelectors)
+: mCardSelections(cardSelections),
+  mCardSelectionScenario(
+      std::make_shared<CardSelectionScenarioAdapter>(compileCardSelectors ?
+                                                         compile(cardSelectionRequests) :
+                                                         cardSelectionRequests,
+                                                     multiSelectionProcessing,
+                                                     channelControl)),
+  mParsingThreadCount(parsingThreadCount) {}
+
+const std::shared_ptr<CardSelectionResult>
+    CompiledCardSelectionScenario::processCardSelectionScenario(
+        std::shared_ptr<CardReader> reader) const
+{
+    return execute(mCardSelections,
+                   mCardSelectionScenario,
+                   mParsingThreadCount,
+                   getReaderAdapter(reader));
+}
+
+const std::map<std::string, std::shared_ptr<CardSelectionResult>>
+    CompiledCardSelectionScenario::processCardSelectionScenario(
+        const std::vector<std::shared_ptr<CardReader>>& readers) const
+{
+    const std::shared_ptr<ParallelSelection> parallelSelection =
+        startParallelSelection(readers, false);
+
+    parallelSelection->awaitAll();
+    parallelSelection->rethrowFirstError();
+
+    std::map<std::string, std::shared_ptr<CardSelectionResult>> cardSelectionResults;
+    for (size_t i = 0; i < readers.size(); i++) {
+        cardSelectionResults.insert({readers[i]->getName(), parallelSelection->getResult(i)});
+    }
+
+    return cardSelectionResults;
+}
+
+const std::map<std::string, std::shared_ptr<CardSelectionResult>>
+    CompiledCardSelectionScenario::processCardSelectionScenarioUntilFirstMatch(
+        const std::vector<std::shared_ptr<CardReader>>& readers) const
+{
+    const std::shared_ptr<ParallelSelection> parallelSelection =
+        startParallelSelection(readers, true);
+
+    std::map<std::string, std::shared_ptr<CardSelectionResult>> cardSelectionResults;
+
+    const int matchingIndex = parallelSelection->awaitFirstMatch();
+    if (matchingIndex != -1) {
+        cardSelectionResults.insert({readers[matchingIndex]->getName(),
+                                     parallelSelection->getResult(matchingIndex)});
+    } else {
+        parallelSelection->rethrowFirstError();
+    }
+
+    return cardSelectionResults;
+}
+
+const std::shared_ptr<CardSelectionScenarioAdapter>&
+    CompiledCardSelectionScenario::getCardSelectionScenario() const
+{
+    return mCardSelectionScenario;
+}
+
+const std::shared_ptr<CardSelectionResult>
+    CompiledCardSelectionScenario::processCardSelectionResponses(
+        const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+        const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponses,
+        const int parsingThreadCount)
+{
+    Assert::getInstance().notEmpty(cardSelectionResponses, "cardSelectionResponses");
+
+    auto cardSelectionsResult =
+        std::make_shared<CardSelectionResultAdapter>(cardSelectionResponses.size());
+
+    /* Check card responses */
+    std::vector<int> matchingIndexes;
+    for (int index = 0; index < static_cast<int>(cardSelectionResponses.size()); index++) {
+        if (cardSelectionResponses[index]->hasMatched()) {
+            matchingIndexes.push_back(index);
+        }
+    }
+
+    if (parsingThreadCount > 1 && matchingIndexes.size() > 1) {
+        const std::vector<std::shared_ptr<SmartCard>> smartCards =
+            parseInParallel(cardSelections,
+                            cardSelectionResponses,
+                            matchingIndexes,
+                            static_cast<size_t>(parsingThreadCount));
+
+        /* Added in the order of the indexes, the last one remains the active selection */
+        for (size_t i = 0; i < matchingIndexes.size(); i++) {
+            cardSelectionsResult->addSmartCard(matchingIndexes[i], smartCards[i]);
+        }
+
+        return cardSelectionsResult;
+    }
+
+    for (const int index : matchingIndexes) {
+        cardSelectionsResult->addSmartCard(
+            index, parse(cardSelections[index], cardSelectionResponses[index]));
+    }
+
+    return cardSelectionsResult;
+}
+
+std::shared_ptr<AbstractReaderAdapter> CompiledCardSelectionScenario::getReaderAdapter(
+    const std::shared_ptr<CardReader> reader)
+{
+    Assert::getInstance().notNull(reader, "reader");
+
+    const auto readerAdapter = std::dynamic_pointer_cast<AbstractReaderAdapter>(reader);
+    if (readerAdapter == nullptr) {
+        throw IllegalArgumentException("Not a Keyple reader implementation.");
+    }
+
+    return readerAdapter;
+}
+
+const std::shared_ptr<CardSelectionResult> CompiledCardSelectionScenario::execute(
+    const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+    const std::shared_ptr<CardSelectionScenarioAdapter>& cardSelectionScenario,
+    const int parsingThreadCount,
+    const std::shared_ptr<AbstractReaderAdapter>& readerAdapter)
+{
+    /* Communicate with the card to make the actual selection */
+    const TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>> result =
+        readerAdapter->tryTransmitCardSelectionRequests(
+            cardSelectionScenario->getCardSelectionRequests(),
+            cardSelectionScenario->getMultiSelectionProcessing(),
+            cardSelectionScenario->getChannelControl());
+
+    /* Public API boundary, the failures are converted into exceptions */
+    if (!result.isSuccess()) {
+        const std::shared_ptr<const TransmitFailure>& failure = result.getFailure();
+
+        if (failure->getType() == TransmitFailure::Type::READER_BROKEN_COMMUNICATION) {
+            throw ReaderCommunicationException(failure->getMessage(), failure->toException());
+        }
+
+        throw CardCommunicationException(failure->getMessage(), failure->toException());
+    }
+
+    /* Analyze the received responses */
+    return processCardSelectionResponses(cardSelections,
+                                         result.getValue(),
+                                         parsingThreadCount);
+}
+
+std::shared_ptr<SmartCard> CompiledCardSelectionScenario::parse(
+    const std::shared_ptr<CardSelectionSpi>& cardSelection,
+    const std::shared_ptr<CardSelectionResponseApi>& cardSelectionResponse)
+{
+    try {
+        return std::dynamic_pointer_cast<SmartCard>(cardSelection->parse(cardSelectionResponse));
+    } catch (const ParseException& e) {
+        throw InvalidCardResponseException(
+                  "Error occurred while parsing the card response: " + e.getMessage(),
+                  std::make_shared<ParseException>(e));
+    }
+}
+
+std::vector<std::shared_ptr<SmartCard>> CompiledCardSelectionScenario::parseInParallel(
+    const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+    const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponses,
+    const std::vector<int>& matchingIndexes,
+    const size_t threadCount)
+{
+    std::vector<std::shared_ptr<SmartCard>> smartCards(matchingIndexes.size());
+    std::vector<std::exception_ptr> errors(matchingIndexes.size());
+    std::atomic<size_t> nextIndex(0);
+
+    /* Each slot is written by a single thread */
+    auto worker = [&]() {
+        size_t i;
+        while ((i = nextIndex++) < matchingIndexes.size()) {
+            const int index = matchingIndexes[i];
+            try {
+                smartCards[i] = parse(cardSelections[index], cardSelectionResponses[index]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    WorkerPool::getInstance()->run(worker, std::min(threadCount, matchingIndexes.size()));
+
+    /* Same error as with a sequential parsing, whatever the scheduling of the threads */
+    for (const auto& error : errors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    return smartCards;
+}
+
+std::shared_ptr<CompiledCardSelectionScenario::ParallelSelection>
+    CompiledCardSelectionScenario::startParallelSelection(
+        const std::vector<std::shared_ptr<CardReader>>& readers,
+        const bool stopOnFirstMatch) const
+{
+    Assert::getInstance().notEmpty(readers, "readers");
+
+    /* All the readers are checked before anything is started */
+    std::vector<std::shared_ptr<AbstractReaderAdapter>> readerAdapters;
+    std::set<std::string> readerNames;
+    for (const auto& reader : readers) {
+        readerAdapters.push_back(getReaderAdapter(reader));
+        if (!readerNames.insert(reader->getName()).second) {
+            throw IllegalArgumentException("The reader '" + reader->getName() + "' is present " +
+                                           "more than once.");
+        }
+    }
+
+    auto parallelSelection = std::make_shared<ParallelSelection>(mCardSelections,
+                                                                 mCardSelectionScenario,
+                                                                 mParsingThreadCount,
+                                                                 readers.size(),
+                                                                 stopOnFirstMatch);
+
+    /*
+     * Each reader is processed on its own executor. The selections still in progress after a
+     * first match end there, keeping the shared state alive, and the later work on these readers
+     * is queued behind them.
+     */
+    for (size_t i = 0; i < readerAdapters.size(); i++) {
+        try {
+            readerAdapters[i]->getExecutorService()->execute(
+                std::make_shared<ParallelSelectionJob>(parallelSelection, i, readerAdapters[i]));
+        } catch (const std::system_error&) {
+            parallelSelection->abort(i);
+            throw;
+        }
+    }
+
+    return parallelSelection;
+}
+
+std::vector<std::shared_ptr<CardSelectionRequestSpi>> CompiledCardSelectionScenario::compile(
+    const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests)
+{
+    std::vector<std::shared_ptr<CardSelectionRequestSpi>> compiledCardSelectionRequests;
+    compiledCardSelectionRequests.reserve(cardSelectionRequests.size());
+
+    for (const auto& cardSelectionRequest : cardSelectionRequests) {
+        compiledCardSelectionRequests.push_back(
+            std::make_shared<CompiledCardSelectionRequest>(cardSelectionRequest));
+    }
+
+    return compiledCardSelectionRequests;
+}
+
+/* PARALLEL SELECTION JOB ----------------------------------------------------------------------- */
+
+CompiledCardSelectionScenario::ParallelSelectionJob::ParallelSelectionJob(
+    const std::shared_ptr<ParallelSelection> parallelSelection,
+    const size_t index,
+    const std::shared_ptr<AbstractReaderAdapter> readerAdapter)
+: Job("CompiledCardSelectionScenario"),
+  mParallelSelection(parallelSelection),
+  mIndex(index),
+  mReaderAdapter(readerAdapter) {}
+
+void CompiledCardSelectionScenario::ParallelSelectionJob::execute()
+{
+    mParallelSelection->run(mIndex, mReaderAdapter);
+}
+
+/* PARALLEL SELECTION --------------------------------------------------------------------------- */
+
+CompiledCardSelectionScenario::ParallelSelection::ParallelSelection(
+    const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+    const std::shared_ptr<CardSelectionScenarioAdapter> cardSelectionScenario,
+    const int parsingThreadCount,
+    const size_t readerCount,
+    const bool stopOnFirstMatch)
+: mCardSelections(cardSelections),
+  mCardSelectionScenario(cardSelectionScenario),
+  mParsingThreadCount(parsingThreadCount),
+  mStopOnFirstMatch(stopOnFirstMatch),
+  mCancelled(false),
+  mPendingCount(readerCount),
+  mResults(readerCount),
+  mErrors(readerCount),
+  mMatchingIndex(-1) {}
+
+void CompiledCardSelectionScenario::ParallelSelection::run(
+    const size_t index, const std::shared_ptr<AbstractReaderAdapter> readerAdapter)
+{
+    std::shared_ptr<CardSelectionResult> cardSelectionResult = nullptr;
+    std::exception_ptr error = nullptr;
+
+    /* The scenario is not started on a reader once a card has been selected on another one */
+    if (!mCancelled) {
+        try {
+            cardSelectionResult = execute(mCardSelections,
+                                          mCardSelectionScenario,
+                                          mParsingThreadCount,
+                                          readerAdapter);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+
+    bool isSuperseded = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mResults[index] = cardSelectionResult;
+        mErrors[index] = error;
+
+        if (mStopOnFirstMatch &&
+            cardSelectionResult != nullptr &&
+            cardSelectionResult->getActiveSelectionIndex() != -1) {
+            if (mMatchingIndex == -1) {
+                mMatchingIndex = static_cast<int>(index);
+                mCancelled = true;
+            } else {
+                isSuperseded = true;
+            }
+        }
+
+        mPendingCount--;
+        mCondition.notify_all();
+    }
+
+    /* Nobody will use the card selected after the first match, its channel is released */
+    if (isSuperseded && mCardSelectionScenario->getChannelControl() == ChannelControl::KEEP_OPEN) {
+        try {
+            readerAdapter->releaseChannel();
+        } catch (const Exception& e) {
+            mLogger->error("Error while releasing the channel of reader '%'\n",
+                           readerAdapter->getName(),
+                           e);
+        }
+    }
+}
+
+void CompiledCardSelectionScenario::ParallelSelection::abort(const size_t index)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mCancelled = true;
+    mPendingCount -= mResults.size() - index;
+    mCondition.notify_all();
+}
+
+void CompiledCardSelectionScenario::ParallelSelection::awaitAll()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    mCondition.wait(lock, [this]() { return mPendingCount == 0; });
+}
+
+int CompiledCardSelectionScenario::ParallelSelection::awaitFirstMatch()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    mCondition.wait(lock, [this]() { return mPendingCount == 0 || mMatchingIndex != -1; });
+
+    return mMatchingIndex;
+}
+
+void CompiledCardSelectionScenario::ParallelSelection::rethrowFirstError() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (const auto& error : mErrors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+const std::shared_ptr<CardSelectionResult>
+    CompiledCardSelectionScenario::ParallelSelection::getResult(const size_t index) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mResults[index];
+}
+
+}
+}
+}
@@ -0,0 +1,451 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* Calypsonet Terminal Card */
+#include "CardSelectionResponseApi.h"
+#include "CardSelectionSpi.h"
+#include "ChannelControl.h"
+
+/* Calypsonet Terminal Reader */
+#include "CardReader.h"
+#include "CardSelectionResult.h"
+#include "SmartCard.h"
+
+/* Keyple Core Service */
+#include "CardSelectionScenarioAdapter.h"
+#include "Job.h"
+#include "KeypleServiceExport.h"
+#include "MultiSelectionProcessing.h"
+
+/* Keyple Core Util */
+#include "LoggerFactory.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace calypsonet::terminal::card;
+using namespace calypsonet::terminal::card::spi;
+using namespace calypsonet::terminal::reader;
+using namespace calypsonet::terminal::reader::selection;
+using namespace keyple::core::service::cpp;
+using namespace keyple::core::util::cpp;
+
+class AbstractReaderAdapter;
+
+/**
+ * (package-private)<br>
+ * Card selection scenario prepared once and executed as many times as needed, possibly
+ * concurrently on several readers.
+ *
+ * <p>The card selection requests are collected from the card extensions when the scenario is
+ * compiled. When the scenario is reused, their card selectors are compiled too (see
+ * {@link CompiledCardSelector}), so that nothing is rebuilt when a card is presented. A scenario
+ * executed only once keeps the original selectors, compiling them would cost more than it saves.
+ *
+ * <p>The scenario itself is immutable. Running it concurrently also requires the card extensions
+ * to support concurrent invocations of CardSelectionSpi::parse.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API CompiledCardSelectionScenario final {
+public:
+    /**
+     * (package-private)<br>
+     * Constructor.
+     *
+     * @param cardSelections The card selections, in the order of the selection indexes.
+     * @param cardSelectionRequests The card selection requests of the card selections.
+     * @param multiSelectionProcessing The multi selection processing policy.
+     * @param channelControl The channel control policy.
+     * @param parsingThreadCount The maximum number of threads parsing the matching card
+     *        responses, 1 to parse them sequentially.
+     * @param compileCardSelectors True to compile the card selectors, when the scenario is reused.
+     * @throw IllegalArgumentException If the list of requests is empty.
+     * @since 2.0.0
+     */
+    CompiledCardSelectionScenario(
+        const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+        const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
+        const MultiSelectionProcessing multiSelectionProcessing,
+        const ChannelControl channelControl,
+        const int parsingThreadCount,
+        const bool compileCardSelectors);
+
+    /**
+     * (package-private)<br>
+     * Explicitly executes the scenario on a reader, as
+     * CardSelectionManager::processCardSelectionScenario does.
+     *
+     * @param reader The reader to communicate with the card.
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the reader is null or not a Keyple reader.
+     * @throw ReaderCommunicationException If the communication with the reader has failed.
+     * @throw CardCommunicationException If the communication with the card has failed.
+     * @throw InvalidCardResponseException If a card response could not be parsed.
+     * @since 2.0.0
+     */
+    const std::shared_ptr<CardSelectionResult> processCardSelectionScenario(
+        std::shared_ptr<CardReader> reader) const;
+
+    /**
+     * (package-private)<br>
+     * Executes the scenario concurrently on several readers and waits for all of them.
+     *
+     * <p>Each reader is processed on its own executor (see
+     * AbstractReaderAdapter::getExecutorService), so the duration of the call is that of the
+     * slowest reader instead of the sum of all of them.
+     *
+     * @param readers The readers to communicate with the cards, each one present only once.
+     * @return A map of the results by reader name, one for each reader.
+     * @throw IllegalArgumentException If the list is empty, contains a reader twice or a reader
+     *        which is null or not a Keyple reader.
+     * @throw ReaderCommunicationException If the communication with a reader has failed.
+     * @throw CardCommunicationException If the communication with a card has failed.
+     * @throw InvalidCardResponseException If a card response could not be parsed.
+     * @since 2.0.0
+     */
+    const std::map<std::string, std::shared_ptr<CardSelectionResult>>
+        processCardSelectionScenario(const std::vector<std::shared_ptr<CardReader>>& readers) const;
+
+    /**
+     * (package-private)<br>
+     * Executes the scenario concurrently on several readers and returns as soon as a card has been
+     * selected on one of them.
+     *
+     * <p>The scenario is no longer started on the other readers from then on. The selections
+     * still in progress end in the background on the executor of their reader and, when the
+     * channel control is KEEP_OPEN, their channel is released. The card selections and card
+     * requests later transmitted to these readers wait for the end of this background work.
+     *
+     * <p>The failure of a reader is reported only if no card has been selected on any reader.
+     *
+     * @param readers The readers to communicate with the cards, each one present only once.
+     * @return A map containing the result of the first reader on which a card has been selected,
+     *         empty if none.
+     * @throw IllegalArgumentException If the list is empty, contains a reader twice or a reader
+     *        which is null or not a Keyple reader.
+     * @throw ReaderCommunicationException If the communication with a reader has failed.
+     * @throw CardCommunicationException If the communication with a card has failed.
+     * @throw InvalidCardResponseException If a card response could not be parsed.
+     * @since 2.0.0
+     */
+    const std::map<std::string, std::shared_ptr<CardSelectionResult>>
+        processCardSelectionScenarioUntilFirstMatch(
+            const std::vector<std::shared_ptr<CardReader>>& readers) const;
+
+    /**
+     * (package-private)<br>
+     * Gets the scenario to be scheduled on an observable reader.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    const std::shared_ptr<CardSelectionScenarioAdapter>& getCardSelectionScenario() const;
+
+    /**
+     * (package-private)<br>
+     * Analyzes the responses received in return of the execution of a card selection scenario and
+     * returns the CardSelectionResult.
+     *
+     * <p>When several responses have matched (PROCESS_ALL scenarios) and more than one thread is
+     * allowed, the responses are parsed concurrently. The result is nevertheless the same as with
+     * a sequential parsing: the smart cards are added in the order of the selection indexes and
+     * the reported error is that of the lowest index.
+     *
+     * @param cardSelections The card selections, in the order of the selection indexes.
+     * @param cardSelectionResponses The card selection responses.
+     * @param parsingThreadCount The maximum number of threads parsing the matching responses.
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the list is empty.
+     * @throw InvalidCardResponseException If a card response could not be parsed.
+     * @since 2.0.0
+     */
+    static const std::shared_ptr<CardSelectionResult> processCardSelectionResponses(
+        const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+        const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponses,
+        const int parsingThreadCount);
+
+private:
+    /**
+     * (private)<br>
+     * Execution of the scenario on several readers, shared with the jobs processing the readers
+     * so that it outlives the call when it returns on the first match.
+     */
+    class ParallelSelection final {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param cardSelections The card selections.
+         * @param cardSelectionScenario The compiled scenario.
+         * @param parsingThreadCount The maximum number of threads parsing the responses.
+         * @param readerCount The number of readers.
+         * @param stopOnFirstMatch True if the selection ends on the first match.
+         */
+        ParallelSelection(
+            const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+            const std::shared_ptr<CardSelectionScenarioAdapter> cardSelectionScenario,
+            const int parsingThreadCount,
+            const size_t readerCount,
+            const bool stopOnFirstMatch);
+
+        /**
+         * Executes the scenario on a reader and records its outcome, invoked by the executor of
+         * the reader.
+         *
+         * @param index The index of the reader.
+         * @param readerAdapter The reader.
+         */
+        void run(const size_t index, const std::shared_ptr<AbstractReaderAdapter> readerAdapter);
+
+        /**
+         * Called when the jobs of the readers from the given index could not be submitted.
+         *
+         * @param index The index of the first reader not started.
+         */
+        void abort(const size_t index);
+
+        /**
+         * Waits for the end of the selection on all the readers.
+         */
+        void awaitAll();
+
+        /**
+         * Waits for the first match or for the end of the selection on all the readers.
+         *
+         * @return The index of the first matching reader, -1 if none.
+         */
+        int awaitFirstMatch();
+
+        /**
+         * Rethrows the first error in the order of the readers, if any.
+         */
+        void rethrowFirstError() const;
+
+        /**
+         * @param index The index of the reader.
+         * @return The result of the reader, null if it failed or was not processed.
+         */
+        const std::shared_ptr<CardSelectionResult> getResult(const size_t index) const;
+
+    private:
+        /**
+         *
+         */
+        const std::unique_ptr<Logger> mLogger =
+            LoggerFactory::getLogger(typeid(CompiledCardSelectionScenario));
+
+        /**
+         *
+         */
+        const std::vector<std::shared_ptr<CardSelectionSpi>> mCardSelections;
+
+        /**
+         *
+         */
+        const std::shared_ptr<CardSelectionScenarioAdapter> mCardSelectionScenario;
+
+        /**
+         *
+         */
+        const int mParsingThreadCount;
+
+        /**
+         *
+         */
+        const bool mStopOnFirstMatch;
+
+        /**
+         * Set on the first match, the scenario is no longer started on the remaining readers.
+         */
+        std::atomic<bool> mCancelled;
+
+        /**
+         * Guards all the following fields.
+         */
+        mutable std::mutex mMutex;
+        std::condition_variable mCondition;
+
+        /**
+         * Number of readers whose selection is not finished.
+         */
+        size_t mPendingCount;
+
+        /**
+         * Result and error of each reader, by reader index.
+         */
+        std::vector<std::shared_ptr<CardSelectionResult>> mResults;
+        std::vector<std::exception_ptr> mErrors;
+
+        /**
+         * Index of the first matching reader, -1 if none.
+         */
+        int mMatchingIndex;
+    };
+
+    /**
+     * (private)<br>
+     * Job executing a parallel selection on one reader.
+     */
+    class ParallelSelectionJob final : public Job {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param parallelSelection The parallel selection.
+         * @param index The index of the reader.
+         * @param readerAdapter The reader.
+         */
+        ParallelSelectionJob(const std::shared_ptr<ParallelSelection> parallelSelection,
+                             const size_t index,
+                             const std::shared_ptr<AbstractReaderAdapter> readerAdapter);
+
+        /**
+         * C++: this replaces run() override
+         */
+        void execute() final;
+
+    private:
+        /**
+         *
+         */
+        const std::shared_ptr<ParallelSelection> mParallelSelection;
+
+        /**
+         *
+         */
+        const size_t mIndex;
+
+        /**
+         *
+         */
+        const std::shared_ptr<AbstractReaderAdapter> mReaderAdapter;
+    };
+
+    /**
+     * Card selections, in the order of the selection indexes.
+     */
+    const std::vector<std::shared_ptr<CardSelectionSpi>> mCardSelections;
+
+    /**
+     * Compiled requests along with the processing policies.
+     */
+    const std::shared_ptr<CardSelectionScenarioAdapter> mCardSelectionScenario;
+
+    /**
+     * Maximum number of threads parsing the matching card responses.
+     */
+    const int mParsingThreadCount;
+
+    /**
+     * (private)<br>
+     * Compiles the card selection requests.
+     *
+     * @param cardSelectionRequests The requests provided by the card extensions.
+     * @return A list of {@link CompiledCardSelectionRequest}.
+     */
+    static std::vector<std::shared_ptr<CardSelectionRequestSpi>> compile(
+        const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests);
+
+    /**
+     * (private)<br>
+     * Gets the Keyple reader implementation of a reader.
+     *
+     * @param reader The reader.
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the reader is null or not a Keyple reader.
+     */
+    static std::shared_ptr<AbstractReaderAdapter> getReaderAdapter(
+        const std::shared_ptr<CardReader> reader);
+
+    /**
+     * (private)<br>
+     * Executes a scenario on a reader and analyzes the responses.
+     *
+     * @param cardSelections The card selections, in the order of the selection indexes.
+     * @param cardSelectionScenario The compiled scenario.
+     * @param parsingThreadCount The maximum number of threads parsing the matching responses.
+     * @param readerAdapter The reader.
+     * @return A not null reference.
+     * @throw ReaderCommunicationException If the communication with the reader has failed.
+     * @throw CardCommunicationException If the communication with the card has failed.
+     * @throw InvalidCardResponseException If a card response could not be parsed.
+     */
+    static const std::shared_ptr<CardSelectionResult> execute(
+        const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+        const std::shared_ptr<CardSelectionScenarioAdapter>& cardSelectionScenario,
+        const int parsingThreadCount,
+        const std::shared_ptr<AbstractReaderAdapter>& readerAdapter);
+
+    /**
+     * (private)<br>
+     * Invokes the parse method defined by the card extension to retrieve the smart card.
+     *
+     * @param cardSelection The card selection.
+     * @param cardSelectionResponse The matching card selection response.
+     * @return A nullable reference.
+     * @throw InvalidCardResponseException If the card response could not be parsed.
+     */
+    static std::shared_ptr<SmartCard> parse(
+        const std::shared_ptr<CardSelectionSpi>& cardSelection,
+        const std::shared_ptr<CardSelectionResponseApi>& cardSelectionResponse);
+
+    /**
+     * (private)<br>
+     * Parses concurrently the matching card selection responses on the calling thread and on the
+     * threads of the service-wide WorkerPool, each slot of the returned list being written by a
+     * single thread.
+     *
+     * @param cardSelections The card selections, in the order of the selection indexes.
+     * @param cardSelectionResponses The card selection responses.
+     * @param matchingIndexes The indexes of the matching responses.
+     * @param threadCount The maximum number of threads (at least 2).
+     * @return The smart cards, in the order of the matching indexes.
+     * @throw InvalidCardResponseException If a card response could not be parsed, the one having
+     *        the lowest index being reported.
+     */
+    static std::vector<std::shared_ptr<SmartCard>> parseInParallel(
+        const std::vector<std::shared_ptr<CardSelectionSpi>>& cardSelections,
+        const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponses,
+        const std::vector<int>& matchingIndexes,
+        const size_t threadCount);
+
+    /**
+     * (private)<br>
+     * Starts the execution of the scenario on all the readers, each one on its own thread.
+     *
+     * @param readers The readers.
+     * @param stopOnFirstMatch True if the selection ends on the first match.
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the list is empty, contains a reader twice or a reader
+     *        which is null or not a Keyple reader.
+     */
+    std::shared_ptr<ParallelSelection> startParallelSelection(
+        const std::vector<std::shared_ptr<CardReader>>& readers,
+        const bool stopOnFirstMatch) const;
+};
+
+}
+}
+}
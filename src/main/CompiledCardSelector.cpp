@@ -0,0 +1,182 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "CompiledCardSelector.h"
+
+#include <sstream>
+
+/* Keyple Core Util */
+#include "IllegalStateException.h"
+#include "System.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util::cpp;
+using namespace keyple::core::util::cpp::exception;
+
+CompiledCardSelector::CompiledCardSelector(const std::shared_ptr<CardSelectorSpi> cardSelector)
+: CompiledCardSelector(cardSelector->getCardProtocol(),
+                       cardSelector->getPowerOnDataRegex(),
+                       cardSelector->getAid(),
+                       cardSelector->getFileOccurrence(),
+                       cardSelector->getFileControlInformation(),
+                       cardSelector->getSuccessfulSelectionStatusWords()) {}
+
+CompiledCardSelector::CompiledCardSelector(
+    const std::string& cardProtocol,
+    const std::string& powerOnDataRegex,
+    const std::vector<uint8_t>& aid,
+    const FileOccurrence fileOccurrence,
+    const FileControlInformation fileControlInformation,
+    const std::vector<int>& successfulSelectionStatusWords)
+: mCardProtocol(cardProtocol),
+  mPowerOnDataRegex(powerOnDataRegex),
+  mAid(aid),
+  mFileOccurrence(fileOccurrence),
+  mFileControlInformation(fileControlInformation),
+  mSuccessfulSelectionStatusWords(successfulSelectionStatusWords),
+  mSelectApplicationP2(computeSelectApplicationP2(mFileOccurrence, mFileControlInformation)),
+  mSelectApplicationCommand(mAid.empty() ?
+                                std::vector<uint8_t>() :
+                                buildSelectApplicationCommand(mAid, mSelectApplicationP2)),
+  mCompiledPowerOnDataRegex(mPowerOnDataRegex.empty() ?
+                                nullptr :
+                                new std::regex(mPowerOnDataRegex, std::regex::optimize)),
+  mSuccessfulSelectionStatusWordSet(mSuccessfulSelectionStatusWords.begin(),
+                                    mSuccessfulSelectionStatusWords.end()) {}
+
+const std::string& CompiledCardSelector::getCardProtocol() const
+{
+    return mCardProtocol;
+}
+
+const std::string& CompiledCardSelector::getPowerOnDataRegex() const
+{
+    return mPowerOnDataRegex;
+}
+
+const std::vector<uint8_t> CompiledCardSelector::getAid() const
+{
+    return mAid;
+}
+
+CardSelectorSpi::FileOccurrence CompiledCardSelector::getFileOccurrence() const
+{
+    return mFileOccurrence;
+}
+
+CardSelectorSpi::FileControlInformation CompiledCardSelector::getFileControlInformation() const
+{
+    return mFileControlInformation;
+}
+
+const std::vector<int>& CompiledCardSelector::getSuccessfulSelectionStatusWords() const
+{
+    return mSuccessfulSelectionStatusWords;
+}
+
+uint8_t CompiledCardSelector::getSelectApplicationP2() const
+{
+    return mSelectApplicationP2;
+}
+
+const std::vector<uint8_t>& CompiledCardSelector::getSelectApplicationCommand() const
+{
+    return mSelectApplicationCommand;
+}
+
+bool CompiledCardSelector::matchesPowerOnData(const std::string& powerOnData) const
+{
+    return powerOnData == "" ||
+           mCompiledPowerOnDataRegex == nullptr ||
+           std::regex_match(powerOnData, *mCompiledPowerOnDataRegex);
+}
+
+bool CompiledCardSelector::isSuccessfulSelectionStatusWord(const int statusWord) const
+{
+    return mSuccessfulSelectionStatusWordSet.count(statusWord) != 0;
+}
+
+uint8_t CompiledCardSelector::computeSelectApplicationP2(
+    const FileOccurrence fileOccurrence, const FileControlInformation fileControlInformation)
+{
+    uint8_t p2;
+
+    switch (fileOccurrence) {
+    case FileOccurrence::FIRST:
+        p2 = 0x00;
+        break;
+    case FileOccurrence::LAST:
+        p2 = 0x01;
+        break;
+    case FileOccurrence::NEXT:
+        p2 = 0x02;
+        break;
+    case FileOccurrence::PREVIOUS:
+        p2 = 0x03;
+        break;
+    default:
+        std::stringstream ss;
+        ss << fileOccurrence;
+        throw IllegalStateException("Unexpected value: " + ss.str());
+    }
+
+    switch (fileControlInformation) {
+    case FileControlInformation::FCI:
+        p2 |= 0x00;
+        break;
+    case FileControlInformation::FCP:
+        p2 |= 0x04;
+        break;
+    case FileControlInformation::FMD:
+        p2 |= 0x08;
+        break;
+    case FileControlInformation::NO_RESPONSE:
+        p2 |= 0x0C;
+        break;
+    default:
+        std::stringstream ss;
+        ss << fileOccurrence;
+        throw IllegalStateException("Unexpected value: " + ss.str());
+    }
+
+    return p2;
+}
+
+std::vector<uint8_t> CompiledCardSelector::buildSelectApplicationCommand(
+    const std::vector<uint8_t>& aid, const uint8_t p2)
+{
+    /*
+     * RL-SEL-CLA.1
+     * RL-SEL-P2LC.1
+     */
+    std::vector<uint8_t> selectApplicationCommand(6 + aid.size());
+    selectApplicationCommand[0] = 0x00; /* CLA */
+    selectApplicationCommand[1] = 0xA4; /* INS */
+    selectApplicationCommand[2] = 0x04; /* P1: select by name */
+    /*
+     * P2: b0,b1 define the File occurrence, b2,b3 define the File control information
+     * we use the bitmask defined in the respective enums
+     */
+    selectApplicationCommand[3] = p2;
+    selectApplicationCommand[4] = static_cast<uint8_t>(aid.size()); /* Lc */
+    System::arraycopy(aid, 0, selectApplicationCommand, 5, static_cast<int>(aid.size()));
+    selectApplicationCommand[5 + aid.size()] = 0x00; /* Le */
+
+    return selectApplicationCommand;
+}
+
+}
+}
+}
@@ -0,0 +1,244 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <regex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/* Calypsonet Terminal Card */
+#include "CardSelectorSpi.h"
+
+/* Keyple Core Service */
+#include "KeypleServiceExport.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace calypsonet::terminal::card::spi;
+
+/**
+ * (package-private)<br>
+ * Immutable copy of a {@link CardSelectorSpi}, along with everything the reader derives from it at
+ * each selection: the P2 parameter and the bytes of the Select Application command, the compiled
+ * power-on data regex and the set of successful status words.
+ *
+ * <p>Built once when a card selection scenario is compiled, then shared by the readers which
+ * execute it, possibly concurrently.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API CompiledCardSelector final : public CardSelectorSpi {
+public:
+    /**
+     * (package-private)<br>
+     * Constructor.
+     *
+     * @param cardSelector The card selector provided by the card extension.
+     * @throw IllegalStateException If the file occurrence or the file control information is
+     *        unexpected.
+     * @throw std::regex_error If the power-on data regex is invalid.
+     * @since 2.0.0
+     */
+    explicit CompiledCardSelector(const std::shared_ptr<CardSelectorSpi> cardSelector);
+
+    /**
+     * (package-private)<br>
+     * Constructor from the values of a card selector, used when a serialized card selection
+     * scenario is restored.
+     *
+     * @param cardProtocol The card protocol, empty if none.
+     * @param powerOnDataRegex The power-on data regex, empty if none.
+     * @param aid The AID, empty if none.
+     * @param fileOccurrence The file occurrence.
+     * @param fileControlInformation The file control information.
+     * @param successfulSelectionStatusWords The successful status words of the selection.
+     * @throw IllegalStateException If the file occurrence or the file control information is
+     *        unexpected.
+     * @throw std::regex_error If the power-on data regex is invalid.
+     * @since 2.0.0
+     */
+    CompiledCardSelector(const std::string& cardProtocol,
+                         const std::string& powerOnDataRegex,
+                         const std::vector<uint8_t>& aid,
+                         const FileOccurrence fileOccurrence,
+                         const FileControlInformation fileControlInformation,
+                         const std::vector<int>& successfulSelectionStatusWords);
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    const std::string& getCardProtocol() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    const std::string& getPowerOnDataRegex() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    const std::vector<uint8_t> getAid() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    FileOccurrence getFileOccurrence() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    FileControlInformation getFileControlInformation() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    const std::vector<int>& getSuccessfulSelectionStatusWords() const override;
+
+    /**
+     * (package-private)<br>
+     * Gets the P2 parameter of the Select Application command.
+     *
+     * @return A byte.
+     * @since 2.0.0
+     */
+    uint8_t getSelectApplicationP2() const;
+
+    /**
+     * (package-private)<br>
+     * Gets the Select Application command.
+     *
+     * @return An empty array if the selector has no AID.
+     * @since 2.0.0
+     */
+    const std::vector<uint8_t>& getSelectApplicationCommand() const;
+
+    /**
+     * (package-private)<br>
+     * Checks the provided power-on data with the compiled regex.
+     *
+     * @param powerOnData The power-on data.
+     * @return True if there is no power-on data, no filter, or if the filter matches.
+     * @since 2.0.0
+     */
+    bool matchesPowerOnData(const std::string& powerOnData) const;
+
+    /**
+     * (package-private)<br>
+     * Indicates whether a status word is one of the successful selection status words.
+     *
+     * @param statusWord The status word.
+     * @return True or false.
+     * @since 2.0.0
+     */
+    bool isSuccessfulSelectionStatusWord(const int statusWord) const;
+
+    /**
+     * (package-private)<br>
+     * Computes the P2 parameter of the ISO7816-4 Select Application APDU command from the provided
+     * FileOccurrence and FileControlInformation.
+     *
+     * @param fileOccurrence The file's position relative to the current file.
+     * @param fileControlInformation The file control information output.
+     * @return A byte.
+     * @throw IllegalStateException If one of the provided argument is unexpected.
+     * @since 2.0.0
+     */
+    static uint8_t computeSelectApplicationP2(const FileOccurrence fileOccurrence,
+                                              const FileControlInformation fileControlInformation);
+
+    /**
+     * (package-private)<br>
+     * Builds the ISO7816-4 Select Application APDU command.
+     *
+     * <p>The actual length expected by the card is handled by the reader (get response).
+     *
+     * @param aid The AID.
+     * @param p2 The P2 parameter.
+     * @return A not empty array.
+     * @since 2.0.0
+     */
+    static std::vector<uint8_t> buildSelectApplicationCommand(const std::vector<uint8_t>& aid,
+                                                              const uint8_t p2);
+
+private:
+    /**
+     *
+     */
+    const std::string mCardProtocol;
+
+    /**
+     *
+     */
+    const std::string mPowerOnDataRegex;
+
+    /**
+     *
+     */
+    const std::vector<uint8_t> mAid;
+
+    /**
+     *
+     */
+    const FileOccurrence mFileOccurrence;
+
+    /**
+     *
+     */
+    const FileControlInformation mFileControlInformation;
+
+    /**
+     *
+     */
+    const std::vector<int> mSuccessfulSelectionStatusWords;
+
+    /**
+     *
+     */
+    const uint8_t mSelectApplicationP2;
+
+    /**
+     *
+     */
+    const std::vector<uint8_t> mSelectApplicationCommand;
+
+    /**
+     * Null if there is no power-on data filter.
+     */
+    const std::unique_ptr<const std::regex> mCompiledPowerOnDataRegex;
+
+    /**
+     *
+     */
+    const std::unordered_set<int> mSuccessfulSelectionStatusWordSet;
+};
+
+}
+}
+}
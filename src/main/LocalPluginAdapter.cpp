@@ -12,15 +12,23 @@
 
 #include "LocalPluginAdapter.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+
 /* Keyple Core Service */
 #include "LocalReaderAdapter.h"
 #include "ObservableLocalReaderAdapter.h"
+#include "ParallelReaderRegistrationSpi.h"
+#include "WorkerPool.h"
 
 namespace keyple {
 namespace core {
 namespace service {
 
 using namespace keyple::core::plugin::spi::reader::observable;
+using namespace keyple::core::service::spi;
 
 LocalPluginAdapter::LocalPluginAdapter(std::shared_ptr<PluginSpi> pluginSpi)
 : AbstractPluginAdapter(pluginSpi ? pluginSpi->getName() : "",
@@ -40,11 +48,84 @@ void LocalPluginAdapter::doRegister()
     const std::vector<std::shared_ptr<ReaderSpi>> readerSpiList =
         mPluginSpi->searchAvailableReaders();
 
-    for (const auto& readerSpi : readerSpiList) {
-        std::shared_ptr<LocalReaderAdapter> localReaderAdapter = buildLocalReaderAdapter(readerSpi);
-        getReadersMap().insert({readerSpi->getName(), localReaderAdapter});
-        localReaderAdapter->doRegister();
+    const auto parallelSpi = std::dynamic_pointer_cast<ParallelReaderRegistrationSpi>(mPluginSpi);
+    const int threadCount = parallelSpi ? parallelSpi->getReaderRegistrationThreadCount() : 1;
+
+    if (threadCount > 1 && readerSpiList.size() > 1) {
+        registerReadersInParallel(readerSpiList, static_cast<size_t>(threadCount));
+        return;
+    }
+
+    /* The readers are published in a single snapshot, the map is copied once */
+    std::vector<std::shared_ptr<Reader>> adapters;
+    adapters.reserve(readerSpiList.size());
+
+    try {
+        for (const auto& readerSpi : readerSpiList) {
+            std::shared_ptr<LocalReaderAdapter> localReaderAdapter =
+                buildLocalReaderAdapter(readerSpi);
+            adapters.push_back(localReaderAdapter);
+            localReaderAdapter->doRegister();
+        }
+    } catch (...) {
+        /* As before, the readers already built remain known by the plugin */
+        addReadersToMap(adapters);
+        throw;
+    }
+
+    addReadersToMap(adapters);
+}
+
+void LocalPluginAdapter::registerReadersInParallel(
+    const std::vector<std::shared_ptr<ReaderSpi>>& readerSpiList, const size_t threadCount)
+{
+    std::vector<std::shared_ptr<LocalReaderAdapter>> adapters(readerSpiList.size());
+    std::atomic<size_t> nextIndex(0);
+    std::exception_ptr firstError = nullptr;
+    std::mutex errorMutex;
+
+    /* Each slot is written by a single thread, the order of the readers is kept */
+    auto worker = [&]() {
+        size_t i;
+        while ((i = nextIndex++) < readerSpiList.size()) {
+            try {
+                std::shared_ptr<LocalReaderAdapter> adapter =
+                    buildLocalReaderAdapter(readerSpiList[i]);
+                adapter->doRegister();
+                adapters[i] = adapter;
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (firstError == nullptr) {
+                    firstError = std::current_exception();
+                }
+
+                /* Stops the other threads as soon as possible */
+                nextIndex = readerSpiList.size();
+            }
+        }
+    };
+
+    WorkerPool::getInstance()->run(worker, std::min(threadCount, readerSpiList.size()));
+
+    if (firstError != nullptr) {
+        for (const auto& adapter : adapters) {
+            if (adapter == nullptr) {
+                continue;
+            }
+
+            try {
+                adapter->doUnregister();
+            } catch (const Exception& e) {
+                mLogger->error("Error during the unregistration of reader '%'\n",
+                               adapter->getName(),
+                               e);
+            }
+        }
+
+        std::rethrow_exception(firstError);
     }
+
+    addReadersToMap(std::vector<std::shared_ptr<Reader>>(adapters.begin(), adapters.end()));
 }
 
 void LocalPluginAdapter::doUnregister()
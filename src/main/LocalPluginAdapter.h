@@ -13,6 +13,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 /* Keyple Core Service */
 #include "AbstractPluginAdapter.h"
@@ -56,6 +57,9 @@ public:
      *
      * <p>Populates its list of available readers and registers each of them.
      *
+     * <p>If the SPI implements {@link ParallelReaderRegistrationSpi}, the readers are built and
+     * registered concurrently, then published in a single snapshot.
+     *
      * @since 2.0.0
      */
     virtual void doRegister() override final;
@@ -79,6 +83,20 @@ private:
      *
      */
     std::shared_ptr<PluginSpi> mPluginSpi;
+
+    /**
+     * (private)<br>
+     * Builds and registers the readers on the calling thread and on the threads of the
+     * service-wide WorkerPool, then publishes them all at once.
+     *
+     * <p>If a reader fails to be built, the readers already registered are unregistered and the
+     * first exception is rethrown.
+     *
+     * @param readerSpiList The reader SPIs found by the plugin.
+     * @param threadCount The maximum number of threads to use (at least 2).
+     */
+    void registerReadersInParallel(const std::vector<std::shared_ptr<ReaderSpi>>& readerSpiList,
+                                   const size_t threadCount);
 };
 
 }
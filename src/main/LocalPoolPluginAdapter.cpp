@@ -12,11 +12,14 @@
 
 #include "LocalPoolPluginAdapter.h"
 
+#include <algorithm>
+
 /* Keyple Core Plugin */
 #include "KeyplePluginException.h"
 #include "PluginIOException.h"
 
 /* Keyple Core Util */
+#include "IllegalStateException.h"
 #include "KeypleAssert.h"
 
 /* Keyple Core Service */
@@ -30,11 +33,43 @@ namespace service {
 using namespace keyple::core::plugin;
 using namespace keyple::core::plugin::spi::reader::observable;
 using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+const size_t LocalPoolPluginAdapter::WARM_ADAPTERS_MAX_COUNT = 256;
+const double LocalPoolPluginAdapter::LATENCY_SMOOTHING_FACTOR = 0.2;
 
 LocalPoolPluginAdapter::LocalPoolPluginAdapter(std::shared_ptr<PoolPluginSpi> poolPluginSpi)
 : AbstractPluginAdapter(poolPluginSpi->getName(),
                         std::dynamic_pointer_cast<KeyplePluginExtension>(poolPluginSpi)),
-  mPoolPluginSpi(poolPluginSpi) {}
+  mPoolPluginSpi(poolPluginSpi)
+{
+    const auto metrics = MetricsRegistry::getInstance();
+    const std::map<std::string, std::string> labels = {{"plugin", getName()}};
+
+    mWarmAdapterHitCounter = metrics->getCounter(MetricsRegistry::POOL_WARM_ADAPTER_HIT,
+                                                 "Number of reader allocations served by a " \
+                                                 "warm adapter.",
+                                                 labels);
+    mWarmAdapterMissCounter = metrics->getCounter(MetricsRegistry::POOL_WARM_ADAPTER_MISS,
+                                                  "Number of reader allocations requiring a " \
+                                                  "new adapter.",
+                                                  labels);
+    mActiveLeaseGauge = metrics->getGauge(MetricsRegistry::POOL_LEASE_ACTIVE,
+                                          "Number of reader leases currently active.",
+                                          labels);
+    mGrantedLeaseCounter = metrics->getCounter(MetricsRegistry::POOL_LEASE_GRANTED,
+                                               "Number of reader leases granted.",
+                                               labels);
+    mReclaimedLeaseCounter = metrics->getCounter(MetricsRegistry::POOL_LEASE_RECLAIMED,
+                                                 "Number of readers reclaimed after the " \
+                                                 "expiration of their lease.",
+                                                 labels);
+}
+
+LocalPoolPluginAdapter::~LocalPoolPluginAdapter()
+{
+    endLeases();
+}
 
 void LocalPoolPluginAdapter::doUnregister()
 {
@@ -46,7 +81,22 @@ void LocalPoolPluginAdapter::doUnregister()
                        e);
     }
 
+    endLeases();
+
     AbstractPluginAdapter::doUnregister();
+
+    {
+        std::lock_guard<std::mutex> lock(mWarmAdaptersMutex);
+        mWarmAdapters.clear();
+    }
+
+    /* The waiters notice the unregistration and leave their queue */
+    std::lock_guard<std::mutex> lock(mAllocationMutex);
+    for (const auto& entry : mWaitQueues) {
+        for (const auto& waiter : entry.second.mWaiters) {
+            waiter->mCondition.notify_one();
+        }
+    }
 }
 
 const std::vector<std::string> LocalPoolPluginAdapter::getReaderGroupReferences() const
@@ -76,6 +126,7 @@ std::shared_ptr<Reader> LocalPoolPluginAdapter::allocateReader(
     Assert::getInstance().notEmpty(readerGroupReference, "readerGroupReference");
 
     std::shared_ptr<ReaderSpi> readerSpi = nullptr;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
     try {
         readerSpi = mPoolPluginSpi->allocateReader(readerGroupReference);
@@ -90,13 +141,195 @@ std::shared_ptr<Reader> LocalPoolPluginAdapter::allocateReader(
                                     std::make_shared<PluginIOException>(e));
     }
 
-    std::shared_ptr<LocalReaderAdapter> localReaderAdapter = buildLocalReaderAdapter(readerSpi);
-    getReadersMap().insert({localReaderAdapter->getName(), localReaderAdapter});
+    std::shared_ptr<LocalReaderAdapter> localReaderAdapter =
+        takeOrBuildLocalReaderAdapter(readerSpi);
+    addReaderToMap(localReaderAdapter);
     localReaderAdapter->doRegister();
 
+    const double latencyMicros = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count());
+
+    {
+        std::lock_guard<std::mutex> lock(mAllocationMutex);
+        Allocation& allocation = mAllocations[localReaderAdapter->getName()];
+        allocation.mGroupReference = readerGroupReference;
+        allocation.mId = ++mLastAllocationId;
+        allocation.mIsReleasing = false;
+
+        GroupLoad& groupLoad = mGroupLoads[readerGroupReference];
+        groupLoad.mAllocatedCount++;
+        groupLoad.mLatencyMicros = groupLoad.mLatencyMicros == 0 ?
+                                   latencyMicros :
+                                   LATENCY_SMOOTHING_FACTOR * latencyMicros +
+                                   (1 - LATENCY_SMOOTHING_FACTOR) * groupLoad.mLatencyMicros;
+    }
+
     return localReaderAdapter;
 }
 
+std::shared_ptr<Reader> LocalPoolPluginAdapter::allocateReader(
+    const std::string& readerGroupReference, const long timeoutMillis)
+{
+    checkStatus();
+
+    Assert::getInstance().notEmpty(readerGroupReference, "readerGroupReference")
+                         .isTrue(timeoutMillis >= 0, "timeoutMillis >= 0");
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const std::chrono::steady_clock::time_point deadline =
+        start + std::chrono::milliseconds(timeoutMillis);
+
+    auto waiter = std::make_shared<Waiter>();
+    std::shared_ptr<Reader> reader = nullptr;
+    std::shared_ptr<KeyplePluginException> lastError = nullptr;
+    bool hasWaited = false;
+
+    std::unique_lock<std::mutex> lock(mAllocationMutex);
+
+    WaitQueue& waitQueue = getWaitQueue(readerGroupReference);
+    waitQueue.mWaiters.push_back(waiter);
+    waitQueue.mDepthGauge->increment();
+
+    /* Only the first of the queue tries at once, the others wait for their turn */
+    waiter->mMayTry = waitQueue.mWaiters.front() == waiter;
+
+    while (true) {
+        if (waiter->mMayTry) {
+            waiter->mMayTry = false;
+
+            lock.unlock();
+            try {
+                reader = allocateReader(readerGroupReference);
+            } catch (const KeyplePluginException& e) {
+                lastError = std::make_shared<KeyplePluginException>(e);
+            } catch (const IllegalStateException& e) {
+                /* Unregistered meanwhile, handled below */
+                (void)e;
+            } catch (...) {
+                lock.lock();
+                removeWaiter(waitQueue, waiter);
+                throw;
+            }
+            lock.lock();
+
+            if (reader != nullptr) {
+                break;
+            }
+        }
+
+        try {
+            checkStatus();
+        } catch (const IllegalStateException& e) {
+            (void)e;
+            removeWaiter(waitQueue, waiter);
+            throw;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            removeWaiter(waitQueue, waiter);
+            waitQueue.mTimeoutCounter->increment();
+
+            const std::string message = "The pool plugin '" +
+                                        getName() +
+                                        "' has no reader of the reader group reference " +
+                                        readerGroupReference +
+                                        " available within " +
+                                        std::to_string(timeoutMillis) +
+                                        " ms";
+            if (lastError != nullptr) {
+                throw KeyplePluginException(message, lastError);
+            }
+            throw KeyplePluginException(message);
+        }
+
+        /* A release during the failed attempt is not missed, it has set mMayTry */
+        hasWaited = true;
+        waiter->mCondition.wait_until(lock, deadline, [&waiter]() { return waiter->mMayTry; });
+    }
+
+    removeWaiter(waitQueue, waiter);
+
+    if (hasWaited) {
+        waitQueue.mWaitCounter->increment();
+        waitQueue.mWaitMicrosCounter->increment(
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                      std::chrono::steady_clock::now() - start).count()));
+    }
+
+    return reader;
+}
+
+std::future<std::shared_ptr<Reader>> LocalPoolPluginAdapter::allocateReaderAsync(
+    const std::string& readerGroupReference, const long timeoutMillis)
+{
+    return std::async(std::launch::async, [this, readerGroupReference, timeoutMillis]() {
+        return allocateReader(readerGroupReference, timeoutMillis);
+    });
+}
+
+std::shared_ptr<Reader> LocalPoolPluginAdapter::allocateReader(
+    const std::vector<std::string>& readerGroupReferences,
+    const ReaderGroupSelectionStrategy strategy)
+{
+    checkStatus();
+
+    Assert::getInstance().notEmpty(readerGroupReferences, "readerGroupReferences");
+
+    std::shared_ptr<KeyplePluginException> lastError = nullptr;
+
+    for (const auto& readerGroupReference : orderGroupReferences(readerGroupReferences, strategy)) {
+        try {
+            return allocateReader(readerGroupReference);
+        } catch (const KeyplePluginException& e) {
+            mLogger->debug("The pool plugin '%' failed to allocate a reader of the group " \
+                           "reference '%', trying the next one\n",
+                           getName(),
+                           readerGroupReference);
+            lastError = std::make_shared<KeyplePluginException>(e);
+        }
+    }
+
+    throw KeyplePluginException("The pool plugin '" +
+                                getName() +
+                                "' is unable to allocate a reader in any of the " +
+                                std::to_string(readerGroupReferences.size()) +
+                                " group references",
+                                lastError);
+}
+
+std::shared_ptr<ReaderLease> LocalPoolPluginAdapter::leaseReader(
+    const std::string& readerGroupReference, const long durationMillis)
+{
+    checkStatus();
+
+    Assert::getInstance().isTrue(durationMillis > 0, "durationMillis > 0");
+
+    const std::shared_ptr<Reader> reader = allocateReader(readerGroupReference);
+    auto lease = std::make_shared<ReaderLeaseAdapter>(reader,
+                                                      getAllocationId(reader->getName()),
+                                                      durationMillis,
+                                                      this);
+
+    {
+        std::lock_guard<std::mutex> lock(mLeasesMutex);
+
+        mLeases[reader->getName()] = lease;
+        mLeasesChanged = true;
+        mActiveLeaseGauge->increment();
+
+        if (!mSweeperRunning) {
+            mSweeperRunning = true;
+            mSweeper = std::thread(&LocalPoolPluginAdapter::sweepLeases, this);
+        }
+    }
+
+    mLeasesCondition.notify_one();
+    mGrantedLeaseCounter->increment();
+
+    return lease;
+}
+
 void LocalPoolPluginAdapter::releaseReader(std::shared_ptr<Reader> reader)
 {
     checkStatus();
@@ -107,28 +340,418 @@ void LocalPoolPluginAdapter::releaseReader(std::shared_ptr<Reader> reader)
 
     Assert::getInstance().notNull(reader, "reader");
 
+    if (getReader(reader->getName()) != reader) {
+        mLogger->warn("The reader '%' is not allocated by the pool plugin '%', ignored\n",
+                      reader->getName(),
+                      getName());
+        return;
+    }
+
+    std::shared_ptr<ReaderLeaseAdapter> lease = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mLeasesMutex);
+
+        const auto it = mLeases.find(reader->getName());
+        if (it != mLeases.end()) {
+            lease = it->second.lock();
+        }
+    }
+
+    if (lease != nullptr) {
+        /* The lease is ended here unless the sweeper (or its holder) has ended it first */
+        if (!lease->end()) {
+            mLogger->debug("The lease of the reader '%' has already been ended, ignored\n",
+                           reader->getName());
+            return;
+        }
+
+        releaseLeasedReader(reader, lease->getAllocationId());
+        return;
+    }
+
+    if (claimRelease(reader->getName(), 0)) {
+        releaseLocalReaderAdapter(std::dynamic_pointer_cast<LocalReaderAdapter>(reader), true);
+    }
+}
+
+void LocalPoolPluginAdapter::releaseLeasedReader(const std::shared_ptr<Reader> reader,
+                                                 const uint64_t allocationId)
+{
+    checkStatus();
+
+    forgetLease(reader->getName(), allocationId);
+
+    if (claimRelease(reader->getName(), allocationId)) {
+        releaseLocalReaderAdapter(std::dynamic_pointer_cast<LocalReaderAdapter>(reader), true);
+    }
+}
+
+void LocalPoolPluginAdapter::releaseLocalReaderAdapter(
+    std::shared_ptr<LocalReaderAdapter> localReaderAdapter, const bool keepAdapterWarm)
+{
+    const std::string& readerName = localReaderAdapter->getName();
+
     try {
-        mPoolPluginSpi->releaseReader(
-            std::dynamic_pointer_cast<LocalReaderAdapter>(reader)->getReaderSpi());
+        mPoolPluginSpi->releaseReader(localReaderAdapter->getReaderSpi());
 
         /* Java 'finally' code moved here */
-        getReadersMap().erase(reader->getName());
-        std::dynamic_pointer_cast<LocalReaderAdapter>(reader)->doUnregister();
+        removeReaderFromMap(readerName);
+        localReaderAdapter->doUnregister();
+
+        if (keepAdapterWarm) {
+            keepWarm(localReaderAdapter);
+        }
+        onReaderReleased(readerName);
     } catch (const PluginIOException& e) {
         /* Java 'finally' code moved here */
-        getReadersMap().erase(reader->getName());
-        std::dynamic_pointer_cast<LocalReaderAdapter>(reader)->doUnregister();
+        removeReaderFromMap(readerName);
+        localReaderAdapter->doUnregister();
+        onReaderReleased(readerName);
 
         throw KeyplePluginException("The pool plugin '" +
                                     getName() +
                                     "' is unable to release the reader '" +
-                                    reader->getName() +
+                                    readerName +
                                     "' : " +
                                     e.getMessage(),
                                     std::make_shared<PluginIOException>(e));
     }
 }
 
+size_t LocalPoolPluginAdapter::getWarmAdapterCount() const
+{
+    std::lock_guard<std::mutex> lock(mWarmAdaptersMutex);
+
+    return mWarmAdapters.size();
+}
+
+size_t LocalPoolPluginAdapter::getAllocatedReaderCount(const std::string& readerGroupReference)
+{
+    std::lock_guard<std::mutex> lock(mAllocationMutex);
+
+    const auto it = mGroupLoads.find(readerGroupReference);
+
+    return it != mGroupLoads.end() ? it->second.mAllocatedCount : 0;
+}
+
+LocalPoolPluginAdapter::WaitQueue& LocalPoolPluginAdapter::getWaitQueue(
+    const std::string& readerGroupReference)
+{
+    const auto it = mWaitQueues.find(readerGroupReference);
+    if (it != mWaitQueues.end()) {
+        return it->second;
+    }
+
+    const auto metrics = MetricsRegistry::getInstance();
+    const std::map<std::string, std::string> labels = {{"plugin", getName()},
+                                                       {"group", readerGroupReference}};
+
+    WaitQueue& waitQueue = mWaitQueues[readerGroupReference];
+    waitQueue.mDepthGauge = metrics->getGauge(MetricsRegistry::POOL_ALLOCATION_QUEUE_DEPTH,
+                                              "Number of callers waiting for a reader.",
+                                              labels);
+    waitQueue.mWaitCounter = metrics->getCounter(MetricsRegistry::POOL_ALLOCATION_WAIT,
+                                                 "Number of allocations which had to wait " \
+                                                 "for a reader.",
+                                                 labels);
+    waitQueue.mWaitMicrosCounter =
+        metrics->getCounter(MetricsRegistry::POOL_ALLOCATION_WAIT_MICROSECONDS,
+                            "Cumulated waiting time of the allocations which had to wait.",
+                            labels);
+    waitQueue.mTimeoutCounter = metrics->getCounter(MetricsRegistry::POOL_ALLOCATION_TIMEOUT,
+                                                    "Number of allocations which timed out.",
+                                                    labels);
+
+    return waitQueue;
+}
+
+void LocalPoolPluginAdapter::wakeUpFirstWaiter(WaitQueue& waitQueue)
+{
+    if (!waitQueue.mWaiters.empty()) {
+        waitQueue.mWaiters.front()->mMayTry = true;
+        waitQueue.mWaiters.front()->mCondition.notify_one();
+    }
+}
+
+void LocalPoolPluginAdapter::removeWaiter(WaitQueue& waitQueue,
+                                          const std::shared_ptr<Waiter>& waiter)
+{
+    const bool wasFirst = waitQueue.mWaiters.front() == waiter;
+
+    for (auto it = waitQueue.mWaiters.begin(); it != waitQueue.mWaiters.end(); ++it) {
+        if (*it == waiter) {
+            waitQueue.mWaiters.erase(it);
+            waitQueue.mDepthGauge->decrement();
+            break;
+        }
+    }
+
+    /* Some readers may still be available for the next one */
+    if (wasFirst) {
+        wakeUpFirstWaiter(waitQueue);
+    }
+}
+
+void LocalPoolPluginAdapter::wakeUpLeaseSweeper()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLeasesMutex);
+        mLeasesChanged = true;
+    }
+
+    mLeasesCondition.notify_one();
+}
+
+uint64_t LocalPoolPluginAdapter::getAllocationId(const std::string& readerName)
+{
+    std::lock_guard<std::mutex> lock(mAllocationMutex);
+
+    const auto it = mAllocations.find(readerName);
+
+    return it != mAllocations.end() ? it->second.mId : 0;
+}
+
+bool LocalPoolPluginAdapter::claimRelease(const std::string& readerName,
+                                          const uint64_t allocationId)
+{
+    std::lock_guard<std::mutex> lock(mAllocationMutex);
+
+    const auto it = mAllocations.find(readerName);
+    if (it == mAllocations.end() ||
+        it->second.mIsReleasing ||
+        (allocationId != 0 && it->second.mId != allocationId)) {
+        return false;
+    }
+
+    it->second.mIsReleasing = true;
+
+    return true;
+}
+
+void LocalPoolPluginAdapter::forgetLease(const std::string& readerName,
+                                         const uint64_t allocationId)
+{
+    std::lock_guard<std::mutex> lock(mLeasesMutex);
+
+    const auto it = mLeases.find(readerName);
+    if (it == mLeases.end()) {
+        return;
+    }
+
+    /* An expired entry is the one of a lease being destroyed */
+    const std::shared_ptr<ReaderLeaseAdapter> lease = it->second.lock();
+    if (lease != nullptr && lease->getAllocationId() != allocationId) {
+        return;
+    }
+
+    mLeases.erase(it);
+    mActiveLeaseGauge->decrement();
+}
+
+void LocalPoolPluginAdapter::sweepLeases()
+{
+    while (true) {
+        std::vector<std::weak_ptr<ReaderLeaseAdapter>> leases;
+
+        {
+            std::lock_guard<std::mutex> lock(mLeasesMutex);
+
+            if (!mSweeperRunning) {
+                return;
+            }
+
+            mLeasesChanged = false;
+            for (const auto& entry : mLeases) {
+                leases.push_back(entry.second);
+            }
+        }
+
+        /*
+         * The leases are inspected outside of the lock: the sweeper may hold the last reference
+         * to a lease, whose destruction releases the reader.
+         */
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point nextDeadline = now;
+        bool hasNextDeadline = false;
+
+        for (const auto& weakLease : leases) {
+            const std::shared_ptr<ReaderLeaseAdapter> lease = weakLease.lock();
+            if (lease == nullptr) {
+                continue;
+            }
+
+            const std::chrono::steady_clock::time_point deadline = lease->getDeadline();
+
+            if (deadline > now) {
+                if (!hasNextDeadline || deadline < nextDeadline) {
+                    nextDeadline = deadline;
+                    hasNextDeadline = true;
+                }
+            } else if (lease->end()) {
+                const std::shared_ptr<Reader> reader = lease->getReader();
+
+                mLogger->warn("The lease of the reader '%' of the pool plugin '%' has expired, " \
+                              "reclaiming the reader\n",
+                              reader->getName(),
+                              getName());
+
+                forgetLease(reader->getName(), lease->getAllocationId());
+
+                /* The holder may have released the reader meanwhile, and it may be reallocated */
+                if (!claimRelease(reader->getName(), lease->getAllocationId())) {
+                    continue;
+                }
+
+                try {
+                    releaseLocalReaderAdapter(
+                        std::dynamic_pointer_cast<LocalReaderAdapter>(reader), false);
+                } catch (const Exception& e) {
+                    mLogger->error("Error while reclaiming the reader '%'\n", reader->getName(), e);
+                }
+
+                mReclaimedLeaseCounter->increment();
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(mLeasesMutex);
+
+        const auto hasChanged = [this]() { return !mSweeperRunning || mLeasesChanged; };
+
+        if (hasNextDeadline) {
+            mLeasesCondition.wait_until(lock, nextDeadline, hasChanged);
+        } else {
+            mLeasesCondition.wait(lock, hasChanged);
+        }
+    }
+}
+
+void LocalPoolPluginAdapter::endLeases()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLeasesMutex);
+        mSweeperRunning = false;
+    }
+
+    mLeasesCondition.notify_all();
+
+    if (mSweeper.joinable()) {
+        mSweeper.join();
+    }
+
+    std::vector<std::shared_ptr<ReaderLeaseAdapter>> leases;
+
+    {
+        std::lock_guard<std::mutex> lock(mLeasesMutex);
+
+        for (const auto& entry : mLeases) {
+            const std::shared_ptr<ReaderLeaseAdapter> lease = entry.second.lock();
+            if (lease != nullptr) {
+                leases.push_back(lease);
+            }
+            mActiveLeaseGauge->decrement();
+        }
+        mLeases.clear();
+    }
+
+    for (const auto& lease : leases) {
+        lease->end();
+    }
+}
+
+std::vector<std::string> LocalPoolPluginAdapter::orderGroupReferences(
+    const std::vector<std::string>& readerGroupReferences,
+    const ReaderGroupSelectionStrategy strategy)
+{
+    std::vector<std::string> ordered(readerGroupReferences);
+
+    std::lock_guard<std::mutex> lock(mAllocationMutex);
+
+    switch (strategy) {
+    case ReaderGroupSelectionStrategy::ROUND_ROBIN:
+        std::rotate(ordered.begin(),
+                    ordered.begin() + (mRoundRobinCursor++ % ordered.size()),
+                    ordered.end());
+        break;
+    case ReaderGroupSelectionStrategy::LEAST_OUTSTANDING:
+        std::stable_sort(ordered.begin(),
+                         ordered.end(),
+                         [this](const std::string& a, const std::string& b) {
+                             return mGroupLoads[a].mAllocatedCount <
+                                    mGroupLoads[b].mAllocatedCount;
+                         });
+        break;
+    case ReaderGroupSelectionStrategy::LATENCY_WEIGHTED:
+        /* A group not measured yet has a null cost, so that it gets measured */
+        std::stable_sort(ordered.begin(),
+                         ordered.end(),
+                         [this](const std::string& a, const std::string& b) {
+                             const GroupLoad& loadA = mGroupLoads[a];
+                             const GroupLoad& loadB = mGroupLoads[b];
+                             return (loadA.mAllocatedCount + 1) * loadA.mLatencyMicros <
+                                    (loadB.mAllocatedCount + 1) * loadB.mLatencyMicros;
+                         });
+        break;
+    }
+
+    return ordered;
+}
+
+void LocalPoolPluginAdapter::onReaderReleased(const std::string& readerName)
+{
+    std::lock_guard<std::mutex> lock(mAllocationMutex);
+
+    const auto it = mAllocations.find(readerName);
+    if (it == mAllocations.end()) {
+        return;
+    }
+
+    const auto queue = mWaitQueues.find(it->second.mGroupReference);
+    mGroupLoads[it->second.mGroupReference].mAllocatedCount--;
+    mAllocations.erase(it);
+
+    if (queue != mWaitQueues.end()) {
+        wakeUpFirstWaiter(queue->second);
+    }
+}
+
+std::shared_ptr<LocalReaderAdapter> LocalPoolPluginAdapter::takeOrBuildLocalReaderAdapter(
+    std::shared_ptr<ReaderSpi> readerSpi)
+{
+    {
+        std::lock_guard<std::mutex> lock(mWarmAdaptersMutex);
+
+        const auto it = mWarmAdapters.find(readerSpi);
+        if (it != mWarmAdapters.end()) {
+            std::shared_ptr<LocalReaderAdapter> localReaderAdapter = it->second;
+            mWarmAdapters.erase(it);
+            mWarmAdapterHitCounter->increment();
+
+            localReaderAdapter->resetForReuse();
+
+            return localReaderAdapter;
+        }
+    }
+
+    mWarmAdapterMissCounter->increment();
+
+    return buildLocalReaderAdapter(readerSpi);
+}
+
+void LocalPoolPluginAdapter::keepWarm(std::shared_ptr<LocalReaderAdapter> localReaderAdapter)
+{
+    /* The monitoring of an observable reader cannot be restarted once shut down */
+    if (localReaderAdapter->getCapabilities().has(ReaderCapabilities::OBSERVABLE)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mWarmAdaptersMutex);
+
+    if (mWarmAdapters.size() < WARM_ADAPTERS_MAX_COUNT) {
+        mWarmAdapters[localReaderAdapter->getReaderSpi()] = localReaderAdapter;
+    }
+}
+
 }
 }
 }
@@ -12,15 +12,29 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <typeinfo>
+#include <unordered_map>
+#include <vector>
 
 /* Keyple Core Util */
 #include "LoggerFactory.h"
 
 /* Keyple Core Service */
 #include "AbstractPluginAdapter.h"
+#include "LocalReaderAdapter.h"
+#include "MetricsRegistry.h"
 #include "PoolPlugin.h"
+#include "ReaderLeaseAdapter.h"
 
 /* Keyple Core Plugin */
 #include "PoolPluginSpi.h"
@@ -36,10 +50,22 @@ using namespace keyple::core::util::cpp;
  * (package-private)<br>
  * Implementation of a local {@link PoolPlugin}.
  *
+ * <p>Released reader adapters are kept warm (up to WARM_ADAPTERS_MAX_COUNT) and re-bound when
+ * the pool SPI allocates the same ReaderSpi again, instead of building a new adapter. Observable
+ * readers are not kept since their monitoring is shut down when they are released.
+ *
  * @since 2.0.0
  */
 class LocalPoolPluginAdapter final : public AbstractPluginAdapter, public PoolPlugin {
 public:
+    /**
+     * (package-private)<br>
+     * Maximum number of released adapters kept warm.
+     *
+     * @since 2.0.0
+     */
+    static const size_t WARM_ADAPTERS_MAX_COUNT;
+
     /**
      * (package-private)<br>
      * Constructor.
@@ -49,10 +75,20 @@ public:
      */
     LocalPoolPluginAdapter(std::shared_ptr<PoolPluginSpi> poolPluginSpi);
 
+    /**
+     * (package-private)<br>
+     * Stops the lease sweeper if the plugin has not been unregistered.
+     *
+     * @since 2.0.0
+     */
+    ~LocalPoolPluginAdapter();
+
     /**
      * {@inheritDoc}
      *
-     * <p>Unregisters the associated SPI.
+     * <p>Unregisters the associated SPI, drops the warm adapters and wakes up the callers waiting
+     * for a reader. The pending leases are ended, their readers being unregistered with the
+     * plugin.
      *
      * @since 2.0.0
      */
@@ -77,9 +113,101 @@ public:
      *
      * @since 2.0.0
      */
+    std::shared_ptr<Reader> allocateReader(const std::string& readerGroupReference,
+                                           const long timeoutMillis) final;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    std::future<std::shared_ptr<Reader>> allocateReaderAsync(
+        const std::string& readerGroupReference, const long timeoutMillis) final;
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The load of a group is the number of its readers allocated and not yet released, and its
+     * latency the smoothed duration of the allocations made by the SPI.
+     *
+     * @since 2.0.0
+     */
+    std::shared_ptr<Reader> allocateReader(const std::vector<std::string>& readerGroupReferences,
+                                           const ReaderGroupSelectionStrategy strategy) final;
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The expired leases are reclaimed by a background thread started with the first lease.
+     *
+     * @since 2.0.0
+     */
+    std::shared_ptr<ReaderLease> leaseReader(const std::string& readerGroupReference,
+                                             const long durationMillis) final;
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The adapter is kept warm for the next allocation of the same ReaderSpi, unless the
+     * release fails. The first caller waiting for a reader of the same group is woken up, and the
+     * lease of the reader, if any, is ended.
+     *
+     * <p>A reader which is not currently allocated by the plugin (already released, or reclaimed
+     * after the expiration of its lease) is ignored, and so is a reader whose lease has already
+     * been ended by the sweeper: a reader is released only once per allocation.
+     *
+     * @since 2.0.0
+     */
     void releaseReader(const std::shared_ptr<Reader> reader) final;
 
+    /**
+     * (package-private)<br>
+     * Gets the number of released adapters currently kept warm.
+     *
+     * @return A positive value.
+     * @since 2.0.0
+     */
+    size_t getWarmAdapterCount() const;
+
+    /**
+     * (package-private)<br>
+     * Gets the number of readers of a group currently allocated.
+     *
+     * @param readerGroupReference The group reference.
+     * @return A positive value.
+     * @since 2.0.0
+     */
+    size_t getAllocatedReaderCount(const std::string& readerGroupReference);
+
+    /**
+     * (package-private)<br>
+     * Makes the lease sweeper recompute its next deadline, after the renewal of a lease.
+     *
+     * @since 2.0.0
+     */
+    void wakeUpLeaseSweeper();
+
+    /**
+     * (package-private)<br>
+     * Releases the reader of a lease which has just been ended by its holder.
+     *
+     * <p>Nothing is done if the allocation of the lease is no longer current, i.e. if the reader
+     * has been released meanwhile by another path.
+     *
+     * @param reader The leased reader.
+     * @param allocationId The identifier of the allocation of the lease.
+     * @throw IllegalStateException If the plugin is no longer registered.
+     * @throw KeyplePluginException If the release fails.
+     * @since 2.0.0
+     */
+    void releaseLeasedReader(const std::shared_ptr<Reader> reader, const uint64_t allocationId);
+
 private:
+    /**
+     * Weight of the last measure in the smoothed allocation latency of a group.
+     */
+    static const double LATENCY_SMOOTHING_FACTOR;
+
     /**
      *
      */
@@ -90,6 +218,291 @@ private:
      *
      */
     std::shared_ptr<PoolPluginSpi> mPoolPluginSpi;
+
+    /**
+     * Released adapters, by ReaderSpi (kept alive by the adapter itself).
+     */
+    std::unordered_map<std::shared_ptr<ReaderSpi>, std::shared_ptr<LocalReaderAdapter>>
+        mWarmAdapters;
+
+    /**
+     *
+     */
+    mutable std::mutex mWarmAdaptersMutex;
+
+    /**
+     *
+     */
+    std::shared_ptr<MetricsRegistry::Counter> mWarmAdapterHitCounter;
+
+    /**
+     *
+     */
+    std::shared_ptr<MetricsRegistry::Counter> mWarmAdapterMissCounter;
+
+    /**
+     * (private)<br>
+     * Caller waiting for a reader of a group.
+     */
+    struct Waiter {
+        /**
+         * Woken up when the waiter becomes the first of its queue or when a reader of its group
+         * is released.
+         */
+        std::condition_variable mCondition;
+
+        /**
+         * True when the waiter is allowed to (re)try an allocation.
+         */
+        bool mMayTry = false;
+    };
+
+    /**
+     * (private)<br>
+     * FIFO of the callers waiting for a reader of a group.
+     */
+    struct WaitQueue {
+        std::deque<std::shared_ptr<Waiter>> mWaiters;
+        std::shared_ptr<MetricsRegistry::Gauge> mDepthGauge;
+        std::shared_ptr<MetricsRegistry::Counter> mWaitCounter;
+        std::shared_ptr<MetricsRegistry::Counter> mWaitMicrosCounter;
+        std::shared_ptr<MetricsRegistry::Counter> mTimeoutCounter;
+    };
+
+    /**
+     * (private)<br>
+     * Live load of a group.
+     */
+    struct GroupLoad {
+        /**
+         * Number of readers allocated and not yet released.
+         */
+        size_t mAllocatedCount = 0;
+
+        /**
+         * Smoothed duration of the SPI allocations in microseconds, 0 until the first one.
+         */
+        double mLatencyMicros = 0;
+    };
+
+    /**
+     * Protects the wait queues, the group loads and the allocations of the readers.
+     */
+    std::mutex mAllocationMutex;
+
+    /**
+     * Loads, by group reference.
+     */
+    std::map<std::string, GroupLoad> mGroupLoads;
+
+    /**
+     * Position of the next group chosen by the round-robin strategy.
+     */
+    size_t mRoundRobinCursor = 0;
+
+    /**
+     * Wait queues, by group reference.
+     */
+    std::map<std::string, WaitQueue> mWaitQueues;
+
+    /**
+     * (private)<br>
+     * Allocation of a reader, from its allocation to the end of its release.
+     */
+    struct Allocation {
+        /**
+         * Group reference of the reader.
+         */
+        std::string mGroupReference;
+
+        /**
+         * Distinguishes the successive allocations of a same (warm) adapter.
+         */
+        uint64_t mId = 0;
+
+        /**
+         * True once a caller has claimed the release, the other ones must not release it again.
+         */
+        bool mIsReleasing = false;
+    };
+
+    /**
+     * Allocations of the allocated readers, by reader name.
+     */
+    std::unordered_map<std::string, Allocation> mAllocations;
+
+    /**
+     * Identifier of the last allocation.
+     */
+    uint64_t mLastAllocationId = 0;
+
+    /**
+     * (private)<br>
+     * Gets the wait queue of a group, creating it if needed.
+     *
+     * <p>The allocation mutex must be held by the caller.
+     *
+     * @param readerGroupReference The group reference.
+     * @return A not null reference.
+     */
+    WaitQueue& getWaitQueue(const std::string& readerGroupReference);
+
+    /**
+     * (private)<br>
+     * Allows the first waiter of a queue, if any, to retry an allocation.
+     *
+     * <p>The allocation mutex must be held by the caller.
+     *
+     * @param waitQueue The wait queue.
+     */
+    static void wakeUpFirstWaiter(WaitQueue& waitQueue);
+
+    /**
+     * (private)<br>
+     * Removes a waiter from its queue, waking up the next one if it was the first.
+     *
+     * <p>The allocation mutex must be held by the caller.
+     *
+     * @param waitQueue The wait queue.
+     * @param waiter The waiter.
+     */
+    static void removeWaiter(WaitQueue& waitQueue, const std::shared_ptr<Waiter>& waiter);
+
+    /**
+     * (private)<br>
+     * Orders the candidate groups, the preferred one first.
+     *
+     * @param readerGroupReferences The references of the candidate groups.
+     * @param strategy The strategy.
+     * @return A not empty list.
+     */
+    std::vector<std::string> orderGroupReferences(
+        const std::vector<std::string>& readerGroupReferences,
+        const ReaderGroupSelectionStrategy strategy);
+
+    /**
+     * (private)<br>
+     * Forgets the group of a released reader and wakes up the first waiter of this group.
+     *
+     * @param readerName The name of the released reader.
+     */
+    void onReaderReleased(const std::string& readerName);
+
+    /**
+     * Protects the leases and the state of the sweeper.
+     */
+    std::mutex mLeasesMutex;
+
+    /**
+     * Signals the sweeper a new or renewed lease, or its stop.
+     */
+    std::condition_variable mLeasesCondition;
+
+    /**
+     * Pending leases, by reader name (owned by their holders).
+     */
+    std::map<std::string, std::weak_ptr<ReaderLeaseAdapter>> mLeases;
+
+    /**
+     *
+     */
+    bool mLeasesChanged = false;
+
+    /**
+     *
+     */
+    bool mSweeperRunning = false;
+
+    /**
+     *
+     */
+    std::thread mSweeper;
+
+    /**
+     *
+     */
+    std::shared_ptr<MetricsRegistry::Gauge> mActiveLeaseGauge;
+
+    /**
+     *
+     */
+    std::shared_ptr<MetricsRegistry::Counter> mGrantedLeaseCounter;
+
+    /**
+     *
+     */
+    std::shared_ptr<MetricsRegistry::Counter> mReclaimedLeaseCounter;
+
+    /**
+     * (private)<br>
+     * Releases a reader allocated by the plugin.
+     *
+     * @param localReaderAdapter The reader.
+     * @param keepAdapterWarm True if the adapter may be reused by a next allocation.
+     */
+    void releaseLocalReaderAdapter(std::shared_ptr<LocalReaderAdapter> localReaderAdapter,
+                                   const bool keepAdapterWarm);
+
+    /**
+     * (private)<br>
+     * Gets the identifier of the current allocation of a reader.
+     *
+     * @param readerName The name of the reader.
+     * @return 0 if the reader is not allocated.
+     */
+    uint64_t getAllocationId(const std::string& readerName);
+
+    /**
+     * (private)<br>
+     * Atomically checks that an allocation is current and not being released, and makes the
+     * caller in charge of its release.
+     *
+     * @param readerName The name of the reader.
+     * @param allocationId The identifier of the allocation, 0 for the current one whatever it is.
+     * @return True if the caller must release the reader, false if another caller does.
+     */
+    bool claimRelease(const std::string& readerName, const uint64_t allocationId);
+
+    /**
+     * (private)<br>
+     * Forgets the lease of a reader, unless it belongs to a more recent allocation.
+     *
+     * @param readerName The name of the reader.
+     * @param allocationId The identifier of the allocation of the lease.
+     */
+    void forgetLease(const std::string& readerName, const uint64_t allocationId);
+
+    /**
+     * (private)<br>
+     * Sweeper loop, reclaiming the readers of the expired leases until the plugin is
+     * unregistered.
+     */
+    void sweepLeases();
+
+    /**
+     * (private)<br>
+     * Stops the sweeper, waits for its end and ends the pending leases without releasing their
+     * readers.
+     */
+    void endLeases();
+
+    /**
+     * (private)<br>
+     * Takes the warm adapter of a ReaderSpi or builds a new one.
+     *
+     * @param readerSpi The reader SPI allocated by the pool SPI.
+     * @return A not null reference.
+     */
+    std::shared_ptr<LocalReaderAdapter> takeOrBuildLocalReaderAdapter(
+        std::shared_ptr<ReaderSpi> readerSpi);
+
+    /**
+     * (private)<br>
+     * Keeps a released adapter warm, if it can be reused and the limit is not reached.
+     *
+     * @param localReaderAdapter The unregistered adapter.
+     */
+    void keepWarm(std::shared_ptr<LocalReaderAdapter> localReaderAdapter);
 };
 
 }
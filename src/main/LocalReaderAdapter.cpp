@@ -12,12 +12,8 @@
 
 #include "LocalReaderAdapter.h"
 
-#include <sstream>
-
 /* Calypsonet Terminal Card */
-#include "CardBrokenCommunicationException.h"
 #include "ReaderBrokenCommunicationException.h"
-#include "UnexpectedStatusWordException.h"
 
 /* Calypsonet Terminal Reader */
 #include "ReaderCommunicationException.h"
@@ -42,6 +38,8 @@
 #include "ApduResponseAdapter.h"
 #include "CardResponseAdapter.h"
 #include "CardSelectionResponseAdapter.h"
+#include "CompiledCardSelector.h"
+#include "TraceRecorder.h"
 
 namespace keyple {
 namespace core {
@@ -66,11 +64,36 @@ LocalReaderAdapter::LocalReaderAdapter(std::shared_ptr<ReaderSpi> readerSpi,
                         std::dynamic_pointer_cast<KeypleReaderExtension>(readerSpi),
                         pluginName),
   mReaderSpi(readerSpi),
+  mCapabilities(readerSpi),
   mBefore(0),
   mIsLogicalChannelOpen(false),
   mUseDefaultProtocol(false),
   mCurrentProtocol(""),
-  mProtocolAssociations({}) {}
+  mProtocolAssociations({})
+{
+    const auto metrics = MetricsRegistry::getInstance();
+    const std::map<std::string, std::string> labels = {{"plugin", pluginName},
+                                                       {"reader", readerSpi->getName()}};
+
+    mApduSentCounter = metrics->getCounter(MetricsRegistry::APDU_SENT,
+                                           "Number of APDUs transmitted to the card.",
+                                           labels);
+    mSelectionMatchedCounter = metrics->getCounter(MetricsRegistry::SELECTION_MATCHED,
+                                                   "Number of card selections which matched.",
+                                                   labels);
+    mSelectionUnmatchedCounter = metrics->getCounter(MetricsRegistry::SELECTION_UNMATCHED,
+                                                     "Number of card selections which did not " \
+                                                     "match.",
+                                                     labels);
+    mReaderIOExceptionCounter = metrics->getCounter(MetricsRegistry::READER_IO_EXCEPTION,
+                                                    "Number of ReaderIOException raised by the " \
+                                                    "reader SPI.",
+                                                    labels);
+    mCardIOExceptionCounter = metrics->getCounter(MetricsRegistry::CARD_IO_EXCEPTION,
+                                                  "Number of CardIOException raised by the " \
+                                                  "reader SPI.",
+                                                  labels);
+}
 
 void LocalReaderAdapter::computeCurrentProtocol()
 {
@@ -81,7 +104,7 @@ void LocalReaderAdapter::computeCurrentProtocol()
     } else {
         mUseDefaultProtocol = false;
 
-        const auto configurable = std::dynamic_pointer_cast<ConfigurableReaderSpi>(mReaderSpi);
+        const auto& configurable = mCapabilities.getConfigurableReaderSpi();
         for (const auto& entry : mProtocolAssociations) {
             if (configurable->isCurrentProtocol(entry.first)) {
                 mCurrentProtocol = entry.second;
@@ -94,7 +117,7 @@ void LocalReaderAdapter::closeLogicalChannel()
 {
     mLogger->trace("[%] closeLogicalChannel => Closing of the logical channel\n", getName());
 
-    auto reader = std::dynamic_pointer_cast<AutonomousSelectionReaderSpi>(mReaderSpi);
+    const auto& reader = mCapabilities.getAutonomousSelectionReaderSpi();
     if (reader) {
         /* AutonomousSelectionReader have an explicit method for closing channels */
         reader->closeLogicalChannel();
@@ -103,54 +126,9 @@ void LocalReaderAdapter::closeLogicalChannel()
     mIsLogicalChannelOpen = false;
 }
 
-uint8_t LocalReaderAdapter::computeSelectApplicationP2(
-    const FileOccurrence fileOccurrence, const FileControlInformation fileControlInformation)
-{
-    uint8_t p2;
-
-    switch (fileOccurrence) {
-    case FileOccurrence::FIRST:
-        p2 = 0x00;
-        break;
-    case FileOccurrence::LAST:
-        p2 = 0x01;
-        break;
-    case FileOccurrence::NEXT:
-        p2 = 0x02;
-        break;
-    case FileOccurrence::PREVIOUS:
-        p2 = 0x03;
-        break;
-    default:
-        std::stringstream ss;
-        ss << fileOccurrence;
-        throw IllegalStateException("Unexpected value: " + ss.str());
-    }
-
-    switch (fileControlInformation) {
-    case FileControlInformation::FCI:
-        p2 |= 0x00;
-        break;
-    case FileControlInformation::FCP:
-        p2 |= 0x04;
-        break;
-    case FileControlInformation::FMD:
-        p2 |= 0x08;
-        break;
-    case FileControlInformation::NO_RESPONSE:
-        p2 |= 0x0C;
-        break;
-    default:
-        std::stringstream ss;
-        ss << fileOccurrence;
-        throw IllegalStateException("Unexpected value: " + ss.str());
-    }
-
-    return p2;
-}
-
 std::shared_ptr<ApduResponseAdapter> LocalReaderAdapter::processExplicitAidSelection(
-    std::shared_ptr<CardSelectorSpi> cardSelector)
+    std::shared_ptr<CardSelectorSpi> cardSelector,
+    const CompiledCardSelector* compiledCardSelector)
 {
     const std::vector<uint8_t>& aid = cardSelector->getAid();
 
@@ -161,24 +139,15 @@ std::shared_ptr<ApduResponseAdapter> LocalReaderAdapter::processExplicitAidSelec
     /*
      * Build a get response command the actual length expected by the card in the get response
      * command is handled in transmitApdu
-     *
-     * RL-SEL-CLA.1
-     * RL-SEL-P2LC.1
      */
-    std::vector<uint8_t> selectApplicationCommand(6 + aid.size());
-    selectApplicationCommand[0] = 0x00; /* CLA */
-    selectApplicationCommand[1] = 0xA4; /* INS */
-    selectApplicationCommand[2] = 0x04; /* P1: select by name */
-    /*
-     * P2: b0,b1 define the File occurrence, b2,b3 define the File control information
-     * we use the bitmask defined in the respective enums
-     */
-    selectApplicationCommand[3] = computeSelectApplicationP2(
-                                      cardSelector->getFileOccurrence(),
-                                      cardSelector->getFileControlInformation());
-    selectApplicationCommand[4] = static_cast<uint8_t>(aid.size()); /* Lc */
-    System::arraycopy(aid, 0, selectApplicationCommand, 5, static_cast<int>(aid.size()));
-    selectApplicationCommand[5 + aid.size()] = 0x00; /* Le */
+    const std::vector<uint8_t> selectApplicationCommand =
+        compiledCardSelector != nullptr ?
+            compiledCardSelector->getSelectApplicationCommand() :
+            CompiledCardSelector::buildSelectApplicationCommand(
+                aid,
+                CompiledCardSelector::computeSelectApplicationP2(
+                    cardSelector->getFileOccurrence(),
+                    cardSelector->getFileControlInformation()));
 
     auto apduRequest = std::make_shared<ApduRequestAdapter>(selectApplicationCommand);
     apduRequest->setInfo("Internal Select Application");
@@ -187,35 +156,47 @@ std::shared_ptr<ApduResponseAdapter> LocalReaderAdapter::processExplicitAidSelec
 }
 
 std::shared_ptr<ApduResponseAdapter> LocalReaderAdapter::selectByAid(
-    std::shared_ptr<CardSelectorSpi> cardSelector)
+    std::shared_ptr<CardSelectorSpi> cardSelector,
+    const CompiledCardSelector* compiledCardSelector)
 {
     std::shared_ptr<ApduResponseAdapter> fciResponse = nullptr;
 
-    auto reader = std::dynamic_pointer_cast<AutonomousSelectionReaderSpi>(mReaderSpi);
+    const auto& reader = mCapabilities.getAutonomousSelectionReaderSpi();
     if (reader) {
         const std::vector<uint8_t>& aid = cardSelector->getAid();
-        const uint8_t p2 = computeSelectApplicationP2(cardSelector->getFileOccurrence(),
-                                                      cardSelector->getFileControlInformation());
+        const uint8_t p2 = compiledCardSelector != nullptr ?
+                               compiledCardSelector->getSelectApplicationP2() :
+                               CompiledCardSelector::computeSelectApplicationP2(
+                                   cardSelector->getFileOccurrence(),
+                                   cardSelector->getFileControlInformation());
         const std::vector<uint8_t> selectionDataBytes = reader->openChannelForAid(aid, p2);
         fciResponse = std::make_shared<ApduResponseAdapter>(selectionDataBytes);
     } else {
-        fciResponse = processExplicitAidSelection(cardSelector);
+        fciResponse = processExplicitAidSelection(cardSelector, compiledCardSelector);
     }
 
     return fciResponse;
 }
 
 bool LocalReaderAdapter::checkPowerOnData(const std::string& powerOnData,
-                                          std::shared_ptr<CardSelectorSpi> cardSelector)
+                                          std::shared_ptr<CardSelectorSpi> cardSelector,
+                                          const CompiledCardSelector* compiledCardSelector)
 {
     mLogger->debug("[%] openLogicalChannel => PowerOnData = %\n", getName(), powerOnData);
 
-    const std::string& powerOnDataRegex = cardSelector->getPowerOnDataRegex();
+    bool isAccepted;
+
+    if (compiledCardSelector != nullptr) {
+        isAccepted = compiledCardSelector->matchesPowerOnData(powerOnData);
+    } else {
+        const std::string& powerOnDataRegex = cardSelector->getPowerOnDataRegex();
+        isAccepted = powerOnData == "" ||
+                     powerOnDataRegex == "" ||
+                     std::regex_match(powerOnData, std::regex(powerOnDataRegex));
+    }
 
     /* Check the power-on data */
-    if (powerOnData != "" &&
-        powerOnDataRegex != "" &&
-        !std::regex_match(powerOnData, std::regex(powerOnDataRegex))) {
+    if (!isAccepted) {
         mLogger->info("[%] openLogicalChannel => Power-on data didn't match. PowerOnData = %, " \
                       "regex filter = %\n",
                       getName(),
@@ -238,6 +219,10 @@ std::shared_ptr<LocalReaderAdapter::SelectionStatus> LocalReaderAdapter::process
     std::shared_ptr<ApduResponseAdapter> fciResponse = nullptr;
     bool hasMatched = true;
 
+    /* The selectors of a compiled scenario carry everything derived from them */
+    const CompiledCardSelector* compiledCardSelector =
+        dynamic_cast<const CompiledCardSelector*>(cardSelector.get());
+
     if (cardSelector->getCardProtocol() != "" && mUseDefaultProtocol) {
         throw IllegalStateException("Protocol " +
                                     cardSelector->getCardProtocol() +
@@ -253,15 +238,20 @@ std::shared_ptr<LocalReaderAdapter::SelectionStatus> LocalReaderAdapter::process
          * RL-SEL-USAGE.1
          */
         powerOnData = mReaderSpi->getPowerOnData();
-        if (checkPowerOnData(powerOnData, cardSelector)) {
+        if (checkPowerOnData(powerOnData, cardSelector, compiledCardSelector)) {
             /* No power-on data filter or power-on data check succeeded, select by AID if enabled */
             if (cardSelector->getAid().size() != 0) {
-                fciResponse = selectByAid(cardSelector);
-                const std::vector<int>& statusWords =
-                    cardSelector->getSuccessfulSelectionStatusWords();
-                hasMatched = std::find(statusWords.begin(),
-                                       statusWords.end(),
-                                       fciResponse->getStatusWord()) != statusWords.end();
+                fciResponse = selectByAid(cardSelector, compiledCardSelector);
+                if (compiledCardSelector != nullptr) {
+                    hasMatched = compiledCardSelector->isSuccessfulSelectionStatusWord(
+                                     fciResponse->getStatusWord());
+                } else {
+                    const std::vector<int>& statusWords =
+                        cardSelector->getSuccessfulSelectionStatusWords();
+                    hasMatched = std::find(statusWords.begin(),
+                                           statusWords.end(),
+                                           fciResponse->getStatusWord()) != statusWords.end();
+                }
             } else {
                 fciResponse = nullptr;
             }
@@ -280,8 +270,9 @@ std::shared_ptr<LocalReaderAdapter::SelectionStatus> LocalReaderAdapter::process
     return std::make_shared<SelectionStatus>(powerOnData, fciResponse, hasMatched);
 }
 
-std::shared_ptr<CardSelectionResponseApi> LocalReaderAdapter::processCardSelectionRequest(
-    std::shared_ptr<CardSelectionRequestSpi> cardSelectionRequest)
+TransmitResult<std::shared_ptr<CardSelectionResponseApi>>
+    LocalReaderAdapter::tryProcessCardSelectionRequest(
+        std::shared_ptr<CardSelectionRequestSpi> cardSelectionRequest)
 {
     mIsLogicalChannelOpen = false;
     std::shared_ptr<SelectionStatus> selectionStatus = nullptr;
@@ -289,46 +280,59 @@ std::shared_ptr<CardSelectionResponseApi> LocalReaderAdapter::processCardSelecti
     try {
         selectionStatus = processSelection(cardSelectionRequest->getCardSelector());
     } catch (const ReaderIOException& e) {
-        throw ReaderBrokenCommunicationException(
-                std::make_shared<CardResponseAdapter>(
-                      std::vector<std::shared_ptr<ApduResponseApi>>({}), false),
-                false,
-                e.getMessage(),
-                std::make_shared<ReaderIOException>(e));
+        mReaderIOExceptionCounter->increment();
+        return std::make_shared<const TransmitFailure>(
+                   TransmitFailure::Type::READER_BROKEN_COMMUNICATION,
+                   std::make_shared<CardResponseAdapter>(
+                       std::vector<std::shared_ptr<ApduResponseApi>>({}), false),
+                   false,
+                   e.getMessage(),
+                   std::make_shared<ReaderIOException>(e));
     } catch (const CardIOException& e) {
-        throw CardBrokenCommunicationException(
-                  std::make_shared<CardResponseAdapter>(
-                      std::vector<std::shared_ptr<ApduResponseApi>>({}), false),
-                  false,
-                  e.getMessage(),
-                  std::make_shared<CardIOException>(e));
+        mCardIOExceptionCounter->increment();
+        return std::make_shared<const TransmitFailure>(
+                   TransmitFailure::Type::CARD_BROKEN_COMMUNICATION,
+                   std::make_shared<CardResponseAdapter>(
+                       std::vector<std::shared_ptr<ApduResponseApi>>({}), false),
+                   false,
+                   e.getMessage(),
+                   std::make_shared<CardIOException>(e));
     }
 
     if (!selectionStatus->mHasMatched) {
+        mSelectionUnmatchedCounter->increment();
+
         /* The selection failed, return an empty response having the selection status */
-        return std::make_shared<CardSelectionResponseAdapter>(
-                   selectionStatus->mPowerOnData,
-                   selectionStatus->mSelectApplicationResponse,
-                   false,
-                   std::make_shared<CardResponseAdapter>(
-                      std::vector<std::shared_ptr<ApduResponseApi>>({}), false));
+        return std::shared_ptr<CardSelectionResponseApi>(
+                   std::make_shared<CardSelectionResponseAdapter>(
+                       selectionStatus->mPowerOnData,
+                       selectionStatus->mSelectApplicationResponse,
+                       false,
+                       std::make_shared<CardResponseAdapter>(
+                           std::vector<std::shared_ptr<ApduResponseApi>>({}), false)));
     }
 
+    mSelectionMatchedCounter->increment();
     mIsLogicalChannelOpen = true;
 
     std::shared_ptr<CardResponseAdapter> cardResponse = nullptr;
 
     if (cardSelectionRequest->getCardRequest() != nullptr) {
-        cardResponse = processCardRequest(cardSelectionRequest->getCardRequest());
-    } else {
-        cardResponse = nullptr;
+        TransmitResult<std::shared_ptr<CardResponseAdapter>> result =
+            tryProcessCardRequest(cardSelectionRequest->getCardRequest());
+        if (!result.isSuccess()) {
+            return result.getFailure();
+        }
+
+        cardResponse = result.takeValue();
     }
 
-    return std::make_shared<CardSelectionResponseAdapter>(
-               selectionStatus->mPowerOnData,
-               selectionStatus->mSelectApplicationResponse,
-               true,
-               cardResponse);
+    return std::shared_ptr<CardSelectionResponseApi>(
+               std::make_shared<CardSelectionResponseAdapter>(
+                   selectionStatus->mPowerOnData,
+                   selectionStatus->mSelectApplicationResponse,
+                   true,
+                   cardResponse));
 }
 
 std::shared_ptr<ApduResponseAdapter> LocalReaderAdapter::case4HackGetResponse()
@@ -343,8 +347,12 @@ std::shared_ptr<ApduResponseAdapter> LocalReaderAdapter::case4HackGetResponse()
                    ByteArrayUtil::toHex(APDU_GET_RESPONSE),
                    elapsed10ms / 10.0);
 
-    const std::vector<uint8_t> getResponseHackResponseBytes =
-        mReaderSpi->transmitApdu(APDU_GET_RESPONSE);
+    std::vector<uint8_t> getResponseHackResponseBytes;
+    {
+        TraceRecorder::Span span("ReaderSpi::transmitApdu", getName());
+        getResponseHackResponseBytes = mReaderSpi->transmitApdu(APDU_GET_RESPONSE);
+    }
+    mApduSentCounter->increment();
 
     std::shared_ptr<ApduResponseAdapter> getResponseHackResponse =
         std::make_shared<ApduResponseAdapter>(getResponseHackResponseBytes);
@@ -375,8 +383,12 @@ std::shared_ptr<ApduResponseAdapter> LocalReaderAdapter::processApduRequest(
                    apduRequest,
                    elapsed10ms / 10.0);
 
-    apduResponse = std::make_shared<ApduResponseAdapter>(
-                       mReaderSpi->transmitApdu(apduRequest->getApdu()));
+    {
+        TraceRecorder::Span span("ReaderSpi::transmitApdu", getName());
+        apduResponse = std::make_shared<ApduResponseAdapter>(
+                           mReaderSpi->transmitApdu(apduRequest->getApdu()));
+    }
+    mApduSentCounter->increment();
 
     /* RL-SW-ANALYSIS.1 */
     if (ApduUtil::isCase4(apduRequest->getApdu()) &&
@@ -398,7 +410,7 @@ std::shared_ptr<ApduResponseAdapter> LocalReaderAdapter::processApduRequest(
     return apduResponse;
 }
 
-std::shared_ptr<CardResponseAdapter> LocalReaderAdapter::processCardRequest(
+TransmitResult<std::shared_ptr<CardResponseAdapter>> LocalReaderAdapter::tryProcessCardRequest(
     const std::shared_ptr<CardRequestSpi> cardRequest)
 {
 
@@ -416,35 +428,43 @@ std::shared_ptr<CardResponseAdapter> LocalReaderAdapter::processCardRequest(
                           successfulSW.end(),
                           apduResponse->getStatusWord()) ==
                     apduRequest->getSuccessfulStatusWords().end()) {
-                throw UnexpectedStatusWordException(
-                          std::make_shared<CardResponseAdapter>(apduResponses, false),
-                          cardRequest->getApduRequests().size() == apduResponses.size(),
-                          "Unexpected status word.");
+                return std::make_shared<const TransmitFailure>(
+                           TransmitFailure::Type::UNEXPECTED_STATUS_WORD,
+                           std::make_shared<CardResponseAdapter>(apduResponses, false),
+                           cardRequest->getApduRequests().size() == apduResponses.size(),
+                           "Unexpected status word.",
+                           std::shared_ptr<Exception>(nullptr));
             }
         } catch (const ReaderIOException& e) {
+            mReaderIOExceptionCounter->increment();
+
             /*
-             * The process has been interrupted. We close the logical channel and launch a
-             * KeypleReaderException with the Apdu responses collected so far.
+             * The process has been interrupted. We close the logical channel and report a reader
+             * failure with the Apdu responses collected so far.
              */
             closeLogicalAndPhysicalChannelsSilently();
 
-            throw ReaderBrokenCommunicationException(
-                      std::make_shared<CardResponseAdapter>(apduResponses, false),
-                      false,
-                      "Reader communication failure while transmitting a card request.",
-                      std::make_shared<ReaderIOException>(e));
+            return std::make_shared<const TransmitFailure>(
+                       TransmitFailure::Type::READER_BROKEN_COMMUNICATION,
+                       std::make_shared<CardResponseAdapter>(apduResponses, false),
+                       false,
+                       "Reader communication failure while transmitting a card request.",
+                       std::make_shared<ReaderIOException>(e));
         } catch (const CardIOException& e) {
+            mCardIOExceptionCounter->increment();
+
             /*
-             * The process has been interrupted. We close the logical channel and launch a
-             * KeypleReaderException with the Apdu responses collected so far.
+             * The process has been interrupted. We close the logical channel and report a card
+             * failure with the Apdu responses collected so far.
              */
             closeLogicalAndPhysicalChannelsSilently();
 
-            throw CardBrokenCommunicationException(
-                      std::make_shared<CardResponseAdapter>(apduResponses, false),
-                      false,
-                      "Card communication failure while transmitting a card request.",
-                      std::make_shared<CardIOException>(e));
+            return std::make_shared<const TransmitFailure>(
+                       TransmitFailure::Type::CARD_BROKEN_COMMUNICATION,
+                       std::make_shared<CardResponseAdapter>(apduResponses, false),
+                       false,
+                       "Card communication failure while transmitting a card request.",
+                       std::make_shared<CardIOException>(e));
         }
     }
 
@@ -458,6 +478,7 @@ void LocalReaderAdapter::releaseChannel()
     try {
         mReaderSpi->closePhysicalChannel();
     } catch (const ReaderIOException& e) {
+        mReaderIOExceptionCounter->increment();
         throw ReaderBrokenCommunicationException(nullptr,
                                                  false,
                                                  "Failed to release the physical channel",
@@ -473,7 +494,7 @@ void LocalReaderAdapter::deactivateReaderProtocol(const std::string& readerProto
 
     mProtocolAssociations.erase(readerProtocol);
 
-    const auto configurable = std::dynamic_pointer_cast<ConfigurableReaderSpi>(mReaderSpi);
+    const auto& configurable = mCapabilities.getConfigurableReaderSpi();
     if (!configurable || !configurable->isProtocolSupported(readerProtocol)) {
         throw ReaderProtocolNotSupportedException(readerProtocol);
     }
@@ -489,7 +510,7 @@ void LocalReaderAdapter::activateReaderProtocol(const std::string& readerProtoco
     Assert::getInstance().notEmpty(readerProtocol, "readerProtocol")
                          .notEmpty(applicationProtocol, "applicationProtocol");
 
-    const auto configurable = std::dynamic_pointer_cast<ConfigurableReaderSpi>(mReaderSpi);
+    const auto& configurable = mCapabilities.getConfigurableReaderSpi();
     if (!configurable || !configurable->isProtocolSupported(readerProtocol)) {
         throw ReaderProtocolNotSupportedException(readerProtocol);
     }
@@ -510,6 +531,7 @@ bool LocalReaderAdapter::isCardPresent()
     try {
         return mReaderSpi->checkCardPresence();
     } catch (const ReaderIOException& e) {
+        mReaderIOExceptionCounter->increment();
         throw ReaderCommunicationException(
                   "An exception occurred while checking the card presence.",
                   std::make_shared<ReaderIOException>(e));
@@ -527,10 +549,9 @@ std::shared_ptr<CardResponseApi> LocalReaderAdapter::processCardRequest(
 {
     checkStatus();
 
-    std::shared_ptr<CardResponseAdapter> cardResponse = nullptr;
-
     /* Process the CardRequest and keep the CardResponse */
-    cardResponse = processCardRequest(cardRequest);
+    const std::shared_ptr<CardResponseAdapter> cardResponse =
+        tryProcessCardRequest(cardRequest).valueOrThrow();
 
     /* Close the channel if requested */
     if (channelControl == ChannelControl::CLOSE_AFTER) {
@@ -545,6 +566,17 @@ std::vector<std::shared_ptr<CardSelectionResponseApi>>
         const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
         const MultiSelectionProcessing multiSelectionProcessing,
         const ChannelControl channelControl)
+{
+    return tryProcessCardSelectionRequests(cardSelectionRequests,
+                                           multiSelectionProcessing,
+                                           channelControl).valueOrThrow();
+}
+
+TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+    LocalReaderAdapter::tryProcessCardSelectionRequests(
+        const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
+        const MultiSelectionProcessing multiSelectionProcessing,
+        const ChannelControl channelControl)
 {
     checkStatus();
 
@@ -556,25 +588,34 @@ std::vector<std::shared_ptr<CardSelectionResponseApi>>
             mReaderSpi->openPhysicalChannel();
             computeCurrentProtocol();
         } catch (const ReaderIOException& e) {
-            throw ReaderBrokenCommunicationException(
-                      nullptr,
-                      false,
-                      "Reader communication failure while opening physical channel",
-                      std::make_shared<ReaderIOException>(e));
+            mReaderIOExceptionCounter->increment();
+            return std::make_shared<const TransmitFailure>(
+                       TransmitFailure::Type::READER_BROKEN_COMMUNICATION,
+                       nullptr,
+                       false,
+                       "Reader communication failure while opening physical channel",
+                       std::make_shared<ReaderIOException>(e));
         } catch (const CardIOException& e) {
-            throw CardBrokenCommunicationException(
-                      nullptr,
-                      false,
-                      "Card communication failure while opening physical channel",
-                      std::make_shared<CardIOException>(e));
+            mCardIOExceptionCounter->increment();
+            return std::make_shared<const TransmitFailure>(
+                       TransmitFailure::Type::CARD_BROKEN_COMMUNICATION,
+                       nullptr,
+                       false,
+                       "Card communication failure while opening physical channel",
+                       std::make_shared<CardIOException>(e));
         }
     }
 
     /* Loop over all CardRequest provided in the list */
     for (const auto& cardSelectionRequest : cardSelectionRequests) {
         /* Process the CardRequest and append the CardResponse list */
-        const auto cardSelectionResponse = processCardSelectionRequest(cardSelectionRequest);
-        cardSelectionResponses.push_back(cardSelectionResponse);
+        TransmitResult<std::shared_ptr<CardSelectionResponseApi>> result =
+            tryProcessCardSelectionRequest(cardSelectionRequest);
+        if (!result.isSuccess()) {
+            return result.getFailure();
+        }
+
+        cardSelectionResponses.push_back(result.takeValue());
 
         if (multiSelectionProcessing == MultiSelectionProcessing::PROCESS_ALL) {
             /*
@@ -622,6 +663,7 @@ void LocalReaderAdapter::closeLogicalAndPhysicalChannelsSilently()
     try {
         mReaderSpi->closePhysicalChannel();
     } catch (const ReaderIOException& e) {
+        mReaderIOExceptionCounter->increment();
         mLogger->error("[%] Exception occurred in releaseSeChannel. Message: %\n",
                        getName(),
                        e.getMessage());
@@ -638,6 +680,19 @@ std::shared_ptr<ReaderSpi> LocalReaderAdapter::getReaderSpi() const
     return mReaderSpi;
 }
 
+const ReaderCapabilities& LocalReaderAdapter::getCapabilities() const
+{
+    return mCapabilities;
+}
+
+void LocalReaderAdapter::resetForReuse()
+{
+    mIsLogicalChannelOpen = false;
+    mUseDefaultProtocol = false;
+    mCurrentProtocol = "";
+    mProtocolAssociations.clear();
+}
+
 /* SELECTION STATUS ----------------------------------------------------------------------------- */
 
 LocalReaderAdapter::SelectionStatus::SelectionStatus(
@@ -26,6 +26,9 @@
 #include "AbstractReaderAdapter.h"
 #include "ApduResponseAdapter.h"
 #include "CardResponseAdapter.h"
+#include "CompiledCardSelector.h"
+#include "MetricsRegistry.h"
+#include "ReaderCapabilities.h"
 
 /* Keyple Core Util */
 #include "LoggerFactory.h"
@@ -78,6 +81,25 @@ public:
      */
     std::shared_ptr<ReaderSpi> getReaderSpi() const;
 
+    /**
+     * (package-private)<br>
+     * Gets the capabilities of the ReaderSpi, resolved at construction.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    const ReaderCapabilities& getCapabilities() const;
+
+    /**
+     * (package-private)<br>
+     * Restores the state of a freshly built adapter (logical channel closed, no protocol
+     * association), before reusing an unregistered adapter for a new allocation of the same
+     * ReaderSpi.
+     *
+     * @since 2.0.0
+     */
+    void resetForReuse();
+
     /**
      * (package-private)<br>
      * Gets the logical channel's opening state.
@@ -116,6 +138,19 @@ public:
         const MultiSelectionProcessing multiSelectionProcessing,
         const ChannelControl channelControl) override final;
 
+    /**
+     * {@inheritDoc}
+     *
+     * <p>The card and reader communication failures are reported without throwing exceptions.
+     *
+     * @since 2.0.0
+     */
+    TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>
+        tryProcessCardSelectionRequests(
+            const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
+            const MultiSelectionProcessing multiSelectionProcessing,
+            const ChannelControl channelControl) override final;
+
     /**
      * {@inheritDoc}
      *
@@ -168,6 +203,19 @@ public:
      */
     virtual void releaseChannel() override final;
 
+protected:
+    /**
+     * (package-private)<br>
+     * Metrics of the reader, registered once at construction.
+     *
+     * @since 2.0.0
+     */
+    std::shared_ptr<MetricsRegistry::Counter> mApduSentCounter;
+    std::shared_ptr<MetricsRegistry::Counter> mSelectionMatchedCounter;
+    std::shared_ptr<MetricsRegistry::Counter> mSelectionUnmatchedCounter;
+    std::shared_ptr<MetricsRegistry::Counter> mReaderIOExceptionCounter;
+    std::shared_ptr<MetricsRegistry::Counter> mCardIOExceptionCounter;
+
 private:
     /**
      *
@@ -185,6 +233,11 @@ private:
      */
     std::shared_ptr<ReaderSpi> mReaderSpi;
 
+    /**
+     *
+     */
+    const ReaderCapabilities mCapabilities;
+
     /**
      *
      */
@@ -274,40 +327,33 @@ private:
      */
     void closeLogicalChannel();
 
-    /**
-     * (private)<br>
-     * Computes the P2 parameter of the ISO7816-4 Select Application APDU command from the provided
-     * FileOccurrence and FileControlInformation.
-     *
-     * @param fileOccurrence The file's position relative to the current file.
-     * @param fileControlInformation The file control information output.
-     * @throw IllegalStateException If one of the provided argument is unexpected.
-     */
-    uint8_t computeSelectApplicationP2(const FileOccurrence fileOccurrence,
-                                       const FileControlInformation fileControlInformation);
-
     /**
      * (private)<br>
      * Sends the select application command to the card and returns the requested data according to
      * AidSelector attributes (ISO7816-4 selection data) into an {@link ApduResponseAdapter}.
      *
      * @param cardSelector The card selector.
+     * @param compiledCardSelector The card selector if it is compiled, null otherwise.
      * @return A not null {@link ApduResponseAdapter}.
      * @throw ReaderIOException if the communication with the reader has failed.
      * @throw CardIOException if the communication with the card has failed.
      */
     std::shared_ptr<ApduResponseAdapter> processExplicitAidSelection(
-        std::shared_ptr<CardSelectorSpi> cardSelector);
+        std::shared_ptr<CardSelectorSpi> cardSelector,
+        const CompiledCardSelector* compiledCardSelector);
 
     /**
      * (private)<br>
      * Selects the card with the provided AID and gets the FCI response in return.
      *
      * @param cardSelector The card selector.
+     * @param compiledCardSelector The card selector if it is compiled, null otherwise.
      * @return A not null ApduResponseAdapter containing the FCI.
      * @see processSelection(CardSelectorSpi)
      */
-    std::shared_ptr<ApduResponseAdapter> selectByAid(std::shared_ptr<CardSelectorSpi> cardSelector);
+    std::shared_ptr<ApduResponseAdapter> selectByAid(
+        std::shared_ptr<CardSelectorSpi> cardSelector,
+        const CompiledCardSelector* compiledCardSelector);
 
     /**
      * (private)<br>
@@ -317,13 +363,15 @@ private:
      *
      * @param powerOnData A String containing the power-on data.
      * @param cardSelector The card selector.
+     * @param compiledCardSelector The card selector if it is compiled, null otherwise.
      * @return True or false.
      * @throw IllegalStateException if no power-on data is available and the PowerOnDataFilter is
      *        set.
      * @see processSelection(CardSelectorSpi)
      */
     bool checkPowerOnData(const std::string& powerOnData,
-                          std::shared_ptr<CardSelectorSpi> cardSelector);
+                          std::shared_ptr<CardSelectorSpi> cardSelector,
+                          const CompiledCardSelector* compiledCardSelector);
 
     /**
      * (private)<br>
@@ -350,13 +398,10 @@ private:
      * Attempts to select the card and executes the optional requests if any.
      *
      * @param cardSelectionRequest The CardSelectionRequestSpi to be processed.
-     * @return A not null reference.
-     * @throw ReaderBrokenCommunicationException If the communication with the reader has failed.
-     * @throw CardBrokenCommunicationException If the communication with the card has failed.
-     * @throw UnexpectedStatusWordException If status word verification is enabled in the card
-     *        request and the card returned an unexpected code.
+     * @return A not null response or the failure (reader or card communication failure,
+     *         unexpected status word if status word verification is enabled in the card request).
      */
-    std::shared_ptr<CardSelectionResponseApi> processCardSelectionRequest(
+    TransmitResult<std::shared_ptr<CardSelectionResponseApi>> tryProcessCardSelectionRequest(
         std::shared_ptr<CardSelectionRequestSpi> cardSelectionRequest);
 
     /**
@@ -391,14 +436,14 @@ private:
      * (private)<br>
      * Transmits a CardRequestSpi and returns a CardResponseAdapter.
      *
+     * <p>On failure, the channels are closed and the responses collected so far are attached to
+     * the failure.
+     *
      * @param cardRequest The card request to transmit.
-     * @return A not null reference.
-     * @throw ReaderBrokenCommunicationException If the communication with the reader has failed.
-     * @throw CardBrokenCommunicationException If the communication with the card has failed.
-     * @throw UnexpectedStatusWordException If status word verification is enabled in the card
-     *        request and the card returned an unexpected code.
+     * @return A not null response or the failure (reader or card communication failure,
+     *         unexpected status word if status word verification is enabled in the card request).
      */
-    std::shared_ptr<CardResponseAdapter> processCardRequest(
+    TransmitResult<std::shared_ptr<CardResponseAdapter>> tryProcessCardRequest(
         const std::shared_ptr<CardRequestSpi> cardRequest);
 };
 
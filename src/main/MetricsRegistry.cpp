@@ -0,0 +1,290 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "MetricsRegistry.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+#include "KeypleAssert.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+/* COUNTER -------------------------------------------------------------------------------------- */
+
+MetricsRegistry::Counter::Counter()
+{
+    for (int i = 0; i < SHARD_COUNT; i++) {
+        mShards[i].mValue = 0;
+    }
+}
+
+int MetricsRegistry::Counter::getShardIndex()
+{
+    static std::atomic<int> nextIndex(0);
+    static thread_local const int index = nextIndex++ & (SHARD_COUNT - 1);
+
+    return index;
+}
+
+void MetricsRegistry::Counter::increment(const uint64_t amount)
+{
+    mShards[getShardIndex()].mValue.fetch_add(amount, std::memory_order_relaxed);
+}
+
+uint64_t MetricsRegistry::Counter::getValue() const
+{
+    uint64_t value = 0;
+
+    for (int i = 0; i < SHARD_COUNT; i++) {
+        value += mShards[i].mValue.load(std::memory_order_relaxed);
+    }
+
+    return value;
+}
+
+/* GAUGE ---------------------------------------------------------------------------------------- */
+
+MetricsRegistry::Gauge::Gauge() : mValue(0) {}
+
+void MetricsRegistry::Gauge::set(const int64_t value)
+{
+    mValue.store(value, std::memory_order_relaxed);
+}
+
+void MetricsRegistry::Gauge::increment()
+{
+    mValue.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MetricsRegistry::Gauge::decrement()
+{
+    mValue.fetch_sub(1, std::memory_order_relaxed);
+}
+
+int64_t MetricsRegistry::Gauge::getValue() const
+{
+    return mValue.load(std::memory_order_relaxed);
+}
+
+/* METRICS REGISTRY ----------------------------------------------------------------------------- */
+
+const std::string MetricsRegistry::APDU_SENT = "keyple_apdu_sent_total";
+const std::string MetricsRegistry::SELECTION_MATCHED = "keyple_selection_matched_total";
+const std::string MetricsRegistry::SELECTION_UNMATCHED = "keyple_selection_unmatched_total";
+const std::string MetricsRegistry::READER_IO_EXCEPTION = "keyple_reader_io_exception_total";
+const std::string MetricsRegistry::CARD_IO_EXCEPTION = "keyple_card_io_exception_total";
+const std::string MetricsRegistry::OBSERVER_EXCEPTION = "keyple_observer_exception_total";
+const std::string MetricsRegistry::STATE_TRANSITION = "keyple_reader_state_transition_total";
+const std::string MetricsRegistry::PLUGIN_READER_CONNECTED =
+    "keyple_plugin_reader_connected_total";
+const std::string MetricsRegistry::PLUGIN_READER_DISCONNECTED =
+    "keyple_plugin_reader_disconnected_total";
+const std::string MetricsRegistry::EXECUTOR_QUEUE_DEPTH = "keyple_executor_queue_depth";
+const std::string MetricsRegistry::EXECUTOR_JOB_EXECUTED = "keyple_executor_job_executed_total";
+const std::string MetricsRegistry::POOL_WARM_ADAPTER_HIT = "keyple_pool_warm_adapter_hit_total";
+const std::string MetricsRegistry::POOL_WARM_ADAPTER_MISS = "keyple_pool_warm_adapter_miss_total";
+const std::string MetricsRegistry::POOL_ALLOCATION_QUEUE_DEPTH =
+    "keyple_pool_allocation_queue_depth";
+const std::string MetricsRegistry::POOL_ALLOCATION_WAIT = "keyple_pool_allocation_wait_total";
+const std::string MetricsRegistry::POOL_ALLOCATION_WAIT_MICROSECONDS =
+    "keyple_pool_allocation_wait_microseconds_total";
+const std::string MetricsRegistry::POOL_ALLOCATION_TIMEOUT = "keyple_pool_allocation_timeout_total";
+const std::string MetricsRegistry::POOL_LEASE_ACTIVE = "keyple_pool_lease_active";
+const std::string MetricsRegistry::POOL_LEASE_GRANTED = "keyple_pool_lease_granted_total";
+const std::string MetricsRegistry::POOL_LEASE_RECLAIMED = "keyple_pool_lease_reclaimed_total";
+const std::string MetricsRegistry::CARD_PROCESSING_TIMEOUT =
+    "keyple_card_processing_timeout_total";
+
+MetricsRegistry::MetricsRegistry() {}
+
+std::shared_ptr<MetricsRegistry> MetricsRegistry::getInstance()
+{
+    /* C++: function-local static, initialization is thread-safe */
+    static const std::shared_ptr<MetricsRegistry> instance(new MetricsRegistry());
+
+    return instance;
+}
+
+MetricsRegistry::Family& MetricsRegistry::getFamily(const std::string& name,
+                                                    const std::string& help,
+                                                    const bool isCounter)
+{
+    Assert::getInstance().notEmpty(name, "name");
+
+    auto it = mFamilies.find(name);
+    if (it == mFamilies.end()) {
+        Family family;
+        family.mHelp = help;
+        family.mIsCounter = isCounter;
+        it = mFamilies.insert({name, family}).first;
+    } else if (it->second.mIsCounter != isCounter) {
+        throw IllegalArgumentException("Metric '" + name + "' is already registered with " +
+                                       "another type.");
+    }
+
+    return it->second;
+}
+
+std::shared_ptr<MetricsRegistry::Counter> MetricsRegistry::getCounter(
+    const std::string& name,
+    const std::string& help,
+    const std::map<std::string, std::string>& labels)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Family& family = getFamily(name, help, true);
+    const std::string key = renderLabels(labels);
+
+    const auto it = family.mCounters.find(key);
+    if (it != family.mCounters.end()) {
+        return it->second;
+    }
+
+    auto counter = std::make_shared<Counter>();
+    family.mCounters.insert({key, counter});
+
+    return counter;
+}
+
+std::shared_ptr<MetricsRegistry::Gauge> MetricsRegistry::getGauge(
+    const std::string& name,
+    const std::string& help,
+    const std::map<std::string, std::string>& labels)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Family& family = getFamily(name, help, false);
+    const std::string key = renderLabels(labels);
+
+    const auto it = family.mGauges.find(key);
+    if (it != family.mGauges.end()) {
+        return it->second;
+    }
+
+    auto gauge = std::make_shared<Gauge>();
+    family.mGauges.insert({key, gauge});
+
+    return gauge;
+}
+
+const std::string MetricsRegistry::renderPrometheusText() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    std::stringstream ss;
+
+    for (const auto& entry : mFamilies) {
+        const std::string& name = entry.first;
+        const Family& family = entry.second;
+
+        ss << "# HELP " << name << " " << escape(family.mHelp, false) << "\n";
+        ss << "# TYPE " << name << " " << (family.mIsCounter ? "counter" : "gauge") << "\n";
+
+        for (const auto& counter : family.mCounters) {
+            ss << name << counter.first << " " << counter.second->getValue() << "\n";
+        }
+
+        for (const auto& gauge : family.mGauges) {
+            ss << name << gauge.first << " " << gauge.second->getValue() << "\n";
+        }
+    }
+
+    return ss.str();
+}
+
+void MetricsRegistry::writePrometheusTextToFile(const std::string& path) const
+{
+    Assert::getInstance().notEmpty(path, "path");
+
+    const std::string tmpPath = path + ".tmp";
+
+    {
+        std::ofstream file(tmpPath, std::ios::out | std::ios::trunc);
+        if (!file) {
+            throw IllegalStateException("Unable to open '" + tmpPath + "' for writing.");
+        }
+
+        file << renderPrometheusText();
+        file.close();
+
+        if (file.fail()) {
+            throw IllegalStateException("Unable to write '" + tmpPath + "'.");
+        }
+    }
+
+#if defined(WIN32)
+    /* C++: std::rename does not overwrite an existing file on Windows */
+    std::remove(path.c_str());
+#endif
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        throw IllegalStateException("Unable to rename '" + tmpPath + "' to '" + path + "'.");
+    }
+}
+
+const std::string MetricsRegistry::renderLabels(const std::map<std::string, std::string>& labels)
+{
+    if (labels.empty()) {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << "{";
+
+    bool first = true;
+    for (const auto& label : labels) {
+        if (!first) {
+            ss << ",";
+        }
+
+        ss << label.first << "=\"" << escape(label.second, true) << "\"";
+        first = false;
+    }
+
+    ss << "}";
+
+    return ss.str();
+}
+
+const std::string MetricsRegistry::escape(const std::string& value, const bool escapeQuotes)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+
+    for (const char c : value) {
+        if (c == '\\') {
+            escaped += "\\\\";
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else if (c == '"' && escapeQuotes) {
+            escaped += "\\\"";
+        } else {
+            escaped += c;
+        }
+    }
+
+    return escaped;
+}
+
+}
+}
+}
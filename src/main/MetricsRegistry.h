@@ -0,0 +1,288 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/* Keyple Core Service */
+#include "KeypleServiceExport.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+/**
+ * Service-wide registry of counters and gauges.
+ *
+ * <p>The registry is filled by the service itself (APDU exchanges, selections, I/O errors,
+ * observation errors, state machine transitions, plugin reader connections, executor queues) and
+ * is read through a pull interface rendering the Prometheus text exposition format.
+ *
+ * <p>Metrics are registered once (by name and labels) and the returned reference is meant to be
+ * kept by the caller: updating a metric never takes a lock.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API MetricsRegistry final {
+public:
+    /**
+     * Monotonic counter.
+     *
+     * <p>The value is sharded across several cache lines, each thread always incrementing the
+     * same shard, so that concurrent increments from different threads do not contend.
+     *
+     * @since 2.0.0
+     */
+    class KEYPLESERVICE_API Counter final {
+    public:
+        /**
+         * Constructor.
+         *
+         * @since 2.0.0
+         */
+        Counter();
+
+        /**
+         * Increments the counter.
+         *
+         * @param amount The amount to add (default 1).
+         * @since 2.0.0
+         */
+        void increment(const uint64_t amount = 1);
+
+        /**
+         * Gets the current value of the counter (sum of all shards).
+         *
+         * @return A positive value.
+         * @since 2.0.0
+         */
+        uint64_t getValue() const;
+
+    private:
+        /**
+         * Number of shards, must be a power of 2.
+         */
+        static const int SHARD_COUNT = 16;
+
+        /**
+         * A shard padded to a full cache line to avoid false sharing.
+         */
+        struct Shard {
+            std::atomic<uint64_t> mValue;
+            char mPadding[64 - sizeof(std::atomic<uint64_t>)];
+        };
+
+        /**
+         *
+         */
+        Shard mShards[SHARD_COUNT];
+
+        /**
+         * Gets the index of the shard dedicated to the calling thread.
+         */
+        static int getShardIndex();
+    };
+
+    /**
+     * Gauge holding an instantaneous value which can go up and down.
+     *
+     * @since 2.0.0
+     */
+    class KEYPLESERVICE_API Gauge final {
+    public:
+        /**
+         * Constructor.
+         *
+         * @since 2.0.0
+         */
+        Gauge();
+
+        /**
+         * Sets the value of the gauge.
+         *
+         * @param value The new value.
+         * @since 2.0.0
+         */
+        void set(const int64_t value);
+
+        /**
+         * Increments the gauge by 1.
+         *
+         * @since 2.0.0
+         */
+        void increment();
+
+        /**
+         * Decrements the gauge by 1.
+         *
+         * @since 2.0.0
+         */
+        void decrement();
+
+        /**
+         * Gets the current value of the gauge.
+         *
+         * @return The value.
+         * @since 2.0.0
+         */
+        int64_t getValue() const;
+
+    private:
+        /**
+         *
+         */
+        std::atomic<int64_t> mValue;
+    };
+
+    /**
+     * Metric names used by the service.
+     *
+     * @since 2.0.0
+     */
+    static const std::string APDU_SENT;
+    static const std::string SELECTION_MATCHED;
+    static const std::string SELECTION_UNMATCHED;
+    static const std::string READER_IO_EXCEPTION;
+    static const std::string CARD_IO_EXCEPTION;
+    static const std::string OBSERVER_EXCEPTION;
+    static const std::string STATE_TRANSITION;
+    static const std::string PLUGIN_READER_CONNECTED;
+    static const std::string PLUGIN_READER_DISCONNECTED;
+    static const std::string EXECUTOR_QUEUE_DEPTH;
+    static const std::string EXECUTOR_JOB_EXECUTED;
+    static const std::string POOL_WARM_ADAPTER_HIT;
+    static const std::string POOL_WARM_ADAPTER_MISS;
+    static const std::string POOL_ALLOCATION_QUEUE_DEPTH;
+    static const std::string POOL_ALLOCATION_WAIT;
+    static const std::string POOL_ALLOCATION_WAIT_MICROSECONDS;
+    static const std::string POOL_ALLOCATION_TIMEOUT;
+    static const std::string POOL_LEASE_ACTIVE;
+    static const std::string POOL_LEASE_GRANTED;
+    static const std::string POOL_LEASE_RECLAIMED;
+    static const std::string CARD_PROCESSING_TIMEOUT;
+
+    /**
+     * Gets the unique instance of the registry.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    static std::shared_ptr<MetricsRegistry> getInstance();
+
+    /**
+     * Gets the counter registered with the provided name and labels, registers it if needed.
+     *
+     * @param name The metric name (e.g. "keyple_apdu_sent_total").
+     * @param help The description of the metric (used at first registration only).
+     * @param labels The labels identifying the time series (may be empty).
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the name is empty or is already used by a gauge.
+     * @since 2.0.0
+     */
+    std::shared_ptr<Counter> getCounter(
+        const std::string& name,
+        const std::string& help,
+        const std::map<std::string, std::string>& labels = std::map<std::string, std::string>());
+
+    /**
+     * Gets the gauge registered with the provided name and labels, registers it if needed.
+     *
+     * @param name The metric name (e.g. "keyple_executor_queue_depth").
+     * @param help The description of the metric (used at first registration only).
+     * @param labels The labels identifying the time series (may be empty).
+     * @return A not null reference.
+     * @throw IllegalArgumentException If the name is empty or is already used by a counter.
+     * @since 2.0.0
+     */
+    std::shared_ptr<Gauge> getGauge(
+        const std::string& name,
+        const std::string& help,
+        const std::map<std::string, std::string>& labels = std::map<std::string, std::string>());
+
+    /**
+     * Renders all the registered metrics using the Prometheus text exposition format (v0.0.4).
+     *
+     * @return A not empty string if at least one metric is registered.
+     * @since 2.0.0
+     */
+    const std::string renderPrometheusText() const;
+
+    /**
+     * Writes the Prometheus text rendering into the provided file.
+     *
+     * <p>The content is first written into a temporary file which is then renamed, a scraper
+     * reading the file never sees a partial content. On POSIX systems the rename atomically
+     * replaces the previous file, which therefore never disappears.
+     *
+     * @param path The path of the file to write.
+     * @throw IllegalStateException If the file cannot be written.
+     * @since 2.0.0
+     */
+    void writePrometheusTextToFile(const std::string& path) const;
+
+private:
+    /**
+     * (private)<br>
+     * All the time series sharing the same metric name.
+     */
+    struct Family {
+        std::string mHelp;
+        bool mIsCounter;
+        std::map<std::string, std::shared_ptr<Counter>> mCounters;
+        std::map<std::string, std::shared_ptr<Gauge>> mGauges;
+    };
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     *
+     */
+    std::map<std::string, Family> mFamilies;
+
+    /**
+     * Private constructor
+     */
+    MetricsRegistry();
+
+    /**
+     * (private)<br>
+     * Gets the family of the provided name, creates it if needed.
+     *
+     * @throw IllegalArgumentException If the name is empty or is used by another type of metric.
+     */
+    Family& getFamily(const std::string& name, const std::string& help, const bool isCounter);
+
+    /**
+     * (private)<br>
+     * Renders labels as {name="value",...}, escaping the values.
+     */
+    static const std::string renderLabels(const std::map<std::string, std::string>& labels);
+
+    /**
+     * (private)<br>
+     * Escapes backslashes, double quotes and line feeds.
+     */
+    static const std::string escape(const std::string& value, const bool escapeQuotes);
+};
+
+}
+}
+}
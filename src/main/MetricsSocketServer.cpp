@@ -0,0 +1,167 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "MetricsSocketServer.h"
+
+#include <cerrno>
+#include <cstring>
+
+#if !defined(WIN32)
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#if !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+/* Keyple Core Util */
+#include "IllegalStateException.h"
+#include "KeypleAssert.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+MetricsSocketServer::MetricsSocketServer(const std::string& socketPath,
+                                         std::shared_ptr<MetricsRegistry> metricsRegistry)
+: mSocketPath(socketPath), mMetricsRegistry(metricsRegistry), mSocket(-1), mRunning(false)
+{
+    Assert::getInstance().notEmpty(socketPath, "socketPath")
+                         .notNull(metricsRegistry, "metricsRegistry");
+}
+
+MetricsSocketServer::~MetricsSocketServer()
+{
+    stop();
+}
+
+bool MetricsSocketServer::isRunning() const
+{
+    return mRunning;
+}
+
+#if defined(WIN32)
+
+void MetricsSocketServer::start()
+{
+    throw IllegalStateException("Unix domain sockets are not supported on this platform.");
+}
+
+void MetricsSocketServer::stop() {}
+
+void MetricsSocketServer::run() {}
+
+#else
+
+void MetricsSocketServer::start()
+{
+    if (mRunning) {
+        throw IllegalStateException("The metrics socket server is already started.");
+    }
+
+    struct sockaddr_un address;
+    if (mSocketPath.size() >= sizeof(address.sun_path)) {
+        throw IllegalStateException("Socket path too long: " + mSocketPath);
+    }
+
+    mSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (mSocket < 0) {
+        throw IllegalStateException("Unable to create the metrics socket: " +
+                                    std::string(std::strerror(errno)));
+    }
+
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, mSocketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    /* Remove a stale socket file left by a previous run */
+    ::unlink(mSocketPath.c_str());
+
+    if (::bind(mSocket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) < 0 ||
+        ::listen(mSocket, 8) < 0) {
+        const std::string error = std::strerror(errno);
+        ::close(mSocket);
+        mSocket = -1;
+        throw IllegalStateException("Unable to bind the metrics socket '" + mSocketPath + "': " +
+                                    error);
+    }
+
+    mRunning = true;
+    mThread = std::thread(&MetricsSocketServer::run, this);
+
+    mLogger->debug("Metrics served on Unix socket '%'\n", mSocketPath);
+}
+
+void MetricsSocketServer::stop()
+{
+    if (!mRunning) {
+        return;
+    }
+
+    mRunning = false;
+
+    if (mThread.joinable()) {
+        mThread.join();
+    }
+
+    ::close(mSocket);
+    mSocket = -1;
+    ::unlink(mSocketPath.c_str());
+
+    mLogger->debug("Metrics socket '%' closed\n", mSocketPath);
+}
+
+void MetricsSocketServer::run()
+{
+    struct pollfd pfd;
+    pfd.fd = mSocket;
+    pfd.events = POLLIN;
+
+    while (mRunning) {
+        pfd.revents = 0;
+        if (::poll(&pfd, 1, 100) <= 0 || !(pfd.revents & POLLIN)) {
+            continue;
+        }
+
+        const int client = ::accept(mSocket, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        const std::string text = mMetricsRegistry->renderPrometheusText();
+        size_t offset = 0;
+        while (offset < text.size()) {
+            const ssize_t written = ::send(client,
+                                           text.data() + offset,
+                                           text.size() - offset,
+                                           MSG_NOSIGNAL);
+            if (written <= 0) {
+                break;
+            }
+            offset += static_cast<size_t>(written);
+        }
+
+        ::close(client);
+    }
+}
+
+#endif
+
+}
+}
+}
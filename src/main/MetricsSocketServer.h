@@ -0,0 +1,136 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <typeinfo>
+
+/* Keyple Core Service */
+#include "KeypleServiceExport.h"
+#include "MetricsRegistry.h"
+
+/* Keyple Core Util */
+#include "LoggerFactory.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util::cpp;
+
+/**
+ * Serves the Prometheus text rendering of a MetricsRegistry on a Unix domain socket.
+ *
+ * <p>Each client connecting to the socket receives the current rendering, then the connection is
+ * closed by the server. A local scraper can therefore read the metrics with e.g.
+ * <code>socat - UNIX-CONNECT:/run/keyple/metrics.sock</code>.
+ *
+ * <p>Unix domain sockets are not supported on Windows, start() throws in that case.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API MetricsSocketServer final {
+public:
+    /**
+     * Constructor.
+     *
+     * @param socketPath The path of the socket file to create.
+     * @param metricsRegistry The registry to expose.
+     * @since 2.0.0
+     */
+    MetricsSocketServer(const std::string& socketPath,
+                        std::shared_ptr<MetricsRegistry> metricsRegistry);
+
+    /**
+     * Stops the server if needed.
+     */
+    ~MetricsSocketServer();
+
+    /**
+     * Creates the socket and starts serving connections in a dedicated thread.
+     *
+     * @throw IllegalStateException If the server is already started or if the socket cannot be
+     *        created.
+     * @since 2.0.0
+     */
+    void start();
+
+    /**
+     * Stops serving connections and removes the socket file.
+     *
+     * @since 2.0.0
+     */
+    void stop();
+
+    /**
+     * Indicates whether the server is serving connections.
+     *
+     * @return True if the server is started.
+     * @since 2.0.0
+     */
+    bool isRunning() const;
+
+    /**
+     *
+     */
+    MetricsSocketServer(const MetricsSocketServer& o) = delete;
+
+    /**
+     *
+     */
+    MetricsSocketServer& operator=(const MetricsSocketServer& o) = delete;
+
+private:
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger = LoggerFactory::getLogger(typeid(MetricsSocketServer));
+
+    /**
+     *
+     */
+    const std::string mSocketPath;
+
+    /**
+     *
+     */
+    std::shared_ptr<MetricsRegistry> mMetricsRegistry;
+
+    /**
+     *
+     */
+    int mSocket;
+
+    /**
+     *
+     */
+    std::atomic<bool> mRunning;
+
+    /**
+     *
+     */
+    std::thread mThread;
+
+    /**
+     * (private)<br>
+     * Accept loop, polls the listening socket every 100 ms to check for a stop request.
+     */
+    void run();
+};
+
+}
+}
+}
@@ -12,6 +12,8 @@
 
 #include "ObservableLocalPluginAdapter.h"
 
+#include <functional>
+
 /* Keyple Core Service */
 #include "KeyplePluginException.h"
 #include "LocalReaderAdapter.h"
@@ -26,6 +28,7 @@
 
 /* Keyple Core Plugin */
 #include "PluginIOException.h"
+#include "TaskCanceledException.h"
 
 namespace keyple {
 namespace core {
@@ -44,7 +47,9 @@ using namespace keyple::core::util::cpp::exception;
 ObservableLocalPluginAdapter::ObservableLocalPluginAdapter(
   std::shared_ptr<ObservablePluginSpi> observablePluginSpi)
 : AbstractObservableLocalPluginAdapter(observablePluginSpi),
-  mObservablePluginSpi(observablePluginSpi) {}
+  mObservablePluginSpi(observablePluginSpi),
+  mWaitForReaderListChangeSpi(
+      std::dynamic_pointer_cast<WaitForReaderListChangeBlockingSpi>(observablePluginSpi)) {}
 
 ObservableLocalPluginAdapter::~ObservableLocalPluginAdapter()
 {
@@ -125,11 +130,17 @@ ObservableLocalPluginAdapter::EventThread::EventThread(const std::string& plugin
   mRunning(true),
   mStarted(false),
   mTerminated(false),
-  mParent(parent) {}
+  mParent(parent),
+  mKnownReaderNamesFingerprint(0) {}
 
 void ObservableLocalPluginAdapter::EventThread::end()
 {
     mRunning = false;
+
+    if (mParent->mWaitForReaderListChangeSpi != nullptr) {
+        mParent->mWaitForReaderListChangeSpi->stopWaitForReaderListChange();
+    }
+
     interrupt();
 }
 
@@ -144,7 +155,12 @@ void ObservableLocalPluginAdapter::EventThread::addReader(const std::string& rea
     std::shared_ptr<LocalReaderAdapter> reader = mParent->buildLocalReaderAdapter(readerSpi);
 
     reader->doRegister();
-    mParent->getReadersMap().insert({reader->getName(), reader});
+    mParent->addReaderToMap(reader);
+    mParent->mReaderConnectedCounter->increment();
+
+    if (mKnownReaderNames.insert(reader->getName()).second) {
+        mKnownReaderNamesFingerprint += fingerprint(reader->getName());
+    }
 
     mParent->mLogger->trace("[%][%] Plugin thread => Add plugged reader to readers list\n",
                             mPluginName,
@@ -154,7 +170,12 @@ void ObservableLocalPluginAdapter::EventThread::addReader(const std::string& rea
 void ObservableLocalPluginAdapter::EventThread::removeReader(const std::shared_ptr<Reader> reader)
 {
     std::dynamic_pointer_cast<LocalReaderAdapter>(reader)->doUnregister();
-    mParent->getReadersMap().erase(reader->getName());
+    mParent->removeReaderFromMap(reader->getName());
+    mParent->mReaderDisconnectedCounter->increment();
+
+    if (mKnownReaderNames.erase(reader->getName())) {
+        mKnownReaderNamesFingerprint -= fingerprint(reader->getName());
+    }
 
     mParent->mLogger->trace("[%][%] Plugin thread => Remove unplugged reader from readers list\n",
                             mPluginName,
@@ -172,30 +193,67 @@ void ObservableLocalPluginAdapter::EventThread::notifyChanges(
     mParent->notifyObservers(std::make_shared<PluginEventAdapter>(mPluginName, changedReaderNames, type));
 }
 
+uint64_t ObservableLocalPluginAdapter::EventThread::fingerprint(const std::string& readerName)
+{
+    /* Spreads the bits of the hash (splitmix64 finalizer) so that sums hardly collide */
+    uint64_t h = static_cast<uint64_t>(std::hash<std::string>()(readerName));
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+
+    return h ^ (h >> 31);
+}
+
+void ObservableLocalPluginAdapter::EventThread::initKnownReaderNames()
+{
+    mKnownReaderNames.clear();
+    mKnownReaderNamesFingerprint = 0;
+
+    const auto readers = mParent->getReadersSnapshot();
+    for (const auto& pair : *readers) {
+        mKnownReaderNames.insert(pair.first);
+        mKnownReaderNamesFingerprint += fingerprint(pair.first);
+    }
+}
+
+bool ObservableLocalPluginAdapter::EventThread::hasChanged(
+    const std::vector<std::string>& actualNativeReaderNames) const
+{
+    if (actualNativeReaderNames.size() != mKnownReaderNames.size()) {
+        return true;
+    }
+
+    uint64_t actualFingerprint = 0;
+    for (const auto& readerName : actualNativeReaderNames) {
+        actualFingerprint += fingerprint(readerName);
+    }
+
+    return actualFingerprint != mKnownReaderNamesFingerprint;
+}
+
 void ObservableLocalPluginAdapter::EventThread::processChanges(
     const std::vector<std::string>& actualNativeReaderNames)
 {
     std::vector<std::string> changedReaderNames;
 
+    /* Index the native names once, the buckets are reused from a cycle to another */
+    mNativeReaderNames.clear();
+    mNativeReaderNames.insert(actualNativeReaderNames.begin(), actualNativeReaderNames.end());
+
     /* Parse the current readers list, notify for disappeared readers, update readers list */
-    const std::vector<std::shared_ptr<Reader>> readers = mParent->getReaders();
-    for (const auto& reader : readers) {
-        if (!std::count(actualNativeReaderNames.begin(),
-                        actualNativeReaderNames.end(),
-                        reader->getName())) {
-            changedReaderNames.push_back(reader->getName());
+    const auto readers = mParent->getReadersSnapshot();
+    std::vector<std::shared_ptr<Reader>> disappearedReaders;
+    for (const auto& pair : *readers) {
+        if (!mNativeReaderNames.count(pair.first)) {
+            disappearedReaders.push_back(pair.second);
+            changedReaderNames.push_back(pair.first);
         }
     }
 
     /* Notify disconnections if any and update the reader list */
     if (!changedReaderNames.empty()) {
         /* List update */
-        for (const auto& reader : readers) {
-            if (!std::count(actualNativeReaderNames.begin(),
-                            actualNativeReaderNames.end(),
-                            reader->getName())) {
-                removeReader(reader);
-            }
+        for (const auto& reader : disappearedReaders) {
+            removeReader(reader);
         }
 
         notifyChanges(PluginEvent::Type::READER_DISCONNECTED, changedReaderNames);
@@ -206,8 +264,7 @@ void ObservableLocalPluginAdapter::EventThread::processChanges(
 
     /* Parse the new readers list, notify for readers appearance, update readers list */
     for (const auto& readerName : actualNativeReaderNames) {
-        const std::vector<std::string>& readerNames = mParent->getReaderNames();
-        if (!std::count(readerNames.begin(), readerNames.end(), readerName)) {
+        if (!mKnownReaderNames.count(readerName)) {
             addReader(readerName);
 
             /* Add to the notification list */
@@ -221,8 +278,27 @@ void ObservableLocalPluginAdapter::EventThread::processChanges(
     }
 }
 
+void ObservableLocalPluginAdapter::EventThread::waitForReaderListChange()
+{
+    if (mParent->mWaitForReaderListChangeSpi == nullptr) {
+        /* Sleep for a while */
+        Thread::sleep(mMonitoringCycleDuration);
+        return;
+    }
+
+    try {
+        mParent->mWaitForReaderListChangeSpi->waitForReaderListChange();
+    } catch (const TaskCanceledException& e) {
+        (void)e;
+        mParent->mLogger->trace("[%] Plugin thread => Wait for reader list change stopped\n",
+                                mPluginName);
+    }
+}
+
 void ObservableLocalPluginAdapter::EventThread::execute()
 {
+    initKnownReaderNames();
+
     mStarted = true;
 
     try {
@@ -231,16 +307,15 @@ void ObservableLocalPluginAdapter::EventThread::execute()
             const std::vector<std::string> actualNativeReaderNames =
                 mParent->mObservablePluginSpi->searchAvailableReaderNames();
 
-            /* Checks if it has changed this algorithm favors cases where nothing change */
-            const std::vector<std::string> currentlyRegisteredReaderNames =
-                mParent->getReaderNames();
-            if (!Arrays::containsAll(currentlyRegisteredReaderNames, actualNativeReaderNames) ||
-                !Arrays::containsAll(actualNativeReaderNames, currentlyRegisteredReaderNames)) {
+            /*
+             * Checks if it has changed, this algorithm favors cases where nothing change: the
+             * names are only hashed, the sets are diffed only when the fingerprints differ.
+             */
+            if (hasChanged(actualNativeReaderNames)) {
                 processChanges(actualNativeReaderNames);
             }
 
-            /* Sleep for a while */
-            Thread::sleep(mMonitoringCycleDuration);
+            waitForReaderListChange();
         }
     } catch (const InterruptedException& e) {
         (void)e;
@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <typeinfo>
+#include <unordered_set>
 
 /* Keyple Core Util */
 #include "LoggerFactory.h"
@@ -27,12 +29,16 @@
 /* Keyple Core Plugin */
 #include "ObservablePluginSpi.h"
 
+/* Keyple Core Service */
+#include "WaitForReaderListChangeBlockingSpi.h"
+
 
 namespace keyple {
 namespace core {
 namespace service {
 
 using namespace keyple::core::plugin::spi;
+using namespace keyple::core::service::spi;
 using namespace keyple::core::util::cpp;
 
 /**
@@ -164,6 +170,48 @@ private:
          */
         ObservableLocalPluginAdapter* mParent;
 
+        /**
+         * Names of the registered readers, mirrored by the thread which is the only one to add or
+         * remove readers while monitoring.
+         */
+        std::unordered_set<std::string> mKnownReaderNames;
+
+        /**
+         * Order-independent fingerprint of mKnownReaderNames, updated with each add or remove.
+         */
+        uint64_t mKnownReaderNamesFingerprint;
+
+        /**
+         * Index of the native reader names, kept between cycles to reuse its buckets.
+         */
+        std::unordered_set<std::string> mNativeReaderNames;
+
+        /**
+         * (private)<br>
+         * Computes the fingerprint of a reader name, a set of names being fingerprinted by the sum
+         * of the fingerprints of its names.
+         *
+         * @param readerName The name of the reader.
+         * @return A 64-bit hash.
+         */
+        static uint64_t fingerprint(const std::string& readerName);
+
+        /**
+         * (private)<br>
+         * Initializes the known reader names from the readers currently registered in the plugin.
+         */
+        void initKnownReaderNames();
+
+        /**
+         * (private)<br>
+         * Indicates whether the native reader names differ from the known reader names, by
+         * comparing their count and fingerprint, without any allocation.
+         *
+         * @param actualNativeReaderNames the list of readers currently known by the system
+         * @return True if a change is detected.
+         */
+        bool hasChanged(const std::vector<std::string>& actualNativeReaderNames) const;
+
         /**
          * (private)<br>
          * Adds a reader to the list of known readers (by the plugin)
@@ -197,6 +245,15 @@ private:
          */
         void processChanges(const std::vector<std::string>& actualNativeReaderNames);
 
+        /**
+         * (private)<br>
+         * Waits for a possible change of the reader list: until the plugin signals it when it
+         * implements WaitForReaderListChangeBlockingSpi, during a monitoring cycle otherwise.
+         *
+         * @throw PluginIOException if an error occurs while waiting.
+         */
+        void waitForReaderListChange();
+
         /**
          * Reader monitoring loop<br>
          * Checks reader insertions and removals<br>
@@ -218,6 +275,11 @@ private:
      */
     std::shared_ptr<ObservablePluginSpi> mObservablePluginSpi;
 
+    /**
+     * The plugin SPI when it signals its reader list changes, nullptr when it has to be polled.
+     */
+    std::shared_ptr<WaitForReaderListChangeBlockingSpi> mWaitForReaderListChangeSpi;
+
 
     /**
      * Local thread to monitoring readers presence
@@ -12,9 +12,8 @@
 
 #include "ObservableLocalReaderAdapter.h"
 
-/* Calypsonet Terminal Card */
-#include "CardBrokenCommunicationException.h"
-#include "ReaderBrokenCommunicationException.h"
+#include <functional>
+#include <thread>
 
 /* Calypsonet Terminal Reader */
 #include "ReaderCommunicationException.h"
@@ -23,16 +22,20 @@
 #include "CardIOException.h"
 #include "ObservableReaderStateServiceAdapter.h"
 #include "ReaderIOException.h"
+#include "TaskCanceledException.h"
 #include "WaitForCardInsertionAutonomousSpi.h"
 #include "WaitForCardRemovalAutonomousSpi.h"
 
 /* Keyple Core Service */
 #include "ReaderEventAdapter.h"
 #include "ScheduledCardSelectionsResponseAdapter.h"
+#include "TimerService.h"
+#include "TraceRecorder.h"
 
 /* Keyple Core Util */
 #include "Arrays.h"
 #include "Exception.h"
+#include "IllegalArgumentException.h"
 #include "KeypleAssert.h"
 
 namespace keyple {
@@ -71,23 +74,56 @@ ObservableLocalReaderAdapter::ObservableLocalReaderAdapter(
   std::shared_ptr<ObservableReaderSpi> observableReaderSpi, const std::string& pluginName)
 : LocalReaderAdapter(observableReaderSpi, pluginName),
   mObservableReaderSpi(observableReaderSpi),
+  mPollingPolicy(std::make_shared<PollingPolicy>()),
   mStateService(std::make_shared<ObservableReaderStateServiceAdapter>(this)),
   mObservationManager(
       std::make_shared<ObservationManagerAdapter<CardReaderObserverSpi,
                                                  CardReaderObservationExceptionHandlerSpi>>(
-          pluginName, getName()))
+          pluginName, getName())),
+  mCardProcessingTimeout(0),
+  mCardProcessingTimerId(0),
+  mCardProcessingTimerGeneration(0),
+  mPresenceProbeStrategy(PresenceProbeStrategy::AUTO)
 {
-    auto insert = std::dynamic_pointer_cast<WaitForCardInsertionAutonomousSpi>(observableReaderSpi);
+    const auto& insert = getCapabilities().getWaitForCardInsertionAutonomousSpi();
     if (insert) {
         insert->connect(
             dynamic_cast<WaitForCardInsertionAutonomousReaderApi*>(this));
     }
 
-    auto remove = std::dynamic_pointer_cast<WaitForCardRemovalAutonomousSpi>(observableReaderSpi);
+    const auto& remove = getCapabilities().getWaitForCardRemovalAutonomousSpi();
     if (remove) {
         remove->connect(
             dynamic_cast<WaitForCardRemovalAutonomousReaderApi*>(this));
     }
+
+    const auto metrics = MetricsRegistry::getInstance();
+    mObserverExceptionCounter = metrics->getCounter(MetricsRegistry::OBSERVER_EXCEPTION,
+                                                    "Number of exceptions raised by the reader " \
+                                                    "observers.",
+                                                    {{"plugin", pluginName},
+                                                     {"reader", getName()}});
+    mCardProcessingTimeoutCounter = metrics->getCounter(MetricsRegistry::CARD_PROCESSING_TIMEOUT,
+                                                        "Number of card processings aborted " \
+                                                        "after the card processing timeout.",
+                                                        {{"plugin", pluginName},
+                                                         {"reader", getName()}});
+
+    const std::map<MonitoringState, std::string> states = {
+        {MonitoringState::WAIT_FOR_START_DETECTION, "WAIT_FOR_START_DETECTION"},
+        {MonitoringState::WAIT_FOR_CARD_INSERTION, "WAIT_FOR_CARD_INSERTION"},
+        {MonitoringState::WAIT_FOR_CARD_PROCESSING, "WAIT_FOR_CARD_PROCESSING"},
+        {MonitoringState::WAIT_FOR_CARD_REMOVAL, "WAIT_FOR_CARD_REMOVAL"}};
+    for (const auto& state : states) {
+        mStateTransitionCounters.insert(
+            {state.first,
+             metrics->getCounter(MetricsRegistry::STATE_TRANSITION,
+                                 "Number of transitions of the reader monitoring state machine, " \
+                                 "by target state.",
+                                 {{"plugin", pluginName},
+                                  {"reader", getName()},
+                                  {"state", state.second}})});
+    }
 }
 
 std::shared_ptr<ObservableReaderSpi> ObservableLocalReaderAdapter::getObservableReaderSpi() const
@@ -111,7 +147,41 @@ MonitoringState ObservableLocalReaderAdapter::getCurrentMonitoringState() const
     return mStateService->getCurrentMonitoringState();
 }
 
-bool ObservableLocalReaderAdapter::isCardPresentPing()
+CardPresenceProbeSpi::Result ObservableLocalReaderAdapter::probeCardPresence()
+{
+    PresenceProbeStrategy strategy = mPresenceProbeStrategy;
+    const auto& probeSpi = getCapabilities().getCardPresenceProbeSpi();
+
+    if (strategy == PresenceProbeStrategy::AUTO) {
+        strategy = probeSpi ? PresenceProbeStrategy::DRIVER_PROBE :
+                              PresenceProbeStrategy::APDU_PING;
+    }
+
+    switch (strategy) {
+    case PresenceProbeStrategy::DRIVER_PROBE: {
+        const CardPresenceProbeSpi::Result result = probeSpi->probeCardPresence();
+        if (result == CardPresenceProbeSpi::Result::PROBE_FAILED) {
+            mReaderIOExceptionCounter->increment();
+            notifyReaderMonitoringError(ReaderIOException("The card presence probe failed."));
+        }
+        return result;
+    }
+    case PresenceProbeStrategy::CHECK_CARD_PRESENCE:
+        try {
+            return mObservableReaderSpi->checkCardPresence() ?
+                       CardPresenceProbeSpi::Result::CARD_PRESENT :
+                       CardPresenceProbeSpi::Result::CARD_ABSENT;
+        } catch (const ReaderIOException& e) {
+            mReaderIOExceptionCounter->increment();
+            notifyReaderMonitoringError(e);
+            return CardPresenceProbeSpi::Result::PROBE_FAILED;
+        }
+    default:
+        return pingCardPresence();
+    }
+}
+
+CardPresenceProbeSpi::Result ObservableLocalReaderAdapter::pingCardPresence()
 {
     /* Transmits the APDU and checks for the IO exception */
     try {
@@ -119,25 +189,35 @@ bool ObservableLocalReaderAdapter::isCardPresentPing()
 
         mObservableReaderSpi->transmitApdu(APDU_PING_CARD_PRESENCE);
     } catch (const ReaderIOException& e) {
-        /* Notify the reader communication failure with the exception handler */
-        const auto rioe = std::make_shared<ReaderIOException>(e);
-        const auto rce = std::make_shared<ReaderCommunicationException>(READER_MONITORING_ERROR, rioe);
-        getObservationExceptionHandler()->onReaderObservationError(getPluginName(),
-                                                                   getName(),
-                                                                   rce);
+        mReaderIOExceptionCounter->increment();
+        notifyReaderMonitoringError(e);
+
+        return CardPresenceProbeSpi::Result::PROBE_FAILED;
     } catch (const CardIOException& e) {
-        mLogger->trace("[%] Exception occurred in isCardPresentPing. Message: %\n",
+        mCardIOExceptionCounter->increment();
+
+        mLogger->trace("[%] Exception occurred in pingCardPresence. Message: %\n",
                        getName(),
                        e.getMessage());
 
-        return false;
+        return CardPresenceProbeSpi::Result::CARD_ABSENT;
     }
 
-    return true;
+    return CardPresenceProbeSpi::Result::CARD_PRESENT;
+}
+
+void ObservableLocalReaderAdapter::notifyReaderMonitoringError(const ReaderIOException& e)
+{
+    /* Notify the reader communication failure with the exception handler */
+    const auto rioe = std::make_shared<ReaderIOException>(e);
+    const auto rce = std::make_shared<ReaderCommunicationException>(READER_MONITORING_ERROR, rioe);
+    getObservationExceptionHandler()->onReaderObservationError(getPluginName(), getName(), rce);
 }
 
 std::shared_ptr<ReaderEvent> ObservableLocalReaderAdapter::processCardInserted()
 {
+    TraceRecorder::Span span("ObservableLocalReaderAdapter::processCardInserted", getName());
+
     /* RL-DET-INSNOTIF.1 */
     mLogger->trace("[%] process the inserted card\n", getName());
 
@@ -155,12 +235,14 @@ std::shared_ptr<ReaderEvent> ObservableLocalReaderAdapter::processCardInserted()
      * A card selection scenario is defined, send it and notify according to the notification mode
      * and the selection status
      */
-    try {
-        const std::vector<std::shared_ptr<CardSelectionResponseApi>> cardSelectionResponses =
-            transmitCardSelectionRequests(
-                mCardSelectionScenario->getCardSelectionRequests(),
-                mCardSelectionScenario->getMultiSelectionProcessing(),
-                mCardSelectionScenario->getChannelControl());
+    const TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>> result =
+        tryTransmitCardSelectionRequests(mCardSelectionScenario->getCardSelectionRequests(),
+                                         mCardSelectionScenario->getMultiSelectionProcessing(),
+                                         mCardSelectionScenario->getChannelControl());
+
+    if (result.isSuccess()) {
+        const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponses =
+            result.getValue();
 
         if (hasACardMatched(cardSelectionResponses)) {
             return std::make_shared<ReaderEventAdapter>(
@@ -191,17 +273,19 @@ std::shared_ptr<ReaderEvent> ObservableLocalReaderAdapter::processCardInserted()
                    CardReaderEvent::Type::CARD_INSERTED,
                    std::make_shared<ScheduledCardSelectionsResponseAdapter>(
                        cardSelectionResponses));
+    }
 
-    } catch (const ReaderBrokenCommunicationException& e) {
+    const std::shared_ptr<const TransmitFailure>& failure = result.getFailure();
+
+    if (failure->getType() == TransmitFailure::Type::READER_BROKEN_COMMUNICATION) {
         /* Notify the reader communication failure with the exception handler */
-        const auto rbce = std::make_shared<ReaderBrokenCommunicationException>(e);
         const auto rce = std::make_shared<ReaderCommunicationException>(READER_MONITORING_ERROR,
-                                                                        rbce);
+                                                                        failure->toException());
         getObservationExceptionHandler()->onReaderObservationError(getPluginName(),
                                                                    getName(),
                                                                    rce);
 
-    } catch (const CardBrokenCommunicationException& e) {
+    } else {
         /* The last transmission failed, close the logical and physical channels */
         closeLogicalAndPhysicalChannelsSilently();
 
@@ -211,7 +295,7 @@ std::shared_ptr<ReaderEvent> ObservableLocalReaderAdapter::processCardInserted()
          */
         mLogger->debug("A card error or communication exception occurred while processing the " \
                        "card selection scenario. %\n",
-                       e.getMessage());
+                       failure->getMessage());
     }
 
     /*
@@ -221,6 +305,8 @@ std::shared_ptr<ReaderEvent> ObservableLocalReaderAdapter::processCardInserted()
     try {
         mObservableReaderSpi->closePhysicalChannel();
     } catch (const ReaderIOException& e) {
+        mReaderIOExceptionCounter->increment();
+
         /* Notify the reader communication failure with the exception handler */
         const auto rioe = std::make_shared<ReaderIOException>(e);
         const auto rce = std::make_shared<ReaderCommunicationException>(READER_MONITORING_ERROR,
@@ -259,27 +345,146 @@ void ObservableLocalReaderAdapter::processCardRemoved()
 
 void ObservableLocalReaderAdapter::switchState(const MonitoringState stateId)
 {
+    mStateTransitionCounters.at(stateId)->increment();
+    cancelCardProcessingTimer();
     mStateService->switchState(stateId);
+
+    if (stateId == MonitoringState::WAIT_FOR_CARD_PROCESSING) {
+        startCardProcessingTimer();
+    }
+}
+
+void ObservableLocalReaderAdapter::setCardProcessingTimeout(const int timeoutMillis)
+{
+    Assert::getInstance().greaterOrEqual(timeoutMillis, 0, "timeoutMillis");
+
+    /* Applies from the next card processing */
+    mCardProcessingTimeout = timeoutMillis;
+}
+
+std::shared_ptr<PollingPolicy> ObservableLocalReaderAdapter::getPollingPolicy() const
+{
+    return mPollingPolicy;
+}
+
+void ObservableLocalReaderAdapter::setPresenceProbeStrategy(const PresenceProbeStrategy strategy)
+{
+    if (strategy == PresenceProbeStrategy::DRIVER_PROBE &&
+        !getCapabilities().has(ReaderCapabilities::CARD_PRESENCE_PROBE)) {
+        throw IllegalArgumentException("The reader does not provide a driver-level presence " \
+                                       "probe.");
+    }
+
+    mPresenceProbeStrategy = strategy;
+}
+
+ObservableLocalReaderAdapter::PresenceProbeStrategy
+    ObservableLocalReaderAdapter::getPresenceProbeStrategy() const
+{
+    return mPresenceProbeStrategy;
+}
+
+void ObservableLocalReaderAdapter::processCardProcessingTimeout()
+{
+    mCardProcessingTimeoutCounter->increment();
+
+    mLogger->warn("[%] the card processing was not finalized within % ms, abort it\n",
+                  getName(),
+                  mCardProcessingTimeout.load());
+
+    closeLogicalAndPhysicalChannelsSilently();
+
+    try {
+        getObservationExceptionHandler()->onReaderObservationError(
+            getPluginName(),
+            getName(),
+            std::make_shared<TaskCanceledException>("The card processing was not finalized " \
+                                                    "in time."));
+    } catch (const Exception& e) {
+        mLogger->error("Exception during notification", e);
+    }
+}
+
+void ObservableLocalReaderAdapter::startCardProcessingTimer()
+{
+    const int timeoutMillis = mCardProcessingTimeout;
+    if (timeoutMillis == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mCardProcessingTimerMutex);
+
+    const uint64_t generation = ++mCardProcessingTimerGeneration;
+    const std::function<bool()> isTimerPending = [this, generation]() {
+        return isCardProcessingTimerPending(generation);
+    };
+
+    /* The timer thread only hands the timeout over to the monitoring thread */
+    mCardProcessingTimerId =
+        TimerService::getInstance()->schedule(timeoutMillis, [this, isTimerPending]() {
+            mStateService->onCardProcessingTimerExpired(isTimerPending);
+        });
+}
+
+bool ObservableLocalReaderAdapter::isCardProcessingTimerPending(const uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(mCardProcessingTimerMutex);
+
+    return generation == mCardProcessingTimerGeneration;
+}
+
+void ObservableLocalReaderAdapter::cancelCardProcessingTimer()
+{
+    uint64_t timerId;
+
+    {
+        std::lock_guard<std::mutex> lock(mCardProcessingTimerMutex);
+        timerId = mCardProcessingTimerId;
+        mCardProcessingTimerId = 0;
+
+        /* A timeout already handed over to the monitoring thread is dropped */
+        mCardProcessingTimerGeneration++;
+    }
+
+    /* Unlocked, the cancellation may wait for the end of a running timeout */
+    if (timerId != 0) {
+        TimerService::getInstance()->cancel(timerId);
+    }
 }
 
 void ObservableLocalReaderAdapter::notifyObservers(const std::shared_ptr<ReaderEvent> event)
 {
+    TraceRecorder::Span span("ObservableLocalReaderAdapter::notifyObservers", getName());
+
     mLogger->debug("The reader '%' is notifying the reader event '%' to % observers\n",
                    getName(),
                    event->getType(),
                    countObservers());
 
+    const std::shared_ptr<ExecutorService> eventNotificationExecutorService =
+        mObservationManager->getEventNotificationExecutorService();
+
     for (const auto& observer : mObservationManager->getObservers()) {
-        notifyObserver(observer, event);
+        if (eventNotificationExecutorService == nullptr) {
+            notifyObserver(observer, event);
+        } else {
+            /* Pipelined card processing, the monitoring goes on during the notification */
+            eventNotificationExecutorService->execute(
+                std::make_shared<ObservableLocalReaderAdapterJob>(observer, event, this));
+        }
     }
 }
 
 void ObservableLocalReaderAdapter::notifyObserver(std::shared_ptr<CardReaderObserverSpi> observer,
                                                   const std::shared_ptr<ReaderEvent> event)
 {
+    TraceRecorder::Span span("CardReaderObserverSpi::onReaderEvent", getName());
+
     try {
         observer->onReaderEvent(event);
     } catch (const Exception& e) {
+        mObserverExceptionCounter->increment();
+
         try {
             mObservationManager->getObservationExceptionHandler()
                                ->onReaderObservationError(getPluginName(),
@@ -302,6 +507,45 @@ void ObservableLocalReaderAdapter::scheduleCardSelectionScenario(
     mDetectionMode = detectionMode;
 }
 
+void ObservableLocalReaderAdapter::setPipelinedCardProcessing(const bool pipelined)
+{
+    const std::shared_ptr<ExecutorService> eventNotificationExecutorService =
+        mObservationManager->getEventNotificationExecutorService();
+
+    if (pipelined == (eventNotificationExecutorService != nullptr)) {
+        return;
+    }
+
+    mLogger->debug("The reader '%' of plugin '%' is % the pipelined card processing\n",
+                   getName(),
+                   getPluginName(),
+                   pipelined ? "enabling" : "disabling");
+
+    if (pipelined) {
+        mObservationManager->setEventNotificationExecutorService(
+            std::make_shared<ExecutorService>());
+    } else {
+        /* New events are notified synchronously, the pending ones are delivered before leaving */
+        mObservationManager->setEventNotificationExecutorService(nullptr);
+
+        if (!eventNotificationExecutorService->isExecutorThread()) {
+            eventNotificationExecutorService->drain();
+        } else {
+            /*
+             * Called by an observer, whose notification job cannot wait for itself: the pending
+             * events are delivered once it has returned. Another thread waits for them, keeping
+             * the reader alive, then releases the executor.
+             */
+            std::thread([](const std::shared_ptr<ExecutorService>& executorService,
+                           const std::shared_ptr<ObservableLocalReaderAdapter>&) {
+                            executorService->drain();
+                        },
+                        eventNotificationExecutorService,
+                        shared_from_this()).detach();
+        }
+    }
+}
+
 void ObservableLocalReaderAdapter::doUnregister()
 {
     try {
@@ -318,6 +562,7 @@ void ObservableLocalReaderAdapter::doUnregister()
                                              getName(),
                                              CardReaderEvent::Type::UNAVAILABLE,
                                              nullptr));
+    setPipelinedCardProcessing(false);
     clearObservers();
     LocalReaderAdapter::doUnregister();
 }
@@ -409,11 +654,15 @@ void ObservableLocalReaderAdapter::setReaderObservationExceptionHandler(
 
 void ObservableLocalReaderAdapter::onCardInserted()
 {
+    TraceRecorder::Span span("ObservableLocalReaderAdapter::onCardInserted", getName());
+
     mStateService->onEvent(InternalEvent::CARD_INSERTED);
 }
 
 void ObservableLocalReaderAdapter::onCardRemoved()
 {
+    TraceRecorder::Span span("ObservableLocalReaderAdapter::onCardRemoved", getName());
+
     mStateService->onEvent(InternalEvent::CARD_REMOVED);
 }
 
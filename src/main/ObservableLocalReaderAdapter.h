@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -24,16 +26,20 @@
 
 /* Keyple Core Plugin */
 #include "ObservableReaderSpi.h"
+#include "ReaderIOException.h"
 #include "WaitForCardInsertionAutonomousReaderApi.h"
 #include "WaitForCardRemovalAutonomousReaderApi.h"
 
 /* Keyple Core Service */
+#include "CardPresenceProbeSpi.h"
 #include "CardSelectionScenarioAdapter.h"
 #include "Job.h"
 #include "LocalReaderAdapter.h"
+#include "MetricsRegistry.h"
 #include "MonitoringState.h"
 #include "ObservationManagerAdapter.h"
 #include "ObservableReader.h"
+#include "PollingPolicy.h"
 #include "ReaderEvent.h"
 
 /* Keyple Core Util */
@@ -124,6 +130,43 @@ public:
         TIME_OUT
     };
 
+    /**
+     * Strategy used to check the presence of the card while waiting for its removal, when the
+     * removal is detected by polling (non-blocking readers).
+     *
+     * @since 2.0.0
+     */
+    enum class PresenceProbeStrategy {
+        /**
+         * The driver-level probe when the reader SPI implements CardPresenceProbeSpi, the APDU
+         * ping otherwise.
+         *
+         * @since 2.0.0
+         */
+        AUTO,
+
+        /**
+         * The driver-level probe of the reader SPI (CardPresenceProbeSpi).
+         *
+         * @since 2.0.0
+         */
+        DRIVER_PROBE,
+
+        /**
+         * The checkCardPresence() method of the reader SPI.
+         *
+         * @since 2.0.0
+         */
+        CHECK_CARD_PRESENCE,
+
+        /**
+         * A neutral APDU sent to the card, the card is present as long as it responds.
+         *
+         * @since 2.0.0
+         */
+        APDU_PING
+    };
+
     /**
      * (package-private)<br>
      * Creates an instance of ObservableLocalReaderAdapter.
@@ -178,16 +221,15 @@ public:
 
     /**
      * (package-private)<br>
-     * Sends a neutral APDU to the card to check its presence. The status of the response is not
-     * verified as long as the mere fact that the card responds is sufficient to indicate whether or
-     * not it is present.
+     * Checks the presence of the card with the presence probe strategy of the reader.
      *
-     * <p>This method has to be called regularly until the card no longer respond.
+     * <p>This method has to be called regularly until the card is absent. The reader communication
+     * failures are notified to the observation exception handler and reported as PROBE_FAILED.
      *
-     * @return True if the card still responds, false if not
+     * @return The outcome of the probe.
      * @since 2.0.0
      */
-    bool isCardPresentPing();
+    CardPresenceProbeSpi::Result probeCardPresence();
 
     /**
      * (package-private)<br>
@@ -270,6 +312,86 @@ public:
         const NotificationMode notificationMode,
         const DetectionMode detectionMode);
 
+    /**
+     * Enables or disables the pipelined card processing (disabled by default).
+     *
+     * <p>When enabled, the reader events are notified to the observers by a dedicated thread, in
+     * the order in which they occur, instead of the monitoring thread. The monitoring of the reader
+     * then goes on while the observers are running: in REPEATING detection mode, as soon as the
+     * removal of a card is confirmed, the selection scenario of the next card is processed even if
+     * the observers are still handling the events of the previous one. This suits back-to-back
+     * card processing (e.g. validators), the observers having to call finalizeCardProcessing() as
+     * soon as they no longer need the card.
+     *
+     * <p>Disabling it waits for the pending notifications to be delivered, unless called by an
+     * observer (e.g. unregistering the reader from its callback): they are then delivered once the
+     * callback has returned.
+     *
+     * @param pipelined True to enable the pipelined card processing.
+     * @since 2.0.0
+     */
+    void setPipelinedCardProcessing(const bool pipelined);
+
+    /**
+     * Sets the maximum duration of the card processing (disabled by default).
+     *
+     * <p>If the observers do not call finalizeCardProcessing() within this delay after the
+     * notification of a card, the card processing is aborted: the channels are closed, the timeout
+     * is notified to the observation exception handler as a TaskCanceledException and the card
+     * detection goes on (the removal of the card is awaited in REPEATING detection mode).
+     *
+     * <p>The deadlines of all the readers are handled by the service-wide TimerService, the abort
+     * itself being processed by the monitoring thread of the reader, one event at a time: it waits
+     * for the end of an observer notified by this thread (see setPipelinedCardProcessing()).
+     *
+     * @param timeoutMillis The timeout in milliseconds, 0 to disable it.
+     * @throw IllegalArgumentException If the timeout is negative.
+     * @since 2.0.0
+     */
+    void setCardProcessingTimeout(const int timeoutMillis);
+
+    /**
+     * Gets the polling policy of the non-blocking card insertion and removal monitoring of the
+     * reader, allowing to tune its cadence (cycle duration bounds, time-of-day profiles).
+     *
+     * <p>The changes apply from the next presence poll.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    std::shared_ptr<PollingPolicy> getPollingPolicy() const;
+
+    /**
+     * Sets the strategy used to check the presence of the card while waiting for its removal
+     * (AUTO by default).
+     *
+     * <p>Only relevant for the readers whose removal is detected by polling (non-blocking
+     * readers). The change applies from the next presence poll.
+     *
+     * @param strategy The presence probe strategy.
+     * @throw IllegalArgumentException If DRIVER_PROBE is requested but the reader SPI does not
+     *        implement CardPresenceProbeSpi.
+     * @since 2.0.0
+     */
+    void setPresenceProbeStrategy(const PresenceProbeStrategy strategy);
+
+    /**
+     * Gets the strategy used to check the presence of the card while waiting for its removal.
+     *
+     * @return The strategy set, AUTO by default.
+     * @since 2.0.0
+     */
+    PresenceProbeStrategy getPresenceProbeStrategy() const;
+
+    /**
+     * (package-private)<br>
+     * Aborts the card processing after the expiry of the card processing timeout: closes the
+     * channels and notifies the timeout to the observation exception handler.
+     *
+     * @since 2.0.0
+     */
+    void processCardProcessingTimeout();
+
     /**
      * {@inheritDoc}
      *
@@ -410,6 +532,11 @@ private:
      */
     std::shared_ptr<ObservableReaderSpi> mObservableReaderSpi;
 
+    /**
+     * C++: declared before mStateService, the monitoring jobs it creates rely on it
+     */
+    const std::shared_ptr<PollingPolicy> mPollingPolicy;
+
     /**
      *
      */
@@ -437,6 +564,39 @@ private:
      */
     DetectionMode mDetectionMode;
 
+    /**
+     * Metrics of the observation, registered once at construction.
+     */
+    std::shared_ptr<MetricsRegistry::Counter> mObserverExceptionCounter;
+    std::map<MonitoringState, std::shared_ptr<MetricsRegistry::Counter>> mStateTransitionCounters;
+    std::shared_ptr<MetricsRegistry::Counter> mCardProcessingTimeoutCounter;
+
+    /**
+     * Card processing timeout in milliseconds, 0 if disabled.
+     */
+    std::atomic<int> mCardProcessingTimeout;
+
+    /**
+     * Protects mCardProcessingTimerId and mCardProcessingTimerGeneration.
+     */
+    std::mutex mCardProcessingTimerMutex;
+
+    /**
+     * Identifier of the pending card processing timer, 0 if none.
+     */
+    uint64_t mCardProcessingTimerId;
+
+    /**
+     * Incremented each time the card processing timer is armed or disarmed, identifies the
+     * pending timer.
+     */
+    uint64_t mCardProcessingTimerGeneration;
+
+    /**
+     *
+     */
+    std::atomic<PresenceProbeStrategy> mPresenceProbeStrategy;
+
     /**
      * Notifies a single observer of an event.
      *
@@ -454,6 +614,42 @@ private:
      */
     bool hasACardMatched(
         const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponses);
+
+    /**
+     * Sends a neutral APDU to the card to check its presence. The status of the response is not
+     * verified as long as the mere fact that the card responds is sufficient to indicate whether or
+     * not it is present.
+     *
+     * @return CARD_PRESENT if the card still responds, CARD_ABSENT if not, PROBE_FAILED if the
+     *         reader failed.
+     */
+    CardPresenceProbeSpi::Result pingCardPresence();
+
+    /**
+     * Notifies a reader communication failure during the monitoring to the observation exception
+     * handler.
+     *
+     * @param e The reader IO exception.
+     */
+    void notifyReaderMonitoringError(const ReaderIOException& e);
+
+    /**
+     * Arms the card processing timer, if a timeout is set.
+     */
+    void startCardProcessingTimer();
+
+    /**
+     * Tells if the card processing timer armed with the provided generation is still pending.
+     *
+     * @param generation The generation of the timer.
+     * @return False if the timer has been disarmed since.
+     */
+    bool isCardProcessingTimerPending(const uint64_t generation);
+
+    /**
+     * Disarms the card processing timer, if any.
+     */
+    void cancelCardProcessingTimer();
 };
 
 }
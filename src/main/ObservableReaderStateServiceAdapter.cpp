@@ -15,20 +15,13 @@
 /* Keyple Core Util */
 #include "IllegalStateException.h"
 
-/* Keyple Core Plugin */
-#include "DontWaitForCardRemovalDuringProcessingSpi.h"
-#include "WaitForCardInsertionAutonomousSpi.h"
-#include "WaitForCardInsertionBlockingSpi.h"
-#include "WaitForCardInsertionNonBlockingSpi.h"
-#include "WaitForCardRemovalAutonomousSpi.h"
-#include "WaitForCardRemovalDuringProcessingBlockingSpi.h"
-#include "WaitForCardRemovalNonBlockingSpi.h"
-
 /* Keyple Core Service */
 #include "CardInsertionActiveMonitoringJobAdapter.h"
 #include "CardInsertionPassiveMonitoringJobAdapter.h"
 #include "CardRemovalActiveMonitoringJobAdapter.h"
 #include "CardRemovalPassiveMonitoringJobAdapter.h"
+#include "ReaderCapabilities.h"
+#include "TraceRecorder.h"
 #include "WaitForCardInsertionStateAdapter.h"
 #include "WaitForCardProcessingStateAdapter.h"
 #include "WaitForCardRemovalStateAdapter.h"
@@ -43,29 +36,49 @@ using namespace keyple::core::plugin::spi::reader::observable::state::processing
 using namespace keyple::core::plugin::spi::reader::observable::state::removal;
 using namespace keyple::core::util::cpp::exception;
 
+/* CARD PROCESSING TIMEOUT JOB ------------------------------------------------------------------ */
+
+ObservableReaderStateServiceAdapter::CardProcessingTimeoutJob::CardProcessingTimeoutJob(
+  ObservableReaderStateServiceAdapter* parent, const std::function<bool()>& isTimerPending)
+: Job("CardProcessingTimeoutJob"), mParent(parent), mIsTimerPending(isTimerPending) {}
+
+void ObservableReaderStateServiceAdapter::CardProcessingTimeoutJob::execute()
+{
+    std::lock_guard<std::recursive_mutex> lock(mParent->mEventMutex);
+
+    /* The card processing may have ended since the expiry of the timer */
+    if (mIsTimerPending()) {
+        mParent->onEvent(InternalEvent::TIME_OUT);
+    }
+}
+
+/* OBSERVABLE READER STATE SERVICE ADAPTER ------------------------------------------------------ */
+
 ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
   ObservableLocalReaderAdapter* reader)
 : mReader(reader),
   mReaderSpi(reader->getObservableReaderSpi()),
   mExecutorService(std::make_shared<ExecutorService>())
 {
+    const ReaderCapabilities& capabilities = reader->getCapabilities();
+
     /* Wait for start */
     mStates.insert({MonitoringState::WAIT_FOR_START_DETECTION,
                     std::make_shared<WaitForStartDetectStateAdapter>(mReader)});
 
     /* Insertion */
-    if (std::dynamic_pointer_cast<WaitForCardInsertionAutonomousSpi>(mReaderSpi)) {
+    if (capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_INSERTION_AUTONOMOUS)) {
         mStates.insert({MonitoringState::WAIT_FOR_CARD_INSERTION,
                         std::make_shared<WaitForCardInsertionStateAdapter>(mReader)});
-    } else if (std::dynamic_pointer_cast<WaitForCardInsertionNonBlockingSpi>(mReaderSpi)) {
+    } else if (capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_INSERTION_NON_BLOCKING)) {
         auto cardInsertionActiveMonitoringJobAdapter =
-            std::make_shared<CardInsertionActiveMonitoringJobAdapter>(mReader, 200, true);
+            std::make_shared<CardInsertionActiveMonitoringJobAdapter>(mReader, true);
         mStates.insert({MonitoringState::WAIT_FOR_CARD_INSERTION,
                         std::make_shared<WaitForCardInsertionStateAdapter>(
                             mReader,
                             cardInsertionActiveMonitoringJobAdapter,
                             mExecutorService)});
-    } else if (std::dynamic_pointer_cast<WaitForCardInsertionBlockingSpi>(mReaderSpi)) {
+    } else if (capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_INSERTION_BLOCKING)) {
         auto cardInsertionPassiveMonitoringJobAdapter =
             std::make_shared<CardInsertionPassiveMonitoringJobAdapter>(mReader);
         mStates.insert({MonitoringState::WAIT_FOR_CARD_INSERTION,
@@ -79,7 +92,7 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
     }
 
     /* Processing */
-    if (std::dynamic_pointer_cast<WaitForCardRemovalDuringProcessingBlockingSpi>(mReaderSpi)) {
+    if (capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_REMOVAL_DURING_PROCESSING_BLOCKING)) {
         auto cardRemovalPassiveMonitoringJobAdapter =
             std::make_shared<CardRemovalPassiveMonitoringJobAdapter>(mReader);
         mStates.insert({MonitoringState::WAIT_FOR_CARD_PROCESSING,
@@ -87,7 +100,7 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
                             mReader,
                             cardRemovalPassiveMonitoringJobAdapter,
                             mExecutorService)});
-    } else if (std::dynamic_pointer_cast<DontWaitForCardRemovalDuringProcessingSpi>(mReaderSpi)) {
+    } else if (capabilities.has(ReaderCapabilities::DONT_WAIT_FOR_CARD_REMOVAL_DURING_PROCESSING)) {
         mStates.insert({MonitoringState::WAIT_FOR_CARD_PROCESSING,
                         std::make_shared<WaitForCardProcessingStateAdapter>(mReader)});
     } else {
@@ -96,17 +109,17 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
     }
 
     /* Removal */
-    if (std::dynamic_pointer_cast<WaitForCardRemovalAutonomousSpi>(mReaderSpi)) {
+    if (capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_REMOVAL_AUTONOMOUS)) {
         mStates.insert({MonitoringState::WAIT_FOR_CARD_REMOVAL,
                         std::make_shared<WaitForCardRemovalStateAdapter>(mReader)});
-    } else if (std::dynamic_pointer_cast<WaitForCardRemovalNonBlockingSpi>(mReaderSpi)) {
+    } else if (capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_REMOVAL_NON_BLOCKING)) {
         auto cardRemovalActiveMonitoringJobAdapter =
-            std::make_shared<CardRemovalActiveMonitoringJobAdapter>(mReader, 200);
+            std::make_shared<CardRemovalActiveMonitoringJobAdapter>(mReader);
         mStates.insert({MonitoringState::WAIT_FOR_CARD_REMOVAL,
             std::make_shared<WaitForCardRemovalStateAdapter>(mReader,
                                                              cardRemovalActiveMonitoringJobAdapter,
                                                              mExecutorService)});
-    } else if (std::dynamic_pointer_cast<WaitForCardRemovalBlockingSpi>(mReaderSpi)) {
+    } else if (capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_REMOVAL_BLOCKING)) {
         auto cardRemovalPassiveMonitoringJobAdapter =
             std::make_shared<CardRemovalPassiveMonitoringJobAdapter>(mReader);
         mStates.insert({MonitoringState::WAIT_FOR_CARD_REMOVAL,
@@ -124,25 +137,51 @@ ObservableReaderStateServiceAdapter::ObservableReaderStateServiceAdapter(
 
 void ObservableReaderStateServiceAdapter::onEvent(const InternalEvent event)
 {
-    /* C++: cannot use std::lock_guard as mutex needs to be unlocked before calling onEvent */
-    mMutex.lock();
-
-    switch (event) {
-    case InternalEvent::CARD_INSERTED:
-    case InternalEvent::CARD_REMOVED:
-    case InternalEvent::CARD_PROCESSED:
-    case InternalEvent::TIME_OUT:
-        break;
-    case InternalEvent::START_DETECT:
-        mReaderSpi->onStartDetection();
-        break;
-    case InternalEvent::STOP_DETECT:
-        mReaderSpi->onStopDetection();
-        break;
+    TraceRecorder::Span span("ObservableReaderStateServiceAdapter::onEvent", mReader->getName());
+
+    std::lock_guard<std::recursive_mutex> eventLock(mEventMutex);
+    std::shared_ptr<AbstractObservableStateAdapter> currentState;
+
+    {
+        /* Unlocked before processing the event, the state switches the current state */
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        switch (event) {
+        case InternalEvent::CARD_INSERTED:
+        case InternalEvent::CARD_REMOVED:
+        case InternalEvent::CARD_PROCESSED:
+        case InternalEvent::TIME_OUT:
+            break;
+        case InternalEvent::START_DETECT:
+            mReaderSpi->onStartDetection();
+            break;
+        case InternalEvent::STOP_DETECT:
+            mReaderSpi->onStopDetection();
+            break;
+        }
+
+        currentState = mCurrentState;
+    }
+
+    currentState->onEvent(event);
+}
+
+void ObservableReaderStateServiceAdapter::onCardProcessingTimerExpired(
+    const std::function<bool()>& isTimerPending)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mCurrentState->getMonitoringState() != MonitoringState::WAIT_FOR_CARD_PROCESSING ||
+            !isTimerPending()) {
+            return;
+        }
+
+        /* E.g. a blocking wait for the card removal during the processing */
+        mCurrentState->stopMonitoringJob();
     }
 
-    mMutex.unlock();
-    mCurrentState->onEvent(event);
+    mExecutorService->execute(std::make_shared<CardProcessingTimeoutJob>(this, isTimerPending));
 }
 
 void ObservableReaderStateServiceAdapter::switchState(const MonitoringState stateId)
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -23,6 +24,7 @@
 /* Keyple Core Service */
 #include "AbstractObservableStateAdapter.h"
 #include "ExecutorService.h"
+#include "Job.h"
 #include "MonitoringState.h"
 #include "ObservableLocalReaderAdapter.h"
 
@@ -64,11 +66,28 @@ public:
      * Thread safe method to communicate an internal event to this reader Use this method to inform
      * the reader of external event like a tag discovered or a card inserted
      *
+     * <p>The events are processed one at a time, a state processing an event may communicate
+     * another one from the same thread (e.g. an observer finalizing the card processing).
+     *
      * @param event internal event
      * @since 2.0.0
      */
     void onEvent(const InternalEvent event);
 
+    /**
+     * (package-private)<br>
+     * Hands the TIME_OUT event of the card processing timer over to the monitoring thread, where
+     * it is processed like the other events. Invoked from the timer thread, nothing else is done
+     * there than stopping the monitoring job of the current state to free the monitoring thread.
+     *
+     * <p>The event is dropped if the timer is no longer pending when it is processed (card
+     * processing finalized, card removed or detection stopped meanwhile).
+     *
+     * @param isTimerPending Tells if the expired timer is still pending.
+     * @since 2.0.0
+     */
+    void onCardProcessingTimerExpired(const std::function<bool()>& isTimerPending);
+
     /**
      * (package-private)<br>
      * Thread safe method to switch the state of this reader should only be invoked by this reader or
@@ -109,6 +128,36 @@ public:
     void shutdown();
 
 private:
+    /**
+     * (private)<br>
+     * Job processing the TIME_OUT event of an expired card processing timer on the monitoring
+     * thread.
+     */
+    class CardProcessingTimeoutJob final : public Job {
+    public:
+        /**
+         *
+         */
+        CardProcessingTimeoutJob(ObservableReaderStateServiceAdapter* parent,
+                                 const std::function<bool()>& isTimerPending);
+
+        /**
+         * C++: this replaces run() override
+         */
+        void execute() final;
+
+    private:
+        /**
+         *
+         */
+        ObservableReaderStateServiceAdapter* mParent;
+
+        /**
+         *
+         */
+        const std::function<bool()> mIsTimerPending;
+    };
+
     /**
      * Logger
      */
@@ -144,6 +193,12 @@ private:
      *
      */
     std::mutex mMutex;
+
+    /**
+     * Serializes the processing of the events, reentrant for the events communicated by a state
+     * processing an event.
+     */
+    std::recursive_mutex mEventMutex;
 };
 
 }
@@ -22,6 +22,9 @@
 #include "KeypleAssert.h"
 #include "LoggerFactory.h"
 
+/* Keyple Core Service */
+#include "ExecutorService.h"
+
 namespace keyple {
 namespace core {
 namespace service {
@@ -172,6 +175,36 @@ public:
         return mExceptionHandler;
     }
 
+    /**
+     * (package-private)<br>
+     * Sets the executor service used to notify the observers asynchronously.
+     *
+     * @param eventNotificationExecutorService The executor service, null to notify the observers
+     *        synchronously from the thread raising the event.
+     * @since 2.0.0
+     */
+    void setEventNotificationExecutorService(
+        std::shared_ptr<ExecutorService> eventNotificationExecutorService)
+    {
+        const std::lock_guard<std::mutex> lock(mMonitor);
+
+        mEventNotificationExecutorService = eventNotificationExecutorService;
+    }
+
+    /**
+     * (package-private)<br>
+     * Gets the executor service used to notify the observers asynchronously.
+     *
+     * @return Null if the observers are notified synchronously.
+     * @since 2.0.0
+     */
+    std::shared_ptr<ExecutorService> getEventNotificationExecutorService()
+    {
+        const std::lock_guard<std::mutex> lock(mMonitor);
+
+        return mEventNotificationExecutorService;
+    }
+
 private:
     /**
      *
@@ -194,6 +227,11 @@ private:
      */
     std::shared_ptr<S> mExceptionHandler;
 
+    /**
+     *
+     */
+    std::shared_ptr<ExecutorService> mEventNotificationExecutorService;
+
     /**
      *
      */
@@ -0,0 +1,144 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "PollingPolicy.h"
+
+#include <ctime>
+
+/* Keyple Core Util */
+#include "KeypleAssert.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util;
+
+static const int MINUTES_PER_DAY = 24 * 60;
+
+const int PollingPolicy::DEFAULT_CYCLE_DURATION = 200;
+
+PollingPolicy::PollingPolicy()
+: mMinCycleDuration(DEFAULT_CYCLE_DURATION), mMaxCycleDuration(DEFAULT_CYCLE_DURATION) {}
+
+void PollingPolicy::checkBounds(const int minCycleDurationMillis,
+                                const int maxCycleDurationMillis)
+{
+    Assert::getInstance().greaterOrEqual(minCycleDurationMillis, 1, "minCycleDurationMillis")
+                         .greaterOrEqual(maxCycleDurationMillis,
+                                         minCycleDurationMillis,
+                                         "maxCycleDurationMillis");
+}
+
+void PollingPolicy::setCycleDurationBounds(const int minCycleDurationMillis,
+                                           const int maxCycleDurationMillis)
+{
+    checkBounds(minCycleDurationMillis, maxCycleDurationMillis);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mMinCycleDuration = minCycleDurationMillis;
+    mMaxCycleDuration = maxCycleDurationMillis;
+}
+
+void PollingPolicy::addTimeOfDayProfile(const int startMinute,
+                                        const int endMinute,
+                                        const int minCycleDurationMillis,
+                                        const int maxCycleDurationMillis)
+{
+    Assert::getInstance().isInRange(startMinute, 0, MINUTES_PER_DAY - 1, "startMinute")
+                         .isInRange(endMinute, 0, MINUTES_PER_DAY - 1, "endMinute");
+    checkBounds(minCycleDurationMillis, maxCycleDurationMillis);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mTimeOfDayProfiles.push_back(
+        {startMinute, endMinute, minCycleDurationMillis, maxCycleDurationMillis});
+}
+
+void PollingPolicy::clearTimeOfDayProfiles()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mTimeOfDayProfiles.clear();
+}
+
+int PollingPolicy::getMinCycleDuration() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mMinCycleDuration;
+}
+
+int PollingPolicy::getMaxCycleDuration() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mMaxCycleDuration;
+}
+
+int PollingPolicy::getCycleDuration(const long unsuccessfulPolls) const
+{
+    return getCycleDuration(unsuccessfulPolls, getCurrentMinuteOfDay());
+}
+
+int PollingPolicy::getCycleDuration(const long unsuccessfulPolls, const int minuteOfDay) const
+{
+    int minCycleDuration;
+    int maxCycleDuration;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        minCycleDuration = mMinCycleDuration;
+        maxCycleDuration = mMaxCycleDuration;
+
+        for (const auto& profile : mTimeOfDayProfiles) {
+            const bool inProfile =
+                profile.mStartMinute <= profile.mEndMinute ?
+                    minuteOfDay >= profile.mStartMinute && minuteOfDay < profile.mEndMinute :
+                    minuteOfDay >= profile.mStartMinute || minuteOfDay < profile.mEndMinute;
+
+            if (inProfile) {
+                minCycleDuration = profile.mMinCycleDuration;
+                maxCycleDuration = profile.mMaxCycleDuration;
+                break;
+            }
+        }
+    }
+
+    /* Exponential back-off, doubling the cycle after each unsuccessful poll */
+    long cycleDuration = minCycleDuration;
+    for (long i = 1; i < unsuccessfulPolls && cycleDuration < maxCycleDuration; i++) {
+        cycleDuration *= 2;
+    }
+
+    return cycleDuration < maxCycleDuration ? static_cast<int>(cycleDuration) : maxCycleDuration;
+}
+
+int PollingPolicy::getCurrentMinuteOfDay()
+{
+    const std::time_t now = std::time(nullptr);
+    std::tm localTime;
+
+#if defined(WIN32)
+    localtime_s(&localTime, &now);
+#else
+    localtime_r(&now, &localTime);
+#endif
+
+    return localTime.tm_hour * 60 + localTime.tm_min;
+}
+
+}
+}
+}
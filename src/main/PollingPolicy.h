@@ -0,0 +1,180 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+/* Keyple Core Service */
+#include "KeypleServiceExport.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+/**
+ * Polling cadence of the non-blocking card insertion and removal monitoring of a reader.
+ *
+ * <p>Each monitoring phase (waiting for a card, waiting for its removal) starts polling at the
+ * minimum cycle duration, then doubles the cycle after each unsuccessful poll up to the maximum
+ * cycle duration. The reader is thus polled fast right after a card removal, when the next tap
+ * is likely imminent, and backs off while it stays idle.
+ *
+ * <p>Time-of-day profiles replace the bounds during some periods of the day (e.g. fast polling
+ * during the rush hours, slow polling at night), the first matching profile applies.
+ *
+ * <p>By default, both bounds are set to DEFAULT_CYCLE_DURATION (constant cadence).
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API PollingPolicy final {
+public:
+    /**
+     * Default cycle duration in milliseconds.
+     *
+     * @since 2.0.0
+     */
+    static const int DEFAULT_CYCLE_DURATION;
+
+    /**
+     * (package-private)<br>
+     * Creates a policy polling at a constant DEFAULT_CYCLE_DURATION cadence.
+     *
+     * @since 2.0.0
+     */
+    PollingPolicy();
+
+    /**
+     * Sets the bounds of the cycle duration, applying outside of the time-of-day profiles.
+     *
+     * @param minCycleDurationMillis The cycle duration right after the start of the monitoring.
+     * @param maxCycleDurationMillis The cycle duration once fully backed off.
+     * @throw IllegalArgumentException If the minimum is lower than 1 or greater than the maximum.
+     * @since 2.0.0
+     */
+    void setCycleDurationBounds(const int minCycleDurationMillis,
+                                const int maxCycleDurationMillis);
+
+    /**
+     * Adds a time-of-day profile, replacing the bounds of the cycle duration during a period of
+     * the day (local time).
+     *
+     * @param startMinute The start of the period, in minutes since midnight (included).
+     * @param endMinute The end of the period, in minutes since midnight (excluded), lower than the
+     *        start for a period spanning midnight.
+     * @param minCycleDurationMillis The cycle duration right after the start of the monitoring.
+     * @param maxCycleDurationMillis The cycle duration once fully backed off.
+     * @throw IllegalArgumentException If a minute is out of [0..1439] or if the bounds are invalid.
+     * @since 2.0.0
+     */
+    void addTimeOfDayProfile(const int startMinute,
+                             const int endMinute,
+                             const int minCycleDurationMillis,
+                             const int maxCycleDurationMillis);
+
+    /**
+     * Removes all the time-of-day profiles.
+     *
+     * @since 2.0.0
+     */
+    void clearTimeOfDayProfiles();
+
+    /**
+     * Gets the minimum cycle duration applying outside of the time-of-day profiles.
+     *
+     * @return A strictly positive number of milliseconds.
+     * @since 2.0.0
+     */
+    int getMinCycleDuration() const;
+
+    /**
+     * Gets the maximum cycle duration applying outside of the time-of-day profiles.
+     *
+     * @return A strictly positive number of milliseconds.
+     * @since 2.0.0
+     */
+    int getMaxCycleDuration() const;
+
+    /**
+     * (package-private)<br>
+     * Gets the duration of the wait following a number of unsuccessful polls, at the current
+     * local time.
+     *
+     * @param unsuccessfulPolls The number of unsuccessful polls since the start of the monitoring
+     *        phase (1 for the first one).
+     * @return A strictly positive number of milliseconds.
+     * @since 2.0.0
+     */
+    int getCycleDuration(const long unsuccessfulPolls) const;
+
+    /**
+     * (package-private)<br>
+     * Gets the duration of the wait following a number of unsuccessful polls, at a given time.
+     *
+     * @param unsuccessfulPolls The number of unsuccessful polls since the start of the monitoring
+     *        phase (1 for the first one).
+     * @param minuteOfDay The local time, in minutes since midnight.
+     * @return A strictly positive number of milliseconds.
+     * @since 2.0.0
+     */
+    int getCycleDuration(const long unsuccessfulPolls, const int minuteOfDay) const;
+
+private:
+    /**
+     * Bounds of the cycle duration during a period of the day.
+     */
+    struct TimeOfDayProfile {
+        int mStartMinute;
+        int mEndMinute;
+        int mMinCycleDuration;
+        int mMaxCycleDuration;
+    };
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     *
+     */
+    int mMinCycleDuration;
+
+    /**
+     *
+     */
+    int mMaxCycleDuration;
+
+    /**
+     *
+     */
+    std::vector<TimeOfDayProfile> mTimeOfDayProfiles;
+
+    /**
+     * (private)<br>
+     * Checks the bounds of a cycle duration.
+     *
+     * @throw IllegalArgumentException If the minimum is lower than 1 or greater than the maximum.
+     */
+    static void checkBounds(const int minCycleDurationMillis, const int maxCycleDurationMillis);
+
+    /**
+     * (private)<br>
+     * Gets the current local time in minutes since midnight.
+     */
+    static int getCurrentMinuteOfDay();
+};
+
+}
+}
+}
@@ -12,12 +12,15 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
 /* Keyple Core Service */
 #include "Plugin.h"
+#include "ReaderGroupSelectionStrategy.h"
+#include "ReaderLease.h"
 
 namespace keyple {
 namespace core {
@@ -60,6 +63,72 @@ public:
      */
     virtual std::shared_ptr<Reader> allocateReader(const std::string& readerGroupReference) = 0;
 
+    /**
+     * Gets a {@link Reader} like {@link #allocateReader(const std::string&)}, waiting up to the
+     * provided timeout for a reader of the group to be released if none is available.
+     *
+     * <p>The callers waiting for the same group reference are served in their arrival order
+     * (FIFO). Each release of a reader of the group wakes up the first waiting caller, which then
+     * retries the allocation.
+     *
+     * @param readerGroupReference The reference of the group to which the reader belongs.
+     * @param timeoutMillis The maximum waiting time in milliseconds (0 for a single attempt).
+     * @return A not null reference.
+     * @throws KeyplePluginException If no reader could be allocated before the timeout.
+     * @throws IllegalStateException If the plugin is unregistered while waiting.
+     * @since 2.0.0
+     */
+    virtual std::shared_ptr<Reader> allocateReader(const std::string& readerGroupReference,
+                                                   const long timeoutMillis) = 0;
+
+    /**
+     * Asynchronous variant of {@link #allocateReader(const std::string&, const long)}.
+     *
+     * <p>As with std::async, the destruction of the returned future waits for the end of the
+     * allocation.
+     *
+     * @param readerGroupReference The reference of the group to which the reader belongs.
+     * @param timeoutMillis The maximum waiting time in milliseconds.
+     * @return A future providing the reader or the exception raised by the allocation.
+     * @since 2.0.0
+     */
+    virtual std::future<std::shared_ptr<Reader>> allocateReaderAsync(
+        const std::string& readerGroupReference, const long timeoutMillis) = 0;
+
+    /**
+     * Gets a {@link Reader} like {@link #allocateReader(const std::string&)}, from one of the
+     * provided groups chosen according to their current load.
+     *
+     * <p>The groups are tried in the order given by the strategy until an allocation succeeds.
+     *
+     * @param readerGroupReferences The references of the candidate groups.
+     * @param strategy The strategy used to choose the group.
+     * @return A not null reference.
+     * @throws KeyplePluginException If the allocation failed in all the groups.
+     * @throws IllegalArgumentException If the list of references is empty.
+     * @since 2.0.0
+     */
+    virtual std::shared_ptr<Reader> allocateReader(
+        const std::vector<std::string>& readerGroupReferences,
+        const ReaderGroupSelectionStrategy strategy) = 0;
+
+    /**
+     * Gets a {@link Reader} like {@link #allocateReader(const std::string&)}, reserved for a
+     * limited duration.
+     *
+     * <p>The reader is released when the returned lease is released or destroyed. If the lease
+     * expires before, the reader is reclaimed by the plugin, so that a caller which never releases
+     * it does not starve the pool.
+     *
+     * @param readerGroupReference The reference of the group to which the reader belongs.
+     * @param durationMillis The duration of the lease in milliseconds (strictly positive).
+     * @return A not null reference.
+     * @throws KeyplePluginException If the allocation failed due to lack of available reader.
+     * @since 2.0.0
+     */
+    virtual std::shared_ptr<ReaderLease> leaseReader(const std::string& readerGroupReference,
+                                                     const long durationMillis) = 0;
+
     /**
      * Releases a Reader previously allocated with allocateReader.
      *
@@ -0,0 +1,99 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include "ReaderCapabilities.h"
+
+/* Keyple Core Plugin */
+#include "DontWaitForCardRemovalDuringProcessingSpi.h"
+#include "WaitForCardInsertionNonBlockingSpi.h"
+#include "WaitForCardRemovalNonBlockingSpi.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+ReaderCapabilities::ReaderCapabilities(std::shared_ptr<ReaderSpi> readerSpi)
+: mMask(0),
+  mConfigurableReaderSpi(std::dynamic_pointer_cast<ConfigurableReaderSpi>(readerSpi)),
+  mAutonomousSelectionReaderSpi(std::dynamic_pointer_cast<AutonomousSelectionReaderSpi>(readerSpi)),
+  mObservableReaderSpi(std::dynamic_pointer_cast<ObservableReaderSpi>(readerSpi))
+{
+    if (mConfigurableReaderSpi) {
+        mMask |= CONFIGURABLE;
+    }
+
+    if (mAutonomousSelectionReaderSpi) {
+        mMask |= AUTONOMOUS_SELECTION;
+    }
+
+    /* The monitoring interfaces are only relevant for observable readers */
+    if (!mObservableReaderSpi) {
+        return;
+    }
+
+    mMask |= OBSERVABLE;
+
+    /* Insertion */
+    mWaitForCardInsertionAutonomousSpi =
+        std::dynamic_pointer_cast<WaitForCardInsertionAutonomousSpi>(readerSpi);
+    if (mWaitForCardInsertionAutonomousSpi) {
+        mMask |= WAIT_FOR_CARD_INSERTION_AUTONOMOUS;
+    }
+
+    if (std::dynamic_pointer_cast<WaitForCardInsertionNonBlockingSpi>(readerSpi)) {
+        mMask |= WAIT_FOR_CARD_INSERTION_NON_BLOCKING;
+    }
+
+    mWaitForCardInsertionBlockingSpi =
+        std::dynamic_pointer_cast<WaitForCardInsertionBlockingSpi>(readerSpi);
+    if (mWaitForCardInsertionBlockingSpi) {
+        mMask |= WAIT_FOR_CARD_INSERTION_BLOCKING;
+    }
+
+    /* Processing */
+    mWaitForCardRemovalDuringProcessingBlockingSpi =
+        std::dynamic_pointer_cast<WaitForCardRemovalDuringProcessingBlockingSpi>(readerSpi);
+    if (mWaitForCardRemovalDuringProcessingBlockingSpi) {
+        mMask |= WAIT_FOR_CARD_REMOVAL_DURING_PROCESSING_BLOCKING;
+    }
+
+    if (std::dynamic_pointer_cast<DontWaitForCardRemovalDuringProcessingSpi>(readerSpi)) {
+        mMask |= DONT_WAIT_FOR_CARD_REMOVAL_DURING_PROCESSING;
+    }
+
+    /* Removal */
+    mWaitForCardRemovalAutonomousSpi =
+        std::dynamic_pointer_cast<WaitForCardRemovalAutonomousSpi>(readerSpi);
+    if (mWaitForCardRemovalAutonomousSpi) {
+        mMask |= WAIT_FOR_CARD_REMOVAL_AUTONOMOUS;
+    }
+
+    if (std::dynamic_pointer_cast<WaitForCardRemovalNonBlockingSpi>(readerSpi)) {
+        mMask |= WAIT_FOR_CARD_REMOVAL_NON_BLOCKING;
+    }
+
+    mWaitForCardRemovalBlockingSpi =
+        std::dynamic_pointer_cast<WaitForCardRemovalBlockingSpi>(readerSpi);
+    if (mWaitForCardRemovalBlockingSpi) {
+        mMask |= WAIT_FOR_CARD_REMOVAL_BLOCKING;
+    }
+
+    mCardPresenceProbeSpi = std::dynamic_pointer_cast<CardPresenceProbeSpi>(readerSpi);
+    if (mCardPresenceProbeSpi) {
+        mMask |= CARD_PRESENCE_PROBE;
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,272 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+/* Keyple Core Plugin */
+#include "AutonomousSelectionReaderSpi.h"
+#include "ConfigurableReaderSpi.h"
+#include "ObservableReaderSpi.h"
+#include "ReaderSpi.h"
+#include "WaitForCardInsertionAutonomousSpi.h"
+#include "WaitForCardInsertionBlockingSpi.h"
+#include "WaitForCardRemovalAutonomousSpi.h"
+#include "WaitForCardRemovalBlockingSpi.h"
+#include "WaitForCardRemovalDuringProcessingBlockingSpi.h"
+
+/* Keyple Core Service */
+#include "CardPresenceProbeSpi.h"
+#include "KeypleServiceExport.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::plugin::spi::reader;
+using namespace keyple::core::plugin::spi::reader::observable;
+using namespace keyple::core::plugin::spi::reader::observable::state::insertion;
+using namespace keyple::core::plugin::spi::reader::observable::state::processing;
+using namespace keyple::core::plugin::spi::reader::observable::state::removal;
+using namespace keyple::core::service::spi;
+
+/**
+ * (package-private)<br>
+ * Capabilities of a {@link ReaderSpi}, resolved once when the reader adapter is built.
+ *
+ * <p>The optional SPI interfaces implemented by the reader are stored as a bitmask, along with
+ * the typed pointers of the ones invoked by the service, so that no RTTI lookup is needed when
+ * the reader is used.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API ReaderCapabilities final {
+public:
+    /**
+     * (package-private)<br>
+     * Optional SPI interfaces a reader may implement.
+     *
+     * @since 2.0.0
+     */
+    enum Capability : uint32_t {
+        CONFIGURABLE                                     = 1u << 0,
+        AUTONOMOUS_SELECTION                             = 1u << 1,
+        OBSERVABLE                                       = 1u << 2,
+        WAIT_FOR_CARD_INSERTION_AUTONOMOUS               = 1u << 3,
+        WAIT_FOR_CARD_INSERTION_NON_BLOCKING             = 1u << 4,
+        WAIT_FOR_CARD_INSERTION_BLOCKING                 = 1u << 5,
+        WAIT_FOR_CARD_REMOVAL_DURING_PROCESSING_BLOCKING = 1u << 6,
+        DONT_WAIT_FOR_CARD_REMOVAL_DURING_PROCESSING     = 1u << 7,
+        WAIT_FOR_CARD_REMOVAL_AUTONOMOUS                 = 1u << 8,
+        WAIT_FOR_CARD_REMOVAL_NON_BLOCKING               = 1u << 9,
+        WAIT_FOR_CARD_REMOVAL_BLOCKING                   = 1u << 10,
+        CARD_PRESENCE_PROBE                              = 1u << 11
+    };
+
+    /**
+     * (package-private)<br>
+     * Resolves the capabilities of a reader.
+     *
+     * @param readerSpi The reader SPI.
+     * @since 2.0.0
+     */
+    explicit ReaderCapabilities(std::shared_ptr<ReaderSpi> readerSpi);
+
+    /**
+     * (package-private)<br>
+     * Indicates whether the reader implements an optional SPI interface.
+     *
+     * @param capability The capability.
+     * @return True if the capability is present.
+     * @since 2.0.0
+     */
+    inline bool has(const Capability capability) const
+    {
+        return (mMask & capability) != 0;
+    }
+
+    /**
+     * (package-private)<br>
+     * Gets the bitmask of all the capabilities.
+     *
+     * @return A combination of Capability values.
+     * @since 2.0.0
+     */
+    inline uint32_t getMask() const
+    {
+        return mMask;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the reader is not configurable.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<ConfigurableReaderSpi>& getConfigurableReaderSpi() const
+    {
+        return mConfigurableReaderSpi;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the reader does not perform the selection itself.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<AutonomousSelectionReaderSpi>&
+        getAutonomousSelectionReaderSpi() const
+    {
+        return mAutonomousSelectionReaderSpi;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the reader is not observable.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<ObservableReaderSpi>& getObservableReaderSpi() const
+    {
+        return mObservableReaderSpi;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the capability is missing.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<WaitForCardInsertionAutonomousSpi>&
+        getWaitForCardInsertionAutonomousSpi() const
+    {
+        return mWaitForCardInsertionAutonomousSpi;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the capability is missing.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<WaitForCardInsertionBlockingSpi>&
+        getWaitForCardInsertionBlockingSpi() const
+    {
+        return mWaitForCardInsertionBlockingSpi;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the capability is missing.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<WaitForCardRemovalDuringProcessingBlockingSpi>&
+        getWaitForCardRemovalDuringProcessingBlockingSpi() const
+    {
+        return mWaitForCardRemovalDuringProcessingBlockingSpi;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the capability is missing.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<WaitForCardRemovalAutonomousSpi>&
+        getWaitForCardRemovalAutonomousSpi() const
+    {
+        return mWaitForCardRemovalAutonomousSpi;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the capability is missing.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<WaitForCardRemovalBlockingSpi>&
+        getWaitForCardRemovalBlockingSpi() const
+    {
+        return mWaitForCardRemovalBlockingSpi;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the reader does not provide a driver-level presence probe.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<CardPresenceProbeSpi>& getCardPresenceProbeSpi() const
+    {
+        return mCardPresenceProbeSpi;
+    }
+
+private:
+    /**
+     *
+     */
+    uint32_t mMask;
+
+    /**
+     *
+     */
+    std::shared_ptr<ConfigurableReaderSpi> mConfigurableReaderSpi;
+
+    /**
+     *
+     */
+    std::shared_ptr<AutonomousSelectionReaderSpi> mAutonomousSelectionReaderSpi;
+
+    /**
+     *
+     */
+    std::shared_ptr<ObservableReaderSpi> mObservableReaderSpi;
+
+    /**
+     *
+     */
+    std::shared_ptr<WaitForCardInsertionAutonomousSpi> mWaitForCardInsertionAutonomousSpi;
+
+    /**
+     *
+     */
+    std::shared_ptr<WaitForCardInsertionBlockingSpi> mWaitForCardInsertionBlockingSpi;
+
+    /**
+     *
+     */
+    std::shared_ptr<WaitForCardRemovalDuringProcessingBlockingSpi>
+        mWaitForCardRemovalDuringProcessingBlockingSpi;
+
+    /**
+     *
+     */
+    std::shared_ptr<WaitForCardRemovalAutonomousSpi> mWaitForCardRemovalAutonomousSpi;
+
+    /**
+     *
+     */
+    std::shared_ptr<WaitForCardRemovalBlockingSpi> mWaitForCardRemovalBlockingSpi;
+
+    /**
+     *
+     */
+    std::shared_ptr<CardPresenceProbeSpi> mCardPresenceProbeSpi;
+};
+
+}
+}
+}
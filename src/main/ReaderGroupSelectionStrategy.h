@@ -0,0 +1,54 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+namespace keyple {
+namespace core {
+namespace service {
+
+/**
+ * Strategy used by a {@link PoolPlugin} to choose, among several group references, the group in
+ * which a reader is allocated.
+ *
+ * <p>Whatever the strategy, the other groups are tried in turn when the allocation fails in the
+ * chosen one.
+ *
+ * @since 2.0.0
+ */
+enum class ReaderGroupSelectionStrategy {
+    /**
+     * The groups are chosen in turn, regardless of their load.
+     *
+     * @since 2.0.0
+     */
+    ROUND_ROBIN,
+
+    /**
+     * The group having the fewest readers currently allocated is chosen.
+     *
+     * @since 2.0.0
+     */
+    LEAST_OUTSTANDING,
+
+    /**
+     * The group minimizing its number of allocated readers weighted by its average allocation
+     * latency is chosen. Groups not measured yet are chosen first.
+     *
+     * @since 2.0.0
+     */
+    LATENCY_WEIGHTED
+};
+
+}
+}
+}
@@ -0,0 +1,87 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+
+/* Keyple Core Service */
+#include "Reader.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+/**
+ * Time-limited reservation of a {@link Reader} allocated by a {@link PoolPlugin}.
+ *
+ * <p>The reader is released when the lease is released, when the lease is destroyed, or by the
+ * pool plugin itself once the lease has expired without being renewed. After that, the reader
+ * must no longer be used.
+ *
+ * @since 2.0.0
+ */
+class ReaderLease {
+public:
+    /**
+     * Releases the reader if the lease is still active.
+     *
+     * @since 2.0.0
+     */
+    virtual ~ReaderLease() = default;
+
+    /**
+     * Gets the leased reader.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    virtual std::shared_ptr<Reader> getReader() const = 0;
+
+    /**
+     * Indicates whether the reader is still reserved to the holder of the lease.
+     *
+     * @return False once the lease is released or reclaimed.
+     * @since 2.0.0
+     */
+    virtual bool isActive() const = 0;
+
+    /**
+     * Gets the time left before the lease expires.
+     *
+     * @return 0 if the lease is expired or no longer active.
+     * @since 2.0.0
+     */
+    virtual long getRemainingMillis() const = 0;
+
+    /**
+     * Extends the lease, its new deadline being the current time plus the provided duration.
+     *
+     * @param durationMillis The new duration of the lease in milliseconds (strictly positive).
+     * @throw IllegalArgumentException If the duration is not strictly positive.
+     * @throw IllegalStateException If the lease is no longer active.
+     * @since 2.0.0
+     */
+    virtual void renew(const long durationMillis) = 0;
+
+    /**
+     * Ends the lease and releases the reader, does nothing if the lease is no longer active.
+     *
+     * @throw KeyplePluginException If the release of the reader failed.
+     * @since 2.0.0
+     */
+    virtual void release() = 0;
+};
+
+}
+}
+}
@@ -0,0 +1,125 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "ReaderLeaseAdapter.h"
+
+/* Keyple Core Util */
+#include "IllegalStateException.h"
+#include "KeypleAssert.h"
+
+/* Keyple Core Service */
+#include "LocalPoolPluginAdapter.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+ReaderLeaseAdapter::ReaderLeaseAdapter(const std::shared_ptr<Reader> reader,
+                                       const uint64_t allocationId,
+                                       const long durationMillis,
+                                       LocalPoolPluginAdapter* poolPluginAdapter)
+: mReader(reader),
+  mAllocationId(allocationId),
+  mPoolPluginAdapter(poolPluginAdapter),
+  mDeadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(durationMillis)),
+  mIsActive(true) {}
+
+ReaderLeaseAdapter::~ReaderLeaseAdapter()
+{
+    try {
+        release();
+    } catch (const Exception& e) {
+        mLogger->error("Error while releasing the leased reader '%'\n", mReader->getName(), e);
+    }
+}
+
+std::shared_ptr<Reader> ReaderLeaseAdapter::getReader() const
+{
+    return mReader;
+}
+
+bool ReaderLeaseAdapter::isActive() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mIsActive;
+}
+
+long ReaderLeaseAdapter::getRemainingMillis() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mIsActive) {
+        return 0;
+    }
+
+    const long remaining = static_cast<long>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            mDeadline - std::chrono::steady_clock::now()).count());
+
+    return remaining > 0 ? remaining : 0;
+}
+
+void ReaderLeaseAdapter::renew(const long durationMillis)
+{
+    Assert::getInstance().isTrue(durationMillis > 0, "durationMillis > 0");
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (!mIsActive) {
+            throw IllegalStateException("The lease of the reader '" +
+                                        mReader->getName() +
+                                        "' is no longer active");
+        }
+
+        mDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(durationMillis);
+    }
+
+    mPoolPluginAdapter->wakeUpLeaseSweeper();
+}
+
+void ReaderLeaseAdapter::release()
+{
+    if (end()) {
+        mPoolPluginAdapter->releaseLeasedReader(mReader, mAllocationId);
+    }
+}
+
+std::chrono::steady_clock::time_point ReaderLeaseAdapter::getDeadline() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mDeadline;
+}
+
+uint64_t ReaderLeaseAdapter::getAllocationId() const
+{
+    return mAllocationId;
+}
+
+bool ReaderLeaseAdapter::end()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const bool wasActive = mIsActive;
+    mIsActive = false;
+
+    return wasActive;
+}
+
+}
+}
+}
@@ -0,0 +1,169 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+
+/* Keyple Core Util */
+#include "LoggerFactory.h"
+
+/* Keyple Core Service */
+#include "Reader.h"
+#include "ReaderLease.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util::cpp;
+
+class LocalPoolPluginAdapter;
+
+/**
+ * (package-private)<br>
+ * Implementation of {@link ReaderLease}, tracked by the pool plugin which granted it.
+ *
+ * @since 2.0.0
+ */
+class ReaderLeaseAdapter final : public ReaderLease {
+public:
+    /**
+     * (package-private)<br>
+     * Constructor.
+     *
+     * @param reader The allocated reader.
+     * @param allocationId The identifier of the allocation of the reader by the pool plugin.
+     * @param durationMillis The duration of the lease in milliseconds.
+     * @param poolPluginAdapter The pool plugin which allocated the reader.
+     * @since 2.0.0
+     */
+    ReaderLeaseAdapter(const std::shared_ptr<Reader> reader,
+                       const uint64_t allocationId,
+                       const long durationMillis,
+                       LocalPoolPluginAdapter* poolPluginAdapter);
+
+    /**
+     * {@inheritDoc}
+     *
+     * <p>A failure of the release is logged.
+     *
+     * @since 2.0.0
+     */
+    ~ReaderLeaseAdapter();
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    std::shared_ptr<Reader> getReader() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    bool isActive() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    long getRemainingMillis() const override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    void renew(const long durationMillis) override;
+
+    /**
+     * {@inheritDoc}
+     *
+     * @since 2.0.0
+     */
+    void release() override;
+
+    /**
+     * (package-private)<br>
+     * Gets the deadline of the lease.
+     *
+     * @return A time point.
+     * @since 2.0.0
+     */
+    std::chrono::steady_clock::time_point getDeadline() const;
+
+    /**
+     * (package-private)<br>
+     * Gets the identifier of the allocation of the leased reader.
+     *
+     * @return A strictly positive value.
+     * @since 2.0.0
+     */
+    uint64_t getAllocationId() const;
+
+    /**
+     * (package-private)<br>
+     * Marks the lease as no longer active, without releasing the reader.
+     *
+     * @return True if the lease was active, i.e. if the caller is in charge of the release.
+     * @since 2.0.0
+     */
+    bool end();
+
+private:
+    /**
+     *
+     */
+    const std::unique_ptr<Logger> mLogger = LoggerFactory::getLogger(typeid(ReaderLeaseAdapter));
+
+    /**
+     *
+     */
+    const std::shared_ptr<Reader> mReader;
+
+    /**
+     *
+     */
+    const uint64_t mAllocationId;
+
+    /**
+     *
+     */
+    LocalPoolPluginAdapter* mPoolPluginAdapter;
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     *
+     */
+    std::chrono::steady_clock::time_point mDeadline;
+
+    /**
+     *
+     */
+    bool mIsActive;
+};
+
+}
+}
+}
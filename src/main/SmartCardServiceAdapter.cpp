@@ -56,6 +56,9 @@ using namespace keyple::core::util::cpp::exception;
 
 std::shared_ptr<SmartCardServiceAdapter> SmartCardServiceAdapter::mInstance;
 
+SmartCardServiceAdapter::SmartCardServiceAdapter()
+: mPlugins(std::make_shared<const PluginsMap>()) {}
+
 std::shared_ptr<SmartCardServiceAdapter> SmartCardServiceAdapter::getInstance()
 {
     if (mInstance == nullptr) {
@@ -154,8 +157,19 @@ std::shared_ptr<Plugin> SmartCardServiceAdapter::registerPlugin(
                 throw IllegalArgumentException("The factory doesn't implement the right SPI.");
             }
 
-            mPlugins.insert({plugin->getName(), plugin});
-            plugin->doRegister();
+            /* Publishes a new snapshot including the plugin */
+            const std::shared_ptr<const PluginsMap> previousPlugins = std::atomic_load(&mPlugins);
+            auto plugins = std::make_shared<PluginsMap>(*previousPlugins);
+            plugins->insert({plugin->getName(), plugin});
+            std::atomic_store(&mPlugins, std::shared_ptr<const PluginsMap>(plugins));
+
+            try {
+                plugin->doRegister();
+            } catch (...) {
+                /* The plugin is withdrawn, the snapshots only change under the lock */
+                std::atomic_store(&mPlugins, previousPlugins);
+                throw;
+            }
 
     } catch (const IllegalArgumentException& e) {
         throw IllegalArgumentException("The provided plugin factory doesn't implement the plugin" \
@@ -179,11 +193,17 @@ void SmartCardServiceAdapter::unregisterPlugin(const std::string& pluginName)
 
     const std::lock_guard<std::mutex> lock(mMutex);
 
-    auto i = mPlugins.find(pluginName);
-    if (i != mPlugins.end()) {
-        std::shared_ptr<Plugin> removedPlugin = std::move(i->second);
+    const std::shared_ptr<const PluginsMap> currentPlugins = std::atomic_load(&mPlugins);
+    const auto i = currentPlugins->find(pluginName);
+    if (i != currentPlugins->end()) {
+        std::shared_ptr<Plugin> removedPlugin = i->second;
+
+        /* Publishes a new snapshot excluding the plugin */
+        auto plugins = std::make_shared<PluginsMap>(*currentPlugins);
+        plugins->erase(pluginName);
+        std::atomic_store(&mPlugins, std::shared_ptr<const PluginsMap>(plugins));
+
         std::dynamic_pointer_cast<AbstractPluginAdapter>(removedPlugin)->doUnregister();
-        mPlugins.erase(i);
     } else {
         mLogger->warn("The plugin '%' is not registered\n", pluginName);
     }
@@ -191,8 +211,11 @@ void SmartCardServiceAdapter::unregisterPlugin(const std::string& pluginName)
 
 const std::vector<std::string> SmartCardServiceAdapter::getPluginNames() const
 {
+    const std::shared_ptr<const PluginsMap> plugins = getPluginsSnapshot();
+
     std::vector<std::string> pluginNames;
-    for (const auto& pair : mPlugins) {
+    pluginNames.reserve(plugins->size());
+    for (const auto& pair : *plugins) {
         pluginNames.push_back(pair.first);
     }
 
@@ -201,17 +224,33 @@ const std::vector<std::string> SmartCardServiceAdapter::getPluginNames() const
 
 const std::vector<std::shared_ptr<Plugin>> SmartCardServiceAdapter::getPlugins() const
 {
-   std::vector<std::shared_ptr<Plugin>> plugins;
-    for (const auto& pair : mPlugins) {
-        plugins.push_back(pair.second);
+    const std::shared_ptr<const PluginsMap> plugins = getPluginsSnapshot();
+
+    std::vector<std::shared_ptr<Plugin>> pluginList;
+    pluginList.reserve(plugins->size());
+    for (const auto& pair : *plugins) {
+        pluginList.push_back(pair.second);
     }
 
-    return plugins;
+    return pluginList;
 }
 
 std::shared_ptr<Plugin> SmartCardServiceAdapter::getPlugin(const std::string& pluginName) const
 {
-    return mPlugins.at(pluginName);
+    const std::shared_ptr<const PluginsMap> plugins = getPluginsSnapshot();
+
+    const auto it = plugins->find(pluginName);
+    if (it != plugins->end()) {
+        return it->second;
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<const SmartCardServiceAdapter::PluginsMap>
+    SmartCardServiceAdapter::getPluginsSnapshot() const
+{
+    return std::atomic_load(&mPlugins);
 }
 
 void SmartCardServiceAdapter::checkCardExtension(
@@ -276,8 +315,8 @@ void SmartCardServiceAdapter::checkPluginRegistration(const std::string& pluginN
 {
     mLogger->info("Registering a new Plugin to the service : %\n", pluginName);
 
-    const auto it = mPlugins.find(pluginName);
-    if (it != mPlugins.end()) {
+    const std::shared_ptr<const PluginsMap> plugins = getPluginsSnapshot();
+    if (plugins->find(pluginName) != plugins->end()) {
         throw IllegalStateException("The plugin '" +
                                     pluginName +
                                     "' has already been registered to the service.");
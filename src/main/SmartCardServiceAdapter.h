@@ -17,6 +17,7 @@
 #include <mutex>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 /* Keyple Core Util */
 #include "LoggerFactory.h"
@@ -48,6 +49,13 @@ using namespace keyple::core::util::cpp;
  */
 class SmartCardServiceAdapter final : public SmartCardService {
 public:
+    /**
+     * Registered plugins indexed by name.
+     *
+     * @since 2.0.0
+     */
+    using PluginsMap = std::map<std::string, std::shared_ptr<Plugin>>;
+
     /**
      * (package-private)<br>
      * Gets the single instance of SmartCardServiceAdapter.
@@ -95,6 +103,19 @@ public:
      */
     std::shared_ptr<Plugin> getPlugin(const std::string& pluginName) const final;
 
+    /**
+     * Gets an immutable snapshot of the registered plugins indexed by name.
+     *
+     * <p>Getting it neither locks nor allocates, and it can be iterated from any thread while
+     * plugins are registered or unregistered: those publish a new snapshot (copy-on-write).
+     *
+     * <p>The returned pointer must be kept while iterating (not iterated as a temporary).
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    std::shared_ptr<const PluginsMap> getPluginsSnapshot() const;
+
     /**
      * {@inheritDoc}
      *
@@ -213,14 +234,15 @@ private:
         LoggerFactory::getLogger(typeid(SmartCardServiceAdapter));
 
     /**
-     *
+     * Serializes the registrations and unregistrations.
      */
     std::mutex mMutex;
 
     /**
-     *
+     * Current snapshot of the registered plugins, only accessed through the
+     * std::atomic_load/atomic_store functions.
      */
-    std::map<std::string, std::shared_ptr<Plugin>> mPlugins;
+    std::shared_ptr<const PluginsMap> mPlugins;
 
     /**
      *
@@ -251,7 +273,7 @@ private:
     /**
      * Private constructor
      */
-    SmartCardServiceAdapter() {}
+    SmartCardServiceAdapter();
 
     /**
      * (private)<br>
@@ -0,0 +1,136 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "TimerService.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "KeypleAssert.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+TimerService::TimerService() : mNextTimerId(1), mRunningTimerId(0), mRunning(false) {}
+
+TimerService::~TimerService()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mRunning = false;
+    }
+    mCondition.notify_all();
+
+    if (mThread.joinable()) {
+        mThread.join();
+    }
+}
+
+std::shared_ptr<TimerService> TimerService::getInstance()
+{
+    /* C++: function-local static, initialization is thread-safe */
+    static const std::shared_ptr<TimerService> instance(new TimerService());
+
+    return instance;
+}
+
+uint64_t TimerService::schedule(const int delayMillis, const std::function<void()>& task)
+{
+    Assert::getInstance().greaterOrEqual(delayMillis, 0, "delayMillis");
+
+    if (!task) {
+        throw IllegalArgumentException("The task is empty.");
+    }
+
+    const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(delayMillis);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mRunning) {
+        mRunning = true;
+        mThread = std::thread(&TimerService::run, this);
+    }
+
+    const uint64_t timerId = mNextTimerId++;
+    mDeadlines.insert({deadline, timerId});
+    mTasks.insert({timerId, {deadline, task}});
+    mCondition.notify_all();
+
+    return timerId;
+}
+
+bool TimerService::cancel(const uint64_t timerId)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    const auto it = mTasks.find(timerId);
+    if (it != mTasks.end()) {
+        mDeadlines.erase({it->second.first, timerId});
+        mTasks.erase(it);
+
+        return true;
+    }
+
+    /* The task may be running, waits for its end unless called by the task itself */
+    if (std::this_thread::get_id() != mThread.get_id()) {
+        mCondition.wait(lock, [this, timerId]() { return mRunningTimerId != timerId; });
+    }
+
+    return false;
+}
+
+size_t TimerService::getPendingTimerCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mTasks.size();
+}
+
+void TimerService::run()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (mRunning) {
+        if (mDeadlines.empty()) {
+            mCondition.wait(lock);
+            continue;
+        }
+
+        const auto next = *mDeadlines.begin();
+        if (Clock::now() < next.first) {
+            /* Woken up earlier by a new timer with a closer deadline or by the stop */
+            mCondition.wait_until(lock, next.first);
+            continue;
+        }
+
+        mDeadlines.erase(mDeadlines.begin());
+        const auto it = mTasks.find(next.second);
+        const std::function<void()> task = it->second.second;
+        mTasks.erase(it);
+        mRunningTimerId = next.second;
+
+        /* The task runs unlocked, it may schedule or cancel timers */
+        lock.unlock();
+        task();
+        lock.lock();
+
+        mRunningTimerId = 0;
+        mCondition.notify_all();
+    }
+}
+
+}
+}
+}
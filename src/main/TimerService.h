@@ -0,0 +1,149 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+
+/* Keyple Core Service */
+#include "KeypleServiceExport.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+/**
+ * (package-private)<br>
+ * Service-wide timer, running the expired tasks of all the components on a single thread.
+ *
+ * <p>The thread is started with the first scheduled task. The tasks are expected to be short:
+ * a long task delays the following ones.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API TimerService final {
+public:
+    /**
+     * (package-private)<br>
+     * Gets the unique instance of the timer service.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    static std::shared_ptr<TimerService> getInstance();
+
+    /**
+     * Stops the timer thread, the pending tasks are dropped.
+     */
+    ~TimerService();
+
+    /**
+     * (package-private)<br>
+     * Schedules a task to run once after a delay.
+     *
+     * @param delayMillis The delay in milliseconds.
+     * @param task The task.
+     * @return The identifier of the timer, used to cancel it.
+     * @throw IllegalArgumentException If the delay is negative or if the task is empty.
+     * @since 2.0.0
+     */
+    uint64_t schedule(const int delayMillis, const std::function<void()>& task);
+
+    /**
+     * (package-private)<br>
+     * Cancels a timer.
+     *
+     * <p>If the task is running, waits for its end, unless called by the task itself: the task
+     * never runs once this method returned.
+     *
+     * @param timerId The identifier of the timer.
+     * @return True if the timer was pending and will never run.
+     * @since 2.0.0
+     */
+    bool cancel(const uint64_t timerId);
+
+    /**
+     * (package-private)<br>
+     * Gets the number of pending timers.
+     *
+     * @return A positive or null number.
+     * @since 2.0.0
+     */
+    size_t getPendingTimerCount() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     *
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     * Signals a new timer, the end of a task or the stop of the service.
+     */
+    std::condition_variable mCondition;
+
+    /**
+     * Pending timers ordered by deadline, then by identifier.
+     */
+    std::set<std::pair<Clock::time_point, uint64_t>> mDeadlines;
+
+    /**
+     * Pending tasks by timer identifier.
+     */
+    std::map<uint64_t, std::pair<Clock::time_point, std::function<void()>>> mTasks;
+
+    /**
+     *
+     */
+    uint64_t mNextTimerId;
+
+    /**
+     * Identifier of the running task, 0 if none.
+     */
+    uint64_t mRunningTimerId;
+
+    /**
+     *
+     */
+    bool mRunning;
+
+    /**
+     *
+     */
+    std::thread mThread;
+
+    /**
+     * Private constructor
+     */
+    TimerService();
+
+    /**
+     * (private)<br>
+     * Timer loop, running the expired tasks until the service is destroyed.
+     */
+    void run();
+};
+
+}
+}
+}
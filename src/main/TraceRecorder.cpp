@@ -0,0 +1,241 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "TraceRecorder.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/* Keyple Core Util */
+#include "IllegalStateException.h"
+#include "KeypleAssert.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+/* SPAN ----------------------------------------------------------------------------------------- */
+
+TraceRecorder::Span::Span(const char* name)
+: mName(name), mStartMicros(0), mIsRecording(TraceRecorder::isRecording())
+{
+    if (mIsRecording) {
+        mStartMicros = TraceRecorder::nowMicros();
+    }
+}
+
+TraceRecorder::Span::Span(const char* name, const std::string& detail)
+: mName(name), mStartMicros(0), mIsRecording(TraceRecorder::isRecording())
+{
+    if (mIsRecording) {
+        mDetail = detail;
+        mStartMicros = TraceRecorder::nowMicros();
+    }
+}
+
+TraceRecorder::Span::~Span()
+{
+    if (mIsRecording) {
+        TraceRecorder::getInstance()->record(mName,
+                                             mDetail,
+                                             mStartMicros,
+                                             TraceRecorder::nowMicros());
+    }
+}
+
+/* TRACE RECORDER ------------------------------------------------------------------------------- */
+
+const size_t TraceRecorder::MAX_EVENTS_PER_THREAD = 100000;
+
+std::atomic<bool> TraceRecorder::sIsRecording(false);
+
+TraceRecorder::TraceRecorder() : mDroppedEventCount(0) {}
+
+std::shared_ptr<TraceRecorder> TraceRecorder::getInstance()
+{
+    /* C++: function-local static, initialization is thread-safe */
+    static const std::shared_ptr<TraceRecorder> instance(new TraceRecorder());
+
+    return instance;
+}
+
+bool TraceRecorder::isRecording()
+{
+    return sIsRecording.load(std::memory_order_relaxed);
+}
+
+void TraceRecorder::start()
+{
+    /* Fixes the time origin before the first span */
+    nowMicros();
+
+    sIsRecording = true;
+}
+
+void TraceRecorder::stop()
+{
+    sIsRecording = false;
+}
+
+void TraceRecorder::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (const auto& threadBuffer : mThreadBuffers) {
+        std::lock_guard<std::mutex> bufferLock(threadBuffer->mMutex);
+        threadBuffer->mEvents.clear();
+    }
+
+    mDroppedEventCount = 0;
+}
+
+size_t TraceRecorder::getEventCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    size_t count = 0;
+
+    for (const auto& threadBuffer : mThreadBuffers) {
+        std::lock_guard<std::mutex> bufferLock(threadBuffer->mMutex);
+        count += threadBuffer->mEvents.size();
+    }
+
+    return count;
+}
+
+uint64_t TraceRecorder::getDroppedEventCount() const
+{
+    return mDroppedEventCount;
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::getThreadBuffer()
+{
+    /* C++: the shared_ptr keeps the buffer alive in the recorder when the thread ends */
+    static thread_local std::shared_ptr<ThreadBuffer> threadBuffer;
+
+    if (threadBuffer == nullptr) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        threadBuffer = std::make_shared<ThreadBuffer>();
+        threadBuffer->mThreadId = static_cast<int>(mThreadBuffers.size()) + 1;
+        mThreadBuffers.push_back(threadBuffer);
+    }
+
+    return *threadBuffer;
+}
+
+void TraceRecorder::record(const char* name,
+                           const std::string& detail,
+                           const uint64_t startMicros,
+                           const uint64_t endMicros)
+{
+    ThreadBuffer& threadBuffer = getThreadBuffer();
+
+    /* Uncontended, except while rendering or clearing */
+    std::lock_guard<std::mutex> lock(threadBuffer.mMutex);
+
+    if (threadBuffer.mEvents.size() >= MAX_EVENTS_PER_THREAD) {
+        mDroppedEventCount++;
+        return;
+    }
+
+    threadBuffer.mEvents.push_back({name, detail, startMicros, endMicros - startMicros});
+}
+
+uint64_t TraceRecorder::nowMicros()
+{
+    static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - origin).count());
+}
+
+const std::string TraceRecorder::renderChromeTrace() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    std::stringstream ss;
+    ss << "{\"traceEvents\":[";
+
+    bool first = true;
+    for (const auto& threadBuffer : mThreadBuffers) {
+        std::lock_guard<std::mutex> bufferLock(threadBuffer->mMutex);
+
+        for (const auto& event : threadBuffer->mEvents) {
+            ss << (first ? "\n" : ",\n")
+               << "{\"name\":\"" << escape(event.mName) << "\""
+               << ",\"cat\":\"keyple\",\"ph\":\"X\""
+               << ",\"ts\":" << event.mStartMicros
+               << ",\"dur\":" << event.mDurationMicros
+               << ",\"pid\":1"
+               << ",\"tid\":" << threadBuffer->mThreadId;
+
+            if (!event.mDetail.empty()) {
+                ss << ",\"args\":{\"detail\":\"" << escape(event.mDetail) << "\"}";
+            }
+
+            ss << "}";
+            first = false;
+        }
+    }
+
+    ss << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return ss.str();
+}
+
+void TraceRecorder::writeChromeTraceToFile(const std::string& path) const
+{
+    Assert::getInstance().notEmpty(path, "path");
+
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw IllegalStateException("Unable to open '" + path + "' for writing.");
+    }
+
+    file << renderChromeTrace();
+    file.close();
+
+    if (file.fail()) {
+        throw IllegalStateException("Unable to write '" + path + "'.");
+    }
+}
+
+const std::string TraceRecorder::escape(const std::string& value)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+
+    for (const char c : value) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            escaped += buffer;
+        } else {
+            escaped += c;
+        }
+    }
+
+    return escaped;
+}
+
+}
+}
+}
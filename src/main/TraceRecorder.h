@@ -0,0 +1,274 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/* Keyple Core Service */
+#include "KeypleServiceExport.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+/**
+ * Optional recorder of timed spans, exported in the Chrome trace event format (JSON) which can
+ * be loaded in chrome://tracing or in the Perfetto UI.
+ *
+ * <p>Recording is switched on and off at runtime with start() and stop(). When it is off, opening
+ * a Span costs a single relaxed atomic load.
+ *
+ * <p>Each thread records in its own buffer, so that threads never contend with each other while
+ * recording. Each buffer is bounded to MAX_EVENTS_PER_THREAD events, extra events being dropped.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API TraceRecorder final {
+public:
+    /**
+     * Scoped span, recorded as a complete event ("ph":"X") when it goes out of scope.
+     *
+     * <p>The name must be a string literal (or any string outliving the recorder), it is not
+     * copied.
+     *
+     * @since 2.0.0
+     */
+    class KEYPLESERVICE_API Span final {
+    public:
+        /**
+         * Opens a span.
+         *
+         * @param name The name of the span.
+         * @since 2.0.0
+         */
+        explicit Span(const char* name);
+
+        /**
+         * Opens a span with a detail (e.g. the reader name), exported in the "args" of the event.
+         *
+         * @param name The name of the span.
+         * @param detail The detail, only copied when the recording is on.
+         * @since 2.0.0
+         */
+        Span(const char* name, const std::string& detail);
+
+        /**
+         * Closes the span.
+         */
+        ~Span();
+
+        /**
+         *
+         */
+        Span(const Span& o) = delete;
+
+        /**
+         *
+         */
+        Span& operator=(const Span& o) = delete;
+
+    private:
+        /**
+         *
+         */
+        const char* mName;
+
+        /**
+         *
+         */
+        std::string mDetail;
+
+        /**
+         *
+         */
+        uint64_t mStartMicros;
+
+        /**
+         *
+         */
+        bool mIsRecording;
+    };
+
+    /**
+     * Maximum number of events kept per thread.
+     *
+     * @since 2.0.0
+     */
+    static const size_t MAX_EVENTS_PER_THREAD;
+
+    /**
+     * Gets the unique instance.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    static std::shared_ptr<TraceRecorder> getInstance();
+
+    /**
+     * Indicates whether spans are currently recorded.
+     *
+     * @return True if the recording is on.
+     * @since 2.0.0
+     */
+    static bool isRecording();
+
+    /**
+     * Switches the recording on. Already recorded events are kept.
+     *
+     * @since 2.0.0
+     */
+    void start();
+
+    /**
+     * Switches the recording off. Already recorded events are kept.
+     *
+     * @since 2.0.0
+     */
+    void stop();
+
+    /**
+     * Discards all the recorded events.
+     *
+     * @since 2.0.0
+     */
+    void clear();
+
+    /**
+     * Gets the number of recorded events, all threads included.
+     *
+     * @return A positive value.
+     * @since 2.0.0
+     */
+    size_t getEventCount() const;
+
+    /**
+     * Gets the number of events dropped because a thread buffer was full.
+     *
+     * @return A positive value.
+     * @since 2.0.0
+     */
+    uint64_t getDroppedEventCount() const;
+
+    /**
+     * Renders the recorded events in the Chrome trace event format.
+     *
+     * @return A JSON document.
+     * @since 2.0.0
+     */
+    const std::string renderChromeTrace() const;
+
+    /**
+     * Writes the rendering of renderChromeTrace() to a file.
+     *
+     * @param path The path of the file.
+     * @throw IllegalStateException If the file cannot be written.
+     * @since 2.0.0
+     */
+    void writeChromeTraceToFile(const std::string& path) const;
+
+    /**
+     *
+     */
+    TraceRecorder(const TraceRecorder& o) = delete;
+
+    /**
+     *
+     */
+    TraceRecorder& operator=(const TraceRecorder& o) = delete;
+
+private:
+    /**
+     *
+     */
+    struct Event {
+        const char* mName;
+        std::string mDetail;
+        uint64_t mStartMicros;
+        uint64_t mDurationMicros;
+    };
+
+    /**
+     *
+     */
+    struct ThreadBuffer {
+        int mThreadId;
+        std::mutex mMutex;
+        std::vector<Event> mEvents;
+    };
+
+    /**
+     *
+     */
+    static std::atomic<bool> sIsRecording;
+
+    /**
+     * Protects the list of thread buffers (not the buffers themselves).
+     */
+    mutable std::mutex mMutex;
+
+    /**
+     *
+     */
+    std::vector<std::shared_ptr<ThreadBuffer>> mThreadBuffers;
+
+    /**
+     *
+     */
+    std::atomic<uint64_t> mDroppedEventCount;
+
+    /**
+     * (private)<br>
+     * Constructor.
+     */
+    TraceRecorder();
+
+    /**
+     * (private)<br>
+     * Gets the buffer of the current thread, creating and registering it on first use.
+     *
+     * @return A not null reference.
+     */
+    ThreadBuffer& getThreadBuffer();
+
+    /**
+     * (private)<br>
+     * Records a complete event in the buffer of the current thread.
+     */
+    void record(const char* name,
+                const std::string& detail,
+                const uint64_t startMicros,
+                const uint64_t endMicros);
+
+    /**
+     * (private)<br>
+     * Gets the number of microseconds elapsed since the creation of the recorder.
+     *
+     * @return A positive value.
+     */
+    static uint64_t nowMicros();
+
+    /**
+     * (private)<br>
+     * Escapes a string to be written inside a JSON string.
+     */
+    static const std::string escape(const std::string& value);
+};
+
+}
+}
+}
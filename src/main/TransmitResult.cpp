@@ -0,0 +1,112 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "TransmitResult.h"
+
+/* Calypsonet Terminal Card */
+#include "CardBrokenCommunicationException.h"
+#include "ReaderBrokenCommunicationException.h"
+#include "UnexpectedStatusWordException.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+TransmitFailure::TransmitFailure(const Type type,
+                                 const std::shared_ptr<CardResponseApi> cardResponse,
+                                 const bool isCardResponseComplete,
+                                 const std::string& message,
+                                 const std::shared_ptr<Exception> cause)
+: mType(type),
+  mCardResponse(cardResponse),
+  mIsCardResponseComplete(isCardResponseComplete),
+  mMessage(message),
+  mCause(cause),
+  mCauseFailure(nullptr) {}
+
+TransmitFailure::TransmitFailure(const Type type,
+                                 const std::shared_ptr<CardResponseApi> cardResponse,
+                                 const bool isCardResponseComplete,
+                                 const std::string& message,
+                                 const std::shared_ptr<const TransmitFailure> cause)
+: mType(type),
+  mCardResponse(cardResponse),
+  mIsCardResponseComplete(isCardResponseComplete),
+  mMessage(message),
+  mCause(nullptr),
+  mCauseFailure(cause) {}
+
+TransmitFailure::Type TransmitFailure::getType() const
+{
+    return mType;
+}
+
+const std::string& TransmitFailure::getMessage() const
+{
+    return mMessage;
+}
+
+const std::shared_ptr<CardResponseApi>& TransmitFailure::getCardResponse() const
+{
+    return mCardResponse;
+}
+
+std::shared_ptr<Exception> TransmitFailure::getCause() const
+{
+    return mCauseFailure != nullptr ? mCauseFailure->toException() : mCause;
+}
+
+std::shared_ptr<Exception> TransmitFailure::toException() const
+{
+    switch (mType) {
+    case Type::READER_BROKEN_COMMUNICATION:
+        return std::make_shared<ReaderBrokenCommunicationException>(mCardResponse,
+                                                                    mIsCardResponseComplete,
+                                                                    mMessage,
+                                                                    getCause());
+    case Type::CARD_BROKEN_COMMUNICATION:
+        return std::make_shared<CardBrokenCommunicationException>(mCardResponse,
+                                                                  mIsCardResponseComplete,
+                                                                  mMessage,
+                                                                  getCause());
+    default:
+        return std::make_shared<UnexpectedStatusWordException>(mCardResponse,
+                                                               mIsCardResponseComplete,
+                                                               mMessage,
+                                                               getCause());
+    }
+}
+
+void TransmitFailure::raise() const
+{
+    switch (mType) {
+    case Type::READER_BROKEN_COMMUNICATION:
+        throw ReaderBrokenCommunicationException(mCardResponse,
+                                                 mIsCardResponseComplete,
+                                                 mMessage,
+                                                 getCause());
+    case Type::CARD_BROKEN_COMMUNICATION:
+        throw CardBrokenCommunicationException(mCardResponse,
+                                               mIsCardResponseComplete,
+                                               mMessage,
+                                               getCause());
+    default:
+        throw UnexpectedStatusWordException(mCardResponse,
+                                            mIsCardResponseComplete,
+                                            mMessage,
+                                            getCause());
+    }
+}
+
+}
+}
+}
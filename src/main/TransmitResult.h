@@ -0,0 +1,300 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+/* Calypsonet Terminal Card */
+#include "CardResponseApi.h"
+
+/* Keyple Core Service */
+#include "KeypleServiceExport.h"
+
+/* Keyple Core Util */
+#include "Exception.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+using namespace calypsonet::terminal::card;
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * (package-private)<br>
+ * Failure of a card or reader exchange, carried by a TransmitResult instead of an exception.
+ *
+ * <p>It holds what is needed to build the matching exception, which is only done when the failure
+ * reaches the public API.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API TransmitFailure final {
+public:
+    /**
+     * (package-private)<br>
+     * Kind of failure, each one matching an exception of the card API.
+     *
+     * @since 2.0.0
+     */
+    enum class Type {
+        /**
+         * ReaderBrokenCommunicationException.
+         */
+        READER_BROKEN_COMMUNICATION,
+
+        /**
+         * CardBrokenCommunicationException.
+         */
+        CARD_BROKEN_COMMUNICATION,
+
+        /**
+         * UnexpectedStatusWordException.
+         */
+        UNEXPECTED_STATUS_WORD
+    };
+
+    /**
+     * (package-private)<br>
+     * Creates a failure.
+     *
+     * @param type The kind of failure.
+     * @param cardResponse The responses collected so far (may be null).
+     * @param isCardResponseComplete True if all the responses were collected.
+     * @param message The message.
+     * @param cause The cause (may be null).
+     * @since 2.0.0
+     */
+    TransmitFailure(const Type type,
+                    const std::shared_ptr<CardResponseApi> cardResponse,
+                    const bool isCardResponseComplete,
+                    const std::string& message,
+                    const std::shared_ptr<Exception> cause);
+
+    /**
+     * (package-private)<br>
+     * Creates a failure caused by another failure.
+     *
+     * <p>The exception of the cause is only built with the exception of this failure.
+     *
+     * @param type The kind of failure.
+     * @param cardResponse The responses collected so far (may be null).
+     * @param isCardResponseComplete True if all the responses were collected.
+     * @param message The message.
+     * @param cause The failure at the origin of this one (not null).
+     * @since 2.0.0
+     */
+    TransmitFailure(const Type type,
+                    const std::shared_ptr<CardResponseApi> cardResponse,
+                    const bool isCardResponseComplete,
+                    const std::string& message,
+                    const std::shared_ptr<const TransmitFailure> cause);
+
+    /**
+     * (package-private)<br>
+     *
+     * @since 2.0.0
+     */
+    Type getType() const;
+
+    /**
+     * (package-private)<br>
+     *
+     * @since 2.0.0
+     */
+    const std::string& getMessage() const;
+
+    /**
+     * (package-private)<br>
+     *
+     * @since 2.0.0
+     */
+    const std::shared_ptr<CardResponseApi>& getCardResponse() const;
+
+    /**
+     * (package-private)<br>
+     * Builds the exception matching the failure.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    std::shared_ptr<Exception> toException() const;
+
+    /**
+     * (package-private)<br>
+     * Throws the exception matching the failure.
+     *
+     * @throw ReaderBrokenCommunicationException, CardBrokenCommunicationException or
+     *        UnexpectedStatusWordException according to the type of the failure.
+     * @since 2.0.0
+     */
+    [[noreturn]] void raise() const;
+
+private:
+    /**
+     * Gets the cause of the exception matching the failure, built from the cause failure if any.
+     */
+    std::shared_ptr<Exception> getCause() const;
+
+    /**
+     *
+     */
+    const Type mType;
+
+    /**
+     *
+     */
+    const std::shared_ptr<CardResponseApi> mCardResponse;
+
+    /**
+     *
+     */
+    const bool mIsCardResponseComplete;
+
+    /**
+     *
+     */
+    const std::string mMessage;
+
+    /**
+     *
+     */
+    const std::shared_ptr<Exception> mCause;
+
+    /**
+     *
+     */
+    const std::shared_ptr<const TransmitFailure> mCauseFailure;
+};
+
+/**
+ * (package-private)<br>
+ * Outcome of a card or reader exchange: either a value or a TransmitFailure.
+ *
+ * <p>Used on the internal transmission path so that the card and reader communication failures,
+ * frequent when cards are torn away, do not unwind the stack several times. They are converted to
+ * exceptions only at the public API boundary.
+ *
+ * @param T The type of the value.
+ * @since 2.0.0
+ */
+template <typename T>
+class TransmitResult final {
+public:
+    /**
+     * (package-private)<br>
+     * Creates a successful result holding a default-constructed value.
+     *
+     * @since 2.0.0
+     */
+    TransmitResult() : mValue(), mFailure(nullptr) {}
+
+    /**
+     * (package-private)<br>
+     * Creates a successful result.
+     *
+     * @param value The value.
+     * @since 2.0.0
+     */
+    TransmitResult(T value) : mValue(std::move(value)), mFailure(nullptr) {}
+
+    /**
+     * (package-private)<br>
+     * Creates a failed result.
+     *
+     * @param failure The failure (not null).
+     * @since 2.0.0
+     */
+    TransmitResult(const std::shared_ptr<const TransmitFailure> failure)
+    : mValue(), mFailure(failure) {}
+
+    /**
+     * (package-private)<br>
+     *
+     * @return True if the exchange succeeded.
+     * @since 2.0.0
+     */
+    inline bool isSuccess() const
+    {
+        return mFailure == nullptr;
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return The value, default-constructed if the exchange failed.
+     * @since 2.0.0
+     */
+    inline const T& getValue() const
+    {
+        return mValue;
+    }
+
+    /**
+     * (package-private)<br>
+     * Moves the value out of the result.
+     *
+     * @return The value, default-constructed if the exchange failed.
+     * @since 2.0.0
+     */
+    inline T takeValue()
+    {
+        return std::move(mValue);
+    }
+
+    /**
+     * (package-private)<br>
+     *
+     * @return Null if the exchange succeeded.
+     * @since 2.0.0
+     */
+    inline const std::shared_ptr<const TransmitFailure>& getFailure() const
+    {
+        return mFailure;
+    }
+
+    /**
+     * (package-private)<br>
+     * Gets the value, throwing the exception matching the failure if the exchange failed.
+     *
+     * @return The value.
+     * @throw ReaderBrokenCommunicationException, CardBrokenCommunicationException or
+     *        UnexpectedStatusWordException if the exchange failed.
+     * @since 2.0.0
+     */
+    inline T valueOrThrow()
+    {
+        if (mFailure != nullptr) {
+            mFailure->raise();
+        }
+
+        return std::move(mValue);
+    }
+
+private:
+    /**
+     *
+     */
+    T mValue;
+
+    /**
+     *
+     */
+    std::shared_ptr<const TransmitFailure> mFailure;
+};
+
+}
+}
+}
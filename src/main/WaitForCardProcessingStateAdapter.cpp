@@ -64,6 +64,17 @@ void WaitForCardProcessingStateAdapter::onEvent(const InternalEvent event)
         }
         break;
 
+    case InternalEvent::TIME_OUT:
+        /* The observers did not finalize the card processing in time */
+        getReader()->processCardProcessingTimeout();
+        if (getReader()->getDetectionMode() == DetectionMode::REPEATING) {
+            switchState(MonitoringState::WAIT_FOR_CARD_REMOVAL);
+        } else {
+            getReader()->processCardRemoved();
+            switchState(MonitoringState::WAIT_FOR_START_DETECTION);
+        }
+        break;
+
     case InternalEvent::STOP_DETECT:
         getReader()->processCardRemoved();
         switchState(MonitoringState::WAIT_FOR_START_DETECTION);
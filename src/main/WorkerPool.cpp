@@ -0,0 +1,121 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <system_error>
+
+namespace keyple {
+namespace core {
+namespace service {
+
+WorkerPool::WorkerPool()
+: mMaxThreadCount(std::max(2u, std::thread::hardware_concurrency())),
+  mIdleThreadCount(0),
+  mRunning(true)
+{
+    mThreads.reserve(mMaxThreadCount);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mRunning = false;
+    }
+    mCondition.notify_all();
+
+    for (auto& thread : mThreads) {
+        thread.join();
+    }
+}
+
+std::shared_ptr<WorkerPool> WorkerPool::getInstance()
+{
+    /* C++: function-local static, initialization is thread-safe */
+    static const std::shared_ptr<WorkerPool> instance(new WorkerPool());
+
+    return instance;
+}
+
+size_t WorkerPool::getMaxThreadCount() const
+{
+    return mMaxThreadCount;
+}
+
+void WorkerPool::run(const std::function<void()>& worker, const size_t parallelism)
+{
+    const auto batch = std::make_shared<Batch>();
+    batch->worker = &worker;
+    batch->activeCount = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        const size_t helperCount = std::min(parallelism, mMaxThreadCount + 1) - 1;
+        for (size_t i = 0; i < helperCount; i++) {
+            mQueue.push_back(batch);
+        }
+
+        /* Threads are added while the queued workers outnumber the idle ones */
+        while (mQueue.size() > mIdleThreadCount && mThreads.size() < mMaxThreadCount) {
+            try {
+                mThreads.emplace_back(&WorkerPool::loop, this);
+                mIdleThreadCount++;
+            } catch (const std::system_error&) {
+                /* The calling thread does the work left */
+                break;
+            }
+        }
+    }
+    mCondition.notify_all();
+
+    /* The calling thread takes its share */
+    worker();
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    /* The workers not started yet are no longer needed, the started ones are waited for */
+    mQueue.erase(std::remove(mQueue.begin(), mQueue.end(), batch), mQueue.end());
+    mCondition.wait(lock, [&batch]() { return batch->activeCount == 0; });
+}
+
+void WorkerPool::loop()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (true) {
+        mCondition.wait(lock, [this]() { return !mRunning || !mQueue.empty(); });
+        if (!mRunning) {
+            return;
+        }
+
+        const std::shared_ptr<Batch> batch = mQueue.front();
+        mQueue.pop_front();
+        batch->activeCount++;
+        mIdleThreadCount--;
+
+        /* The worker runs unlocked, the calling thread waits for its end */
+        lock.unlock();
+        (*batch->worker)();
+        lock.lock();
+
+        batch->activeCount--;
+        mIdleThreadCount++;
+        mCondition.notify_all();
+    }
+}
+
+}
+}
+}
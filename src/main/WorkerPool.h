@@ -0,0 +1,139 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Keyple Core Service */
+#include "KeypleServiceExport.h"
+
+namespace keyple {
+namespace core {
+namespace service {
+
+/**
+ * (package-private)<br>
+ * Service-wide pool of worker threads, shared by the parallel card response parsing and the
+ * parallel reader registration.
+ *
+ * <p>The number of threads is bounded by the hardware concurrency. They are started on demand and
+ * reused by the following calls.
+ *
+ * @since 2.0.0
+ */
+class KEYPLESERVICE_API WorkerPool final {
+public:
+    /**
+     * (package-private)<br>
+     * Gets the unique instance of the worker pool.
+     *
+     * @return A not null reference.
+     * @since 2.0.0
+     */
+    static std::shared_ptr<WorkerPool> getInstance();
+
+    /**
+     * Stops and joins the worker threads.
+     */
+    ~WorkerPool();
+
+    /**
+     * (package-private)<br>
+     * Runs a worker on the calling thread and, concurrently, on up to parallelism - 1 threads of
+     * the pool, then waits for the end of all of them.
+     *
+     * <p>The worker is expected to share its work through a common state and to return when no
+     * work remains. The calling thread always runs it: a worker still queued when the calling
+     * thread is done is dropped, and so is a worker for which no thread could be started. The
+     * method may therefore be called from a worker thread without deadlocking.
+     *
+     * @param worker The worker, must not throw.
+     * @param parallelism The maximum number of threads running the worker.
+     * @since 2.0.0
+     */
+    void run(const std::function<void()>& worker, const size_t parallelism);
+
+    /**
+     * (package-private)<br>
+     * Gets the maximum number of threads of the pool.
+     *
+     * @return A strictly positive number.
+     * @since 2.0.0
+     */
+    size_t getMaxThreadCount() const;
+
+private:
+    /**
+     * Worker shared by a calling thread and the pool threads running it.
+     */
+    struct Batch {
+        const std::function<void()>* worker;
+        size_t activeCount;
+    };
+
+    /**
+     *
+     */
+    std::mutex mMutex;
+
+    /**
+     * Signals a new worker to run, the end of a worker or the stop of the pool.
+     */
+    std::condition_variable mCondition;
+
+    /**
+     * Workers waiting for a thread, one entry per requested thread.
+     */
+    std::deque<std::shared_ptr<Batch>> mQueue;
+
+    /**
+     *
+     */
+    std::vector<std::thread> mThreads;
+
+    /**
+     *
+     */
+    const size_t mMaxThreadCount;
+
+    /**
+     * Number of threads waiting for a worker.
+     */
+    size_t mIdleThreadCount;
+
+    /**
+     *
+     */
+    bool mRunning;
+
+    /**
+     * Private constructor
+     */
+    WorkerPool();
+
+    /**
+     * (private)<br>
+     * Thread loop, running the queued workers until the pool is destroyed.
+     */
+    void loop();
+};
+
+}
+}
+}
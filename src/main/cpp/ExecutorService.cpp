@@ -15,6 +15,7 @@
 
 /* Keyple Core Service */
 #include "AbstractObservableStateAdapter.h"
+#include "TraceRecorder.h"
 
 /* Keyple Core Util */
 #include "Thread.h"
@@ -27,7 +28,15 @@ namespace cpp {
 using namespace keyple::core::service;
 using namespace keyple::core::util::cpp;
 
-ExecutorService::ExecutorService() : mRunning(true), mTerminated(false)
+ExecutorService::ExecutorService()
+: mRunning(true),
+  mTerminated(false),
+  mQueueDepthGauge(MetricsRegistry::getInstance()->getGauge(
+      MetricsRegistry::EXECUTOR_QUEUE_DEPTH,
+      "Number of jobs queued or running in the executors.")),
+  mJobExecutedCounter(MetricsRegistry::getInstance()->getCounter(
+      MetricsRegistry::EXECUTOR_JOB_EXECUTED,
+      "Number of jobs executed by the executors."))
 {
     mThread = new std::thread(&ExecutorService::run, this);
 }
@@ -35,10 +44,19 @@ ExecutorService::ExecutorService() : mRunning(true), mTerminated(false)
 ExecutorService::~ExecutorService()
 {
     mRunning = false;
+    mCondition.notify_all();
 
     while (!mTerminated) {
         Thread::sleep(10);
     }
+
+    /* Waits for the executor thread to release the lock, its last access to this object */
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    /* Jobs never executed no longer count in the queue depth */
+    for (size_t i = 0; i < mPool.size(); i++) {
+        mQueueDepthGauge->decrement();
+    }
 }
 
 void ExecutorService::run()
@@ -46,42 +64,98 @@ void ExecutorService::run()
     /* Emulates a SingleThreadExecutor (e.g. only one thread at a time) */
 
     while (mRunning) {
-        if (mPool.size()) {
-            /* Start first service and wait until completion */
-            std::shared_ptr<Job> job = mPool[0];
+        std::shared_ptr<Job> job = nullptr;
+
+        {
+            /* Woken up by a submission, the 100 ms period only bounds the reaction to shutdown */
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+                return !mPool.empty() || !mRunning;
+            });
+
+            if (!mRunning || mPool.empty()) {
+                continue;
+            }
+
+            job = mPool[0];
+        }
+
+        /* Start first service and wait until completion */
+        if (!job->isCancelled()) {
+            TraceRecorder::Span span("ExecutorService::run");
             job->run();
+            mJobExecutedCounter->increment();
+        }
 
-            /* Remove from vector */
-            mPool.erase(mPool.begin());
+        /*
+         * Released outside of the lock but before the removal: the job may hold the last
+         * reference to its owner, and a drained executor no longer holds the job.
+         */
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mPool[0].reset();
         }
+        job.reset();
 
-        Thread::sleep(100);
+        /* Remove from vector */
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mPool.erase(mPool.begin());
+        }
+        mQueueDepthGauge->decrement();
+        mCondition.notify_all();
     }
 
+    /* The executor may be destroyed as soon as it is terminated, nothing is accessed after */
+    std::lock_guard<std::mutex> lock(mMutex);
     mTerminated = true;
+    mCondition.notify_all();
 }
 
 void ExecutorService::execute(std::shared_ptr<Job> job)
 {
-    mPool.push_back(job);
+    submit(job);
 }
 
 std::shared_ptr<Job> ExecutorService::submit(std::shared_ptr<Job> job)
 {
-    mPool.push_back(job);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPool.push_back(job);
+    }
+    mQueueDepthGauge->increment();
+    mCondition.notify_all();
 
-    return mPool.back();
+    return job;
 }
 
 void ExecutorService::shutdown()
 {
     mRunning = false;
+    mCondition.notify_all();
 
     while (!mTerminated) {
         Thread::sleep(10);
     }
 }
 
+void ExecutorService::drain()
+{
+    /* A job cannot wait for its own end */
+    if (isExecutorThread()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    mCondition.wait(lock, [this]() { return mPool.empty() || mTerminated; });
+}
+
+bool ExecutorService::isExecutorThread() const
+{
+    return std::this_thread::get_id() == mThread->get_id();
+}
+
 }
 }
 }
@@ -12,12 +12,15 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <typeinfo>
 #include <vector>
 
 /* Keyple Core Service */
 #include "Job.h"
+#include "MetricsRegistry.h"
 
 /* Keyple Core Util */
 #include "LoggerFactory.h"
@@ -27,6 +30,7 @@ namespace core {
 namespace service {
 namespace cpp {
 
+using namespace keyple::core::service;
 using namespace keyple::core::util::cpp;
 
 class ExecutorService final {
@@ -56,6 +60,19 @@ public:
      */
     void shutdown();
 
+    /**
+     * Waits until all the jobs submitted so far have been executed (or cancelled).
+     *
+     * <p>Returns immediately when called from a job of this executor, the jobs submitted after it
+     * being executed once it has returned.
+     */
+    void drain();
+
+    /**
+     * Returns true if called from a job of this executor.
+     */
+    bool isExecutorThread() const;
+
     /**
      * /!\ MSVC requires operator= to be deleted because of std::future
      * not being copyable.
@@ -93,6 +110,26 @@ private:
      *
      */
     std::thread *mThread;
+
+    /**
+     * Protects mPool, which is filled by the callers and emptied by the executor thread.
+     */
+    std::mutex mMutex;
+
+    /**
+     * Signals a submission, the end of a job or the end of the executor.
+     */
+    std::condition_variable mCondition;
+
+    /**
+     * Number of jobs waiting or running, shared by all the executors.
+     */
+    std::shared_ptr<MetricsRegistry::Gauge> mQueueDepthGauge;
+
+    /**
+     *
+     */
+    std::shared_ptr<MetricsRegistry::Counter> mJobExecutedCounter;
 };
 
 }
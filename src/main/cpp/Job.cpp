@@ -33,7 +33,8 @@ bool Job::cancel(const bool mayInterruptIfRunning)
         throw IllegalArgumentException("Unsupported value for mayInterruptIfRunning (true)");
     }
 
-    if (!isAlive()) {
+    /* Like a FutureTask, a job not yet started can be cancelled, it will then never run */
+    if (isDone()) {
         return false;
     }
 
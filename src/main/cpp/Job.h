@@ -52,7 +52,7 @@ private:
     /**
      *
      */
-    bool mCancelled;
+    std::atomic<bool> mCancelled;
 };
 
 }
@@ -0,0 +1,71 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace spi {
+
+/**
+ * Optional extension of an observable {@link ReaderSpi} providing a low-cost, driver-level check
+ * of the presence of the card (e.g. a status query of the reader), used by the service to detect
+ * the card removal of a non-blocking reader instead of sending an APDU to the card.
+ *
+ * <p>The probe is invoked at each cycle of the removal monitoring, it must neither exchange data
+ * with the card nor throw exceptions: the outcome is reported through the returned code.
+ *
+ * @since 2.0.0
+ */
+class CardPresenceProbeSpi {
+public:
+    /**
+     * Outcome of a presence probe.
+     *
+     * @since 2.0.0
+     */
+    enum class Result {
+        /**
+         * The card is present.
+         */
+        CARD_PRESENT,
+
+        /**
+         * The card is absent.
+         */
+        CARD_ABSENT,
+
+        /**
+         * The presence of the card could not be determined (reader communication failure).
+         */
+        PROBE_FAILED
+    };
+
+    /**
+     *
+     */
+    virtual ~CardPresenceProbeSpi() = default;
+
+    /**
+     * Checks the presence of the card at the driver level.
+     *
+     * @return The outcome of the probe.
+     * @since 2.0.0
+     */
+    virtual Result probeCardPresence() = 0;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,54 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace spi {
+
+/**
+ * Optional extension of a {@link PluginSpi} providing a large number of readers (e.g. virtual
+ * readers), allowing the service to build and register the reader adapters concurrently when the
+ * plugin is registered.
+ *
+ * <p>When the plugin SPI implements this interface, the reader adapters are built on
+ * getReaderRegistrationThreadCount() threads, then published all at once: the plugin never
+ * exposes a partial reader list. Otherwise, the readers are registered one after the other.
+ *
+ * @since 2.0.0
+ */
+class ParallelReaderRegistrationSpi {
+public:
+    /**
+     *
+     */
+    virtual ~ParallelReaderRegistrationSpi() = default;
+
+    /**
+     * Gets the number of threads used to register the readers found at the plugin registration.
+     *
+     * <p>The threads are taken from a pool shared by the service and bounded by the hardware
+     * concurrency.
+     *
+     * @return A value less than 2 to register the readers sequentially.
+     * @since 2.0.0
+     */
+    virtual int getReaderRegistrationThreadCount() const = 0;
+};
+
+}
+}
+}
+}
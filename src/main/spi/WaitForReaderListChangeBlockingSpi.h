@@ -0,0 +1,69 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+namespace keyple {
+namespace core {
+namespace service {
+namespace spi {
+
+/**
+ * Optional extension of an {@link ObservablePluginSpi} able to signal the changes of its reader
+ * list (e.g. from an udev monitor or a PC/SC "\\?PnP?\Notification" wait), in place of the
+ * periodical search of the available reader names.
+ *
+ * <p>When the plugin SPI implements this interface, the monitoring thread of the observable
+ * plugin blocks in waitForReaderListChange() between two searches, so that reader connections
+ * and disconnections are detected immediately without consuming any CPU while idle. Otherwise,
+ * the reader names are searched every {@link ObservablePluginSpi#getMonitoringCycleDuration()}
+ * milliseconds.
+ *
+ * @since 2.0.0
+ */
+class WaitForReaderListChangeBlockingSpi {
+public:
+    /**
+     *
+     */
+    virtual ~WaitForReaderListChangeBlockingSpi() = default;
+
+    /**
+     * Waits indefinitely for a change of the list of available readers.
+     *
+     * <p>A spurious return (without any change) is harmless, the reader names being searched
+     * again after each return.
+     *
+     * @throw TaskCanceledException If the wait has been stopped by stopWaitForReaderListChange().
+     * @throw PluginIOException If a plugin communication error occurs.
+     * @since 2.0.0
+     */
+    virtual void waitForReaderListChange() = 0;
+
+    /**
+     * Stops the current or the next waitForReaderListChange(), which must then throw a
+     * TaskCanceledException.
+     *
+     * <p>This method is invoked by another thread than the monitoring one, possibly just before
+     * the monitoring thread starts to wait: the stop request must remain pending until a
+     * waitForReaderListChange() consumes it.
+     *
+     * @since 2.0.0
+     */
+    virtual void stopWaitForReaderListChange() = 0;
+};
+
+}
+}
+}
+}
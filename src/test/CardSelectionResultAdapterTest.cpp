@@ -10,6 +10,10 @@
  * SPDX-License-Identifier: EPL-2.0                                                               *
  **************************************************************************************************/
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -17,6 +21,7 @@
 #include "CardSelectionResultAdapter.h"
 
 /* Keyple Core Util */
+#include "IllegalArgumentException.h"
 #include "IllegalStateException.h"
 
 /* Mock */
@@ -159,3 +164,119 @@ TEST(CardSelectionResultAdapterTest, getActiveSmartCard_whenNotSmartCard_shouldR
 
     tearDown();
 }
+
+TEST(CardSelectionResultAdapterTest,
+     getSmartCards_whenSparseIndexes_shouldReturnOnlyThePresentSmartCardsInOrder)
+{
+    setUp();
+
+    const auto smartCard2 = std::make_shared<SmartCardMock>();
+
+    CardSelectionResultAdapter cardSelectionResult(4);
+    cardSelectionResult.addSmartCard(1, smartCard);
+    cardSelectionResult.addSmartCard(3, smartCard2);
+
+    const std::map<int, std::shared_ptr<SmartCard>> expected = {{1, smartCard}, {3, smartCard2}};
+    ASSERT_EQ(cardSelectionResult.getSmartCards(), expected);
+    ASSERT_EQ(cardSelectionResult.getActiveSmartCard(), smartCard2);
+
+    tearDown();
+}
+
+TEST(CardSelectionResultAdapterTest,
+     getSmartCards_whenSmartCardAddedAfterACall_shouldReturnTheUpdatedMap)
+{
+    setUp();
+
+    CardSelectionResultAdapter cardSelectionResult(1);
+    cardSelectionResult.addSmartCard(0, nullptr);
+
+    ASSERT_EQ(cardSelectionResult.getSmartCards().size(), 1);
+
+    /* Beyond the expected number of selections */
+    cardSelectionResult.addSmartCard(2, smartCard);
+
+    const auto& smartCards = cardSelectionResult.getSmartCards();
+    ASSERT_EQ(smartCards.size(), 2);
+    ASSERT_EQ(smartCards.at(2), smartCard);
+    ASSERT_EQ(cardSelectionResult.getActiveSelectionIndex(), 2);
+
+    tearDown();
+}
+
+TEST(CardSelectionResultAdapterTest,
+     getSmartCards_whenSmartCardAddedAfterACall_shouldKeepThePreviousReferenceValid)
+{
+    setUp();
+
+    CardSelectionResultAdapter cardSelectionResult(2);
+    cardSelectionResult.addSmartCard(0, smartCard);
+
+    const std::map<int, std::shared_ptr<SmartCard>>& smartCards =
+        cardSelectionResult.getSmartCards();
+
+    cardSelectionResult.addSmartCard(1, nullptr);
+    cardSelectionResult.getSmartCards();
+
+    ASSERT_EQ(&smartCards, &cardSelectionResult.getSmartCards());
+    ASSERT_EQ(smartCards.size(), 2);
+    ASSERT_EQ(smartCards.at(0), smartCard);
+
+    tearDown();
+}
+
+TEST(CardSelectionResultAdapterTest, getSmartCards_whenCalledConcurrently_shouldReturnTheFullMap)
+{
+    setUp();
+
+    CardSelectionResultAdapter cardSelectionResult(64);
+    for (int i = 0; i < 64; i++) {
+        cardSelectionResult.addSmartCard(i, smartCard);
+    }
+
+    std::vector<std::thread> threads;
+    std::atomic<int> incompleteCount(0);
+
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&cardSelectionResult, &incompleteCount]() {
+            if (cardSelectionResult.getSmartCards().size() != 64) {
+                incompleteCount++;
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(incompleteCount, 0);
+    ASSERT_EQ(cardSelectionResult.getSmartCards().size(), 64);
+
+    tearDown();
+}
+
+TEST(CardSelectionResultAdapterTest, addSmartCard_whenIndexIsNegative_shouldIAE)
+{
+    setUp();
+
+    CardSelectionResultAdapter cardSelectionResult;
+
+    EXPECT_THROW(cardSelectionResult.addSmartCard(-1, smartCard), IllegalArgumentException);
+    ASSERT_EQ(cardSelectionResult.getActiveSelectionIndex(), -1);
+
+    tearDown();
+}
+
+TEST(CardSelectionResultAdapterTest, addSmartCard_whenIndexAlreadyPresent_shouldKeepTheFirstOne)
+{
+    setUp();
+
+    CardSelectionResultAdapter cardSelectionResult(1);
+    cardSelectionResult.addSmartCard(0, smartCard);
+    cardSelectionResult.addSmartCard(0, nullptr);
+
+    ASSERT_EQ(cardSelectionResult.getActiveSmartCard(), smartCard);
+    ASSERT_EQ(cardSelectionResult.getSmartCards().at(0), smartCard);
+
+    tearDown();
+}
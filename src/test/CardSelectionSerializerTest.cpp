@@ -0,0 +1,387 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <algorithm>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+#include "IllegalArgumentException.h"
+
+/* Keyple Core Service */
+#include "ApduRequestAdapter.h"
+#include "ApduResponseAdapter.h"
+#include "CardRequestAdapter.h"
+#include "CardResponseAdapter.h"
+#include "CardSelectionResponseAdapter.h"
+#include "CardSelectionScenarioAdapter.h"
+#include "CardSelectionSerializer.h"
+#include "CompiledCardSelectionRequest.h"
+#include "CompiledCardSelector.h"
+#include "ScheduledCardSelectionsResponseAdapter.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::card::spi;
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::string CARD_PROTOCOL = "cardProtocol";
+static const std::string POWER_ON_DATA_REGEX = "3B8F.*";
+static const std::string POWER_ON_DATA = "3B8F8001804F0CA000000306030001000000006A";
+static const std::vector<int> SUCCESSFUL_STATUS_WORDS({0x9000, 0x6283});
+
+static std::shared_ptr<CardSelectionScenarioAdapter> cardSelectionScenario;
+static std::shared_ptr<ScheduledCardSelectionsResponseAdapter> scheduledCardSelectionsResponse;
+
+static void setUp()
+{
+    auto cardSelector = std::make_shared<CompiledCardSelector>(
+                            CARD_PROTOCOL,
+                            POWER_ON_DATA_REGEX,
+                            ByteArrayUtil::fromHex("A000000291"),
+                            CardSelectorSpi::FileOccurrence::NEXT,
+                            CardSelectorSpi::FileControlInformation::FCP,
+                            SUCCESSFUL_STATUS_WORDS);
+
+    std::vector<std::shared_ptr<ApduRequestSpi>> apduRequests;
+    apduRequests.push_back(
+        std::make_shared<ApduRequestAdapter>(ByteArrayUtil::fromHex("00B2014400"),
+                                             std::vector<int>({0x9000}),
+                                             "Read Record"));
+    apduRequests.push_back(
+        std::make_shared<ApduRequestAdapter>(ByteArrayUtil::fromHex("00C0000000"),
+                                             std::vector<int>({0x9000, 0x6200}),
+                                             ""));
+
+    std::vector<std::shared_ptr<CardSelectionRequestSpi>> cardSelectionRequests;
+    cardSelectionRequests.push_back(
+        std::make_shared<CompiledCardSelectionRequest>(
+            cardSelector, std::make_shared<CardRequestAdapter>(apduRequests, true)));
+    cardSelectionRequests.push_back(
+        std::make_shared<CompiledCardSelectionRequest>(cardSelector, nullptr));
+
+    cardSelectionScenario = std::make_shared<CardSelectionScenarioAdapter>(
+                                cardSelectionRequests,
+                                MultiSelectionProcessing::PROCESS_ALL,
+                                ChannelControl::CLOSE_AFTER);
+
+    std::vector<std::shared_ptr<ApduResponseApi>> apduResponses;
+    apduResponses.push_back(
+        std::make_shared<ApduResponseAdapter>(ByteArrayUtil::fromHex("1122339000")));
+    apduResponses.push_back(std::make_shared<ApduResponseAdapter>(ByteArrayUtil::fromHex("6A82")));
+
+    std::vector<std::shared_ptr<CardSelectionResponseApi>> cardSelectionResponses;
+    cardSelectionResponses.push_back(
+        std::make_shared<CardSelectionResponseAdapter>(
+            POWER_ON_DATA,
+            std::make_shared<ApduResponseAdapter>(
+                ByteArrayUtil::fromHex("6F0884061122334455669000")),
+            true,
+            std::make_shared<CardResponseAdapter>(apduResponses, true)));
+    cardSelectionResponses.push_back(
+        std::make_shared<CardSelectionResponseAdapter>("", nullptr, false, nullptr));
+
+    scheduledCardSelectionsResponse =
+        std::make_shared<ScheduledCardSelectionsResponseAdapter>(cardSelectionResponses);
+}
+
+static void tearDown()
+{
+    cardSelectionScenario.reset();
+    scheduledCardSelectionsResponse.reset();
+}
+
+static void assertApduResponsesEqual(
+    const std::vector<std::shared_ptr<ApduResponseApi>>& expected,
+    const std::vector<std::shared_ptr<ApduResponseApi>>& actual)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(actual[i]->getApdu(), expected[i]->getApdu());
+    }
+}
+
+TEST(CardSelectionSerializerTest, cardSelectionScenario_whenRoundTrip_shouldBeRestored)
+{
+    setUp();
+
+    const std::vector<uint8_t> buffer = CardSelectionSerializer::serialize(*cardSelectionScenario);
+    const std::shared_ptr<CardSelectionScenarioAdapter> restored =
+        CardSelectionSerializer::deserializeCardSelectionScenario(buffer);
+
+    ASSERT_EQ(restored->getMultiSelectionProcessing(), MultiSelectionProcessing::PROCESS_ALL);
+    ASSERT_EQ(restored->getChannelControl(), ChannelControl::CLOSE_AFTER);
+
+    const auto& expectedRequests = cardSelectionScenario->getCardSelectionRequests();
+    const auto& restoredRequests = restored->getCardSelectionRequests();
+    ASSERT_EQ(restoredRequests.size(), expectedRequests.size());
+
+    for (size_t i = 0; i < expectedRequests.size(); i++) {
+        const auto expectedSelector = expectedRequests[i]->getCardSelector();
+        const auto restoredSelector = restoredRequests[i]->getCardSelector();
+        ASSERT_EQ(restoredSelector->getCardProtocol(), expectedSelector->getCardProtocol());
+        ASSERT_EQ(restoredSelector->getPowerOnDataRegex(),
+                  expectedSelector->getPowerOnDataRegex());
+        ASSERT_EQ(restoredSelector->getAid(), expectedSelector->getAid());
+        ASSERT_EQ(restoredSelector->getFileOccurrence(), expectedSelector->getFileOccurrence());
+        ASSERT_EQ(restoredSelector->getFileControlInformation(),
+                  expectedSelector->getFileControlInformation());
+        ASSERT_EQ(restoredSelector->getSuccessfulSelectionStatusWords(),
+                  expectedSelector->getSuccessfulSelectionStatusWords());
+    }
+
+    ASSERT_EQ(restoredRequests[1]->getCardRequest(), nullptr);
+
+    const auto expectedCardRequest = expectedRequests[0]->getCardRequest();
+    const auto restoredCardRequest = restoredRequests[0]->getCardRequest();
+    ASSERT_NE(restoredCardRequest, nullptr);
+    ASSERT_TRUE(restoredCardRequest->stopOnUnsuccessfulStatusWord());
+
+    const auto& expectedApduRequests = expectedCardRequest->getApduRequests();
+    const auto& restoredApduRequests = restoredCardRequest->getApduRequests();
+    ASSERT_EQ(restoredApduRequests.size(), expectedApduRequests.size());
+
+    for (size_t i = 0; i < expectedApduRequests.size(); i++) {
+        ASSERT_EQ(restoredApduRequests[i]->getApdu(), expectedApduRequests[i]->getApdu());
+        ASSERT_EQ(restoredApduRequests[i]->getSuccessfulStatusWords(),
+                  expectedApduRequests[i]->getSuccessfulStatusWords());
+        ASSERT_EQ(restoredApduRequests[i]->getInfo(), expectedApduRequests[i]->getInfo());
+    }
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, scheduledCardSelectionsResponse_whenRoundTrip_shouldBeRestored)
+{
+    setUp();
+
+    const std::vector<uint8_t> buffer =
+        CardSelectionSerializer::serialize(*scheduledCardSelectionsResponse);
+    const std::shared_ptr<ScheduledCardSelectionsResponseAdapter> restored =
+        CardSelectionSerializer::deserializeScheduledCardSelectionsResponse(buffer);
+
+    const auto& expectedResponses = scheduledCardSelectionsResponse->getCardSelectionResponses();
+    const auto& restoredResponses = restored->getCardSelectionResponses();
+    ASSERT_EQ(restoredResponses.size(), expectedResponses.size());
+
+    ASSERT_TRUE(restoredResponses[0]->hasMatched());
+    ASSERT_EQ(restoredResponses[0]->getPowerOnData(), POWER_ON_DATA);
+    ASSERT_EQ(restoredResponses[0]->getSelectApplicationResponse()->getApdu(),
+              expectedResponses[0]->getSelectApplicationResponse()->getApdu());
+    ASSERT_TRUE(restoredResponses[0]->getCardResponse()->isLogicalChannelOpen());
+    assertApduResponsesEqual(expectedResponses[0]->getCardResponse()->getApduResponses(),
+                             restoredResponses[0]->getCardResponse()->getApduResponses());
+
+    ASSERT_FALSE(restoredResponses[1]->hasMatched());
+    ASSERT_EQ(restoredResponses[1]->getPowerOnData(), "");
+    ASSERT_EQ(restoredResponses[1]->getSelectApplicationResponse(), nullptr);
+    ASSERT_EQ(restoredResponses[1]->getCardResponse(), nullptr);
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, cardResponse_whenRoundTrip_shouldBeRestored)
+{
+    setUp();
+
+    const auto cardResponse =
+        scheduledCardSelectionsResponse->getCardSelectionResponses()[0]->getCardResponse();
+
+    const std::shared_ptr<CardResponseAdapter> restored =
+        CardSelectionSerializer::deserializeCardResponse(
+            CardSelectionSerializer::serialize(*cardResponse));
+
+    ASSERT_TRUE(restored->isLogicalChannelOpen());
+    assertApduResponsesEqual(cardResponse->getApduResponses(), restored->getApduResponses());
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, hasMatched_shouldReadTheResponseInPlace)
+{
+    setUp();
+
+    const std::vector<uint8_t> buffer =
+        CardSelectionSerializer::serialize(*scheduledCardSelectionsResponse);
+
+    ASSERT_EQ(CardSelectionSerializer::getCardSelectionResponseCount(buffer), 2);
+    ASSERT_TRUE(CardSelectionSerializer::hasMatched(buffer, 0));
+    ASSERT_FALSE(CardSelectionSerializer::hasMatched(buffer, 1));
+    EXPECT_THROW(CardSelectionSerializer::hasMatched(buffer, 2), IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, getApduResponse_shouldReadTheResponsesInPlace)
+{
+    setUp();
+
+    const std::vector<uint8_t> buffer =
+        CardSelectionSerializer::serialize(*scheduledCardSelectionsResponse);
+    const uint8_t* const begin = buffer.data();
+    const uint8_t* const end = buffer.data() + buffer.size();
+
+    const CardSelectionSerializer::ByteView powerOnData =
+        CardSelectionSerializer::getPowerOnData(buffer, 0);
+    ASSERT_TRUE(powerOnData.data >= begin && powerOnData.data + powerOnData.size <= end);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(powerOnData.data), powerOnData.size),
+              POWER_ON_DATA);
+
+    const CardSelectionSerializer::ByteView selectApplicationResponse =
+        CardSelectionSerializer::getSelectApplicationResponse(buffer, 0);
+    ASSERT_TRUE(selectApplicationResponse.data >= begin &&
+                selectApplicationResponse.data + selectApplicationResponse.size <= end);
+    ASSERT_EQ(std::vector<uint8_t>(selectApplicationResponse.data,
+                                   selectApplicationResponse.data + selectApplicationResponse.size),
+              ByteArrayUtil::fromHex("6F0884061122334455669000"));
+    ASSERT_EQ(CardSelectionSerializer::getStatusWord(selectApplicationResponse), 0x9000);
+
+    ASSERT_EQ(CardSelectionSerializer::getApduResponseCount(buffer, 0), 2);
+    const CardSelectionSerializer::ByteView apduResponse =
+        CardSelectionSerializer::getApduResponse(buffer, 0, 1);
+    ASSERT_EQ(std::vector<uint8_t>(apduResponse.data, apduResponse.data + apduResponse.size),
+              ByteArrayUtil::fromHex("6A82"));
+    ASSERT_EQ(CardSelectionSerializer::getStatusWord(apduResponse), 0x6A82);
+    EXPECT_THROW(CardSelectionSerializer::getApduResponse(buffer, 0, 2), IllegalArgumentException);
+
+    /* The second response has none of them */
+    ASSERT_EQ(CardSelectionSerializer::getPowerOnData(buffer, 1).size, 0);
+    ASSERT_EQ(CardSelectionSerializer::getSelectApplicationResponse(buffer, 1).data, nullptr);
+    ASSERT_EQ(CardSelectionSerializer::getApduResponseCount(buffer, 1), 0);
+    EXPECT_THROW(CardSelectionSerializer::getApduResponse(buffer, 1, 0), IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, deserialize_whenKindIsNotTheExpectedOne_shouldIAE)
+{
+    setUp();
+
+    const std::vector<uint8_t> buffer =
+        CardSelectionSerializer::serialize(*scheduledCardSelectionsResponse);
+
+    EXPECT_THROW(CardSelectionSerializer::deserializeCardSelectionScenario(buffer),
+                 IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, deserialize_whenVersionIsNotSupported_shouldIAE)
+{
+    setUp();
+
+    std::vector<uint8_t> buffer = CardSelectionSerializer::serialize(*cardSelectionScenario);
+    buffer[3] = CardSelectionSerializer::FORMAT_VERSION + 1;
+
+    EXPECT_THROW(CardSelectionSerializer::deserializeCardSelectionScenario(buffer),
+                 IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, deserialize_whenBufferIsTruncated_shouldIAE)
+{
+    setUp();
+
+    const std::vector<uint8_t> scenarioBuffer =
+        CardSelectionSerializer::serialize(*cardSelectionScenario);
+    const std::vector<uint8_t> responseBuffer =
+        CardSelectionSerializer::serialize(*scheduledCardSelectionsResponse);
+
+    for (size_t length = 0; length < scenarioBuffer.size(); length++) {
+        const std::vector<uint8_t> truncated(scenarioBuffer.begin(),
+                                             scenarioBuffer.begin() + length);
+        EXPECT_THROW(CardSelectionSerializer::deserializeCardSelectionScenario(truncated),
+                     IllegalArgumentException);
+    }
+
+    for (size_t length = 0; length < responseBuffer.size(); length++) {
+        const std::vector<uint8_t> truncated(responseBuffer.begin(),
+                                             responseBuffer.begin() + length);
+        EXPECT_THROW(CardSelectionSerializer::deserializeScheduledCardSelectionsResponse(truncated),
+                     IllegalArgumentException);
+    }
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, deserialize_whenApduResponseLengthIsCorrupted_shouldIAE)
+{
+    setUp();
+
+    const auto cardResponse =
+        scheduledCardSelectionsResponse->getCardSelectionResponses()[0]->getCardResponse();
+    std::vector<uint8_t> buffer = CardSelectionSerializer::serialize(*cardResponse);
+
+    /* Root: logical channel flag (1 byte), count (4 bytes), then the offset of the first APDU */
+    const size_t apduPosition = buffer[13] | buffer[14] << 8 | buffer[15] << 16 | buffer[16] << 24;
+
+    for (uint8_t length = 0; length < 2; length++) {
+        buffer[apduPosition] = length;
+        buffer[apduPosition + 1] = 0;
+        buffer[apduPosition + 2] = 0;
+        buffer[apduPosition + 3] = 0;
+
+        EXPECT_THROW(CardSelectionSerializer::deserializeCardResponse(buffer),
+                     IllegalArgumentException);
+    }
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, deserialize_whenAnyByteIsZeroed_shouldRestoreOrIAE)
+{
+    setUp();
+
+    const std::vector<uint8_t> responseBuffer =
+        CardSelectionSerializer::serialize(*scheduledCardSelectionsResponse);
+
+    /* Lengths, counts and offsets set to 0 or 1 must never be trusted */
+    for (size_t i = 0; i < responseBuffer.size(); i++) {
+        for (uint8_t value = 0; value < 2; value++) {
+            std::vector<uint8_t> corrupted(responseBuffer);
+            corrupted[i] = value;
+
+            try {
+                CardSelectionSerializer::deserializeScheduledCardSelectionsResponse(corrupted);
+            } catch (const IllegalArgumentException& e) {
+                (void)e;
+            }
+        }
+    }
+
+    tearDown();
+}
+
+TEST(CardSelectionSerializerTest, deserialize_whenPowerOnDataRegexIsInvalid_shouldIAE)
+{
+    setUp();
+
+    std::vector<uint8_t> buffer = CardSelectionSerializer::serialize(*cardSelectionScenario);
+
+    /* "3B8F.*" becomes "3B8F(*" */
+    auto it = std::search(buffer.begin(),
+                          buffer.end(),
+                          POWER_ON_DATA_REGEX.begin(),
+                          POWER_ON_DATA_REGEX.end());
+    ASSERT_NE(it, buffer.end());
+    *(it + 4) = '(';
+
+    EXPECT_THROW(CardSelectionSerializer::deserializeCardSelectionScenario(buffer),
+                 IllegalArgumentException);
+
+    tearDown();
+}
@@ -0,0 +1,423 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Card */
+#include "ParseException.h"
+#include "ReaderBrokenCommunicationException.h"
+
+/* Calypsonet Terminal Reader */
+#include "InvalidCardResponseException.h"
+#include "ReaderCommunicationException.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+/* Keyple Core Service */
+#include "CompiledCardSelectionScenario.h"
+#include "CompiledCardSelector.h"
+
+/* Mock */
+#include "AbstractReaderAdapterMock.h"
+#include "CardSelectionRequestSpiMock.h"
+#include "CardSelectionResponseApiMock.h"
+#include "CardSelectionSpiMock.h"
+#include "CardSelectorSpiMock.h"
+#include "ReaderSpiMock.h"
+#include "SmartCardMock.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::card;
+using namespace calypsonet::terminal::card::spi;
+using namespace calypsonet::terminal::reader;
+using namespace keyple::core::common;
+using namespace keyple::core::service;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::string PLUGIN_NAME = "plugin";
+static const std::string READER_NAME_1 = "reader1";
+static const std::string READER_NAME_2 = "reader2";
+static const std::string EMPTY = "";
+static const std::vector<int> SUCCESSFUL_STATUS_WORDS({0x9000});
+
+static std::shared_ptr<ReaderSpiMock> readerSpi;
+static std::shared_ptr<AbstractReaderAdapterMock> reader1;
+static std::shared_ptr<AbstractReaderAdapterMock> reader2;
+static std::shared_ptr<CardSelectorSpiMock> cardSelector;
+static std::shared_ptr<CardSelectionRequestSpiMock> cardSelectionRequestSpi;
+static std::shared_ptr<CardSelectionSpiMock> cardSelectionSpi;
+static std::shared_ptr<SmartCardMock> smartCard;
+static std::shared_ptr<CardSelectionResponseApiMock> matchingResponse;
+static std::shared_ptr<CardSelectionResponseApiMock> notMatchingResponse;
+
+static void setUp()
+{
+    readerSpi = std::make_shared<ReaderSpiMock>();
+    reader1 = std::make_shared<AbstractReaderAdapterMock>(
+                  READER_NAME_1,
+                  std::dynamic_pointer_cast<KeypleReaderExtension>(readerSpi),
+                  PLUGIN_NAME);
+    reader2 = std::make_shared<AbstractReaderAdapterMock>(
+                  READER_NAME_2,
+                  std::dynamic_pointer_cast<KeypleReaderExtension>(readerSpi),
+                  PLUGIN_NAME);
+    reader1->doRegister();
+    reader2->doRegister();
+
+    cardSelector = std::make_shared<CardSelectorSpiMock>();
+    EXPECT_CALL(*cardSelector.get(), getCardProtocol()).WillRepeatedly(ReturnRef(EMPTY));
+    EXPECT_CALL(*cardSelector.get(), getPowerOnDataRegex()).WillRepeatedly(ReturnRef(EMPTY));
+    EXPECT_CALL(*cardSelector.get(), getAid()).WillRepeatedly(Return(std::vector<uint8_t>()));
+    EXPECT_CALL(*cardSelector.get(), getFileOccurrence())
+        .WillRepeatedly(Return(CardSelectorSpi::FileOccurrence::FIRST));
+    EXPECT_CALL(*cardSelector.get(), getFileControlInformation())
+        .WillRepeatedly(Return(CardSelectorSpi::FileControlInformation::FCI));
+    EXPECT_CALL(*cardSelector.get(), getSuccessfulSelectionStatusWords())
+        .WillRepeatedly(ReturnRef(SUCCESSFUL_STATUS_WORDS));
+
+    cardSelectionRequestSpi = std::make_shared<CardSelectionRequestSpiMock>();
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardSelector())
+        .WillRepeatedly(Return(cardSelector));
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardRequest()).WillRepeatedly(Return(nullptr));
+
+    smartCard = std::make_shared<SmartCardMock>();
+    cardSelectionSpi = std::make_shared<CardSelectionSpiMock>();
+    EXPECT_CALL(*cardSelectionSpi.get(), parse(_)).WillRepeatedly(Return(smartCard));
+
+    matchingResponse = std::make_shared<CardSelectionResponseApiMock>();
+    EXPECT_CALL(*matchingResponse.get(), hasMatched()).WillRepeatedly(Return(true));
+    notMatchingResponse = std::make_shared<CardSelectionResponseApiMock>();
+    EXPECT_CALL(*notMatchingResponse.get(), hasMatched()).WillRepeatedly(Return(false));
+}
+
+static void tearDown()
+{
+    /* The selections abandoned after a first match end on the executors of the readers */
+    reader1->waitForPendingJobs();
+    reader2->waitForPendingJobs();
+
+    notMatchingResponse.reset();
+    matchingResponse.reset();
+    cardSelectionSpi.reset();
+    smartCard.reset();
+    cardSelectionRequestSpi.reset();
+    cardSelector.reset();
+    reader2.reset();
+    reader1.reset();
+    readerSpi.reset();
+}
+
+static std::shared_ptr<CompiledCardSelectionScenario> buildScenario(
+    const ChannelControl channelControl, const bool compileCardSelectors = true)
+{
+    return std::make_shared<CompiledCardSelectionScenario>(
+               std::vector<std::shared_ptr<CardSelectionSpi>>({cardSelectionSpi}),
+               std::vector<std::shared_ptr<CardSelectionRequestSpi>>({cardSelectionRequestSpi}),
+               MultiSelectionProcessing::FIRST_MATCH,
+               channelControl,
+               1,
+               compileCardSelectors);
+}
+
+static const std::vector<std::shared_ptr<CardSelectionResponseApi>> responses(
+    const std::shared_ptr<CardSelectionResponseApi> cardSelectionResponse)
+{
+    return std::vector<std::shared_ptr<CardSelectionResponseApi>>({cardSelectionResponse});
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenario_whenCompiled_shouldTransmitCompiledSelectors)
+{
+    setUp();
+
+    std::vector<std::shared_ptr<CardSelectionRequestSpi>> transmitted;
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(DoAll(SaveArg<0>(&transmitted), Return(responses(matchingResponse))));
+
+    buildScenario(ChannelControl::CLOSE_AFTER, true)->processCardSelectionScenario(reader1);
+
+    ASSERT_EQ(transmitted.size(), 1);
+    ASSERT_NE(std::dynamic_pointer_cast<CompiledCardSelector>(transmitted[0]->getCardSelector()),
+              nullptr);
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenario_whenNotCompiled_shouldTransmitTheOriginalRequests)
+{
+    setUp();
+
+    std::vector<std::shared_ptr<CardSelectionRequestSpi>> transmitted;
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(DoAll(SaveArg<0>(&transmitted), Return(responses(matchingResponse))));
+
+    buildScenario(ChannelControl::CLOSE_AFTER, false)->processCardSelectionScenario(reader1);
+
+    ASSERT_EQ(transmitted.size(), 1);
+    ASSERT_EQ(transmitted[0], cardSelectionRequestSpi);
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenario_withSeveralReaders_shouldReturnTheResultOfEachReader)
+{
+    setUp();
+
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Return(responses(matchingResponse)));
+    EXPECT_CALL(*reader2.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Return(responses(notMatchingResponse)));
+
+    const auto results = buildScenario(ChannelControl::CLOSE_AFTER)
+                             ->processCardSelectionScenario(
+                                 std::vector<std::shared_ptr<CardReader>>({reader1, reader2}));
+
+    ASSERT_EQ(results.size(), 2);
+    ASSERT_EQ(results.at(READER_NAME_1)->getActiveSmartCard(), smartCard);
+    ASSERT_EQ(results.at(READER_NAME_1)->getActiveSelectionIndex(), 0);
+    ASSERT_TRUE(results.at(READER_NAME_2)->getSmartCards().empty());
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenario_whenAReaderFails_shouldThrowItsException)
+{
+    setUp();
+
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Return(responses(matchingResponse)));
+    EXPECT_CALL(*reader2.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Throw(ReaderBrokenCommunicationException(nullptr, false, "")));
+
+    EXPECT_THROW(buildScenario(ChannelControl::CLOSE_AFTER)
+                     ->processCardSelectionScenario(
+                         std::vector<std::shared_ptr<CardReader>>({reader1, reader2})),
+                 ReaderCommunicationException);
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenario_whenAReaderIsPresentTwice_shouldIAE)
+{
+    setUp();
+
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _)).Times(0);
+
+    EXPECT_THROW(buildScenario(ChannelControl::CLOSE_AFTER)
+                     ->processCardSelectionScenario(
+                         std::vector<std::shared_ptr<CardReader>>({reader1, reader1})),
+                 IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenarioUntilFirstMatch_shouldReturnTheFirstMatchingReaderOnly)
+{
+    setUp();
+
+    /* The first reader is the slowest one, its card is selected after the second one */
+    std::promise<void> released;
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(DoAll(InvokeWithoutArgs([]() {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                        }),
+                        Return(responses(matchingResponse))));
+    EXPECT_CALL(*reader1.get(), releaseChannel())
+        .WillOnce(InvokeWithoutArgs([&released]() { released.set_value(); }));
+    EXPECT_CALL(*reader2.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Return(responses(matchingResponse)));
+    EXPECT_CALL(*reader2.get(), releaseChannel()).Times(0);
+
+    const auto results = buildScenario(ChannelControl::KEEP_OPEN)
+                             ->processCardSelectionScenarioUntilFirstMatch(
+                                 std::vector<std::shared_ptr<CardReader>>({reader1, reader2}));
+
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_EQ(results.at(READER_NAME_2)->getActiveSmartCard(), smartCard);
+
+    /* The channel of the card selected too late is released in the background */
+    ASSERT_EQ(released.get_future().wait_for(std::chrono::seconds(2)), std::future_status::ready);
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenarioUntilFirstMatch_whenReaderReused_shouldWaitForAbandonedSelection)
+{
+    setUp();
+
+    std::mutex mutex;
+    std::vector<std::string> events;
+    const auto record = [&mutex, &events](const std::string& event) {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.push_back(event);
+    };
+
+    /* The selection on the first reader is abandoned, the second reader matching first */
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(DoAll(InvokeWithoutArgs([&record]() {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                            record("abandoned selection");
+                        }),
+                        Return(responses(matchingResponse))))
+        .WillOnce(DoAll(InvokeWithoutArgs([&record]() { record("next selection"); }),
+                        Return(responses(matchingResponse))));
+    EXPECT_CALL(*reader1.get(), releaseChannel())
+        .WillOnce(InvokeWithoutArgs([&record]() { record("release"); }));
+    EXPECT_CALL(*reader2.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Return(responses(matchingResponse)));
+
+    const auto scenario = buildScenario(ChannelControl::KEEP_OPEN);
+    scenario->processCardSelectionScenarioUntilFirstMatch(
+        std::vector<std::shared_ptr<CardReader>>({reader1, reader2}));
+
+    /* Reused at once, the first reader is not driven by two threads */
+    scenario->processCardSelectionScenario(reader1);
+
+    const std::vector<std::string> expected = {"abandoned selection", "release", "next selection"};
+    ASSERT_EQ(events, expected);
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenarioUntilFirstMatch_whenNoCardMatches_shouldReturnEmptyMap)
+{
+    setUp();
+
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Return(responses(notMatchingResponse)));
+    EXPECT_CALL(*reader2.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Return(responses(notMatchingResponse)));
+
+    const auto results = buildScenario(ChannelControl::KEEP_OPEN)
+                             ->processCardSelectionScenarioUntilFirstMatch(
+                                 std::vector<std::shared_ptr<CardReader>>({reader1, reader2}));
+
+    ASSERT_TRUE(results.empty());
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionScenarioUntilFirstMatch_whenAReaderFailsAndAnotherMatches_shouldNotThrow)
+{
+    setUp();
+
+    EXPECT_CALL(*reader1.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Throw(ReaderBrokenCommunicationException(nullptr, false, "")));
+    EXPECT_CALL(*reader2.get(), processCardSelectionRequests(_, _, _))
+        .WillOnce(Return(responses(matchingResponse)));
+
+    const auto results = buildScenario(ChannelControl::CLOSE_AFTER)
+                             ->processCardSelectionScenarioUntilFirstMatch(
+                                 std::vector<std::shared_ptr<CardReader>>({reader1, reader2}));
+
+    ASSERT_EQ(results.size(), 1);
+    ASSERT_EQ(results.count(READER_NAME_2), 1);
+
+    tearDown();
+}
+
+/**
+ * Card selection whose parsing takes the given delay then returns the given smart card, or fails
+ * with the given message if the smart card is null.
+ */
+static std::shared_ptr<CardSelectionSpiMock> buildSlowCardSelection(
+    const int delayMillis, const std::shared_ptr<SmartCardMock> parsedSmartCard,
+    const std::string& errorMessage = "")
+{
+    auto cardSelection = std::make_shared<CardSelectionSpiMock>();
+
+    EXPECT_CALL(*cardSelection.get(), parse(_))
+        .WillOnce(InvokeWithoutArgs([delayMillis, parsedSmartCard, errorMessage]()
+                                        -> std::shared_ptr<SmartCardSpi> {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delayMillis));
+            if (parsedSmartCard == nullptr) {
+                throw ParseException(errorMessage);
+            }
+            return parsedSmartCard;
+        }));
+
+    return cardSelection;
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionResponses_withParallelParsing_shouldKeepTheOrderOfTheIndexes)
+{
+    setUp();
+
+    /* The first selections are the slowest to parse */
+    const auto smartCard0 = std::make_shared<SmartCardMock>();
+    const auto smartCard1 = std::make_shared<SmartCardMock>();
+    const auto smartCard3 = std::make_shared<SmartCardMock>();
+    const std::vector<std::shared_ptr<CardSelectionSpi>> cardSelections = {
+        buildSlowCardSelection(60, smartCard0),
+        buildSlowCardSelection(30, smartCard1),
+        std::make_shared<CardSelectionSpiMock>(),
+        buildSlowCardSelection(0, smartCard3)};
+
+    const auto result = CompiledCardSelectionScenario::processCardSelectionResponses(
+                            cardSelections,
+                            std::vector<std::shared_ptr<CardSelectionResponseApi>>(
+                                {matchingResponse,
+                                 matchingResponse,
+                                 notMatchingResponse,
+                                 matchingResponse}),
+                            4);
+
+    const std::map<int, std::shared_ptr<SmartCard>> expected = {
+        {0, smartCard0}, {1, smartCard1}, {3, smartCard3}};
+    ASSERT_EQ(result->getSmartCards(), expected);
+    ASSERT_EQ(result->getActiveSelectionIndex(), 3);
+    ASSERT_EQ(result->getActiveSmartCard(), smartCard3);
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectionScenarioTest,
+     processCardSelectionResponses_withParallelParsing_shouldThrowTheErrorOfTheLowestIndex)
+{
+    setUp();
+
+    /* The second failure happens first */
+    const std::vector<std::shared_ptr<CardSelectionSpi>> cardSelections = {
+        buildSlowCardSelection(0, smartCard),
+        buildSlowCardSelection(60, nullptr, "first"),
+        buildSlowCardSelection(0, nullptr, "second")};
+
+    try {
+        CompiledCardSelectionScenario::processCardSelectionResponses(
+            cardSelections,
+            std::vector<std::shared_ptr<CardSelectionResponseApi>>(
+                {matchingResponse, matchingResponse, matchingResponse}),
+            3);
+        FAIL();
+    } catch (const InvalidCardResponseException& e) {
+        ASSERT_NE(e.getMessage().find("first"), std::string::npos);
+    }
+
+    tearDown();
+}
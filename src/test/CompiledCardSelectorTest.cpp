@@ -0,0 +1,125 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Keyple Core Service */
+#include "CompiledCardSelector.h"
+
+/* Mock */
+#include "CardSelectorSpiMock.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::card::spi;
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+static const std::string CARD_PROTOCOL = "cardProtocol";
+static const std::string POWER_ON_DATA_REGEX = "3B8F.*";
+static const std::vector<int> SUCCESSFUL_STATUS_WORDS({0x9000, 0x6283});
+
+static std::shared_ptr<CardSelectorSpiMock> cardSelector;
+
+static void setUp()
+{
+    cardSelector = std::make_shared<CardSelectorSpiMock>();
+    EXPECT_CALL(*cardSelector.get(), getCardProtocol()).WillRepeatedly(ReturnRef(CARD_PROTOCOL));
+    EXPECT_CALL(*cardSelector.get(), getPowerOnDataRegex())
+        .WillRepeatedly(ReturnRef(POWER_ON_DATA_REGEX));
+    EXPECT_CALL(*cardSelector.get(), getAid())
+        .WillRepeatedly(Return(ByteArrayUtil::fromHex("A000000291")));
+    EXPECT_CALL(*cardSelector.get(), getFileOccurrence())
+        .WillRepeatedly(Return(CardSelectorSpi::FileOccurrence::NEXT));
+    EXPECT_CALL(*cardSelector.get(), getFileControlInformation())
+        .WillRepeatedly(Return(CardSelectorSpi::FileControlInformation::FCP));
+    EXPECT_CALL(*cardSelector.get(), getSuccessfulSelectionStatusWords())
+        .WillRepeatedly(ReturnRef(SUCCESSFUL_STATUS_WORDS));
+}
+
+static void tearDown()
+{
+    cardSelector.reset();
+}
+
+TEST(CompiledCardSelectorTest, constructor_shouldCopyTheCardSelector)
+{
+    setUp();
+
+    CompiledCardSelector compiledCardSelector(cardSelector);
+
+    ASSERT_EQ(compiledCardSelector.getCardProtocol(), CARD_PROTOCOL);
+    ASSERT_EQ(compiledCardSelector.getPowerOnDataRegex(), POWER_ON_DATA_REGEX);
+    ASSERT_EQ(compiledCardSelector.getAid(), ByteArrayUtil::fromHex("A000000291"));
+    ASSERT_EQ(compiledCardSelector.getFileOccurrence(), CardSelectorSpi::FileOccurrence::NEXT);
+    ASSERT_EQ(compiledCardSelector.getFileControlInformation(),
+              CardSelectorSpi::FileControlInformation::FCP);
+    ASSERT_EQ(compiledCardSelector.getSuccessfulSelectionStatusWords(), SUCCESSFUL_STATUS_WORDS);
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectorTest, constructor_shouldBuildTheSelectApplicationCommand)
+{
+    setUp();
+
+    CompiledCardSelector compiledCardSelector(cardSelector);
+
+    ASSERT_EQ(compiledCardSelector.getSelectApplicationP2(), 0x06);
+    ASSERT_EQ(compiledCardSelector.getSelectApplicationCommand(),
+              ByteArrayUtil::fromHex("00A4040605A00000029100"));
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectorTest, constructor_whenNoAid_shouldNotBuildTheSelectApplicationCommand)
+{
+    setUp();
+
+    EXPECT_CALL(*cardSelector.get(), getAid()).WillRepeatedly(Return(std::vector<uint8_t>()));
+
+    CompiledCardSelector compiledCardSelector(cardSelector);
+
+    ASSERT_TRUE(compiledCardSelector.getSelectApplicationCommand().empty());
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectorTest, matchesPowerOnData_shouldApplyTheRegex)
+{
+    setUp();
+
+    CompiledCardSelector compiledCardSelector(cardSelector);
+
+    ASSERT_TRUE(compiledCardSelector.matchesPowerOnData("3B8F8001804F0CA0"));
+    ASSERT_TRUE(compiledCardSelector.matchesPowerOnData(""));
+    ASSERT_FALSE(compiledCardSelector.matchesPowerOnData("3B8E8001"));
+
+    tearDown();
+}
+
+TEST(CompiledCardSelectorTest, isSuccessfulSelectionStatusWord_shouldUseTheSuccessfulStatusWords)
+{
+    setUp();
+
+    CompiledCardSelector compiledCardSelector(cardSelector);
+
+    ASSERT_TRUE(compiledCardSelector.isSuccessfulSelectionStatusWord(0x9000));
+    ASSERT_TRUE(compiledCardSelector.isSuccessfulSelectionStatusWord(0x6283));
+    ASSERT_FALSE(compiledCardSelector.isSuccessfulSelectionStatusWord(0x6A82));
+
+    tearDown();
+}
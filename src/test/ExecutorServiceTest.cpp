@@ -0,0 +1,111 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+/* Keyple Core Service */
+#include "ExecutorService.h"
+#include "Job.h"
+
+using namespace testing;
+
+using namespace keyple::core::service::cpp;
+using namespace keyple::core::util::cpp::exception;
+
+class FunctionJob final : public Job {
+public:
+    FunctionJob(const std::function<void()>& function) : Job("FunctionJob"), mFunction(function) {}
+
+    /**
+     * C++: this replaces run() override
+     */
+    void execute() final
+    {
+        mFunction();
+    }
+
+private:
+    const std::function<void()> mFunction;
+};
+
+/**
+ * Waits until the jobs submitted so far have been processed, the executor running them in order.
+ */
+static void waitForPreviousJobs(ExecutorService& executorService)
+{
+    auto processed = std::make_shared<std::promise<void>>();
+    std::future<void> future = processed->get_future();
+
+    executorService.submit(std::make_shared<FunctionJob>([processed]() {
+        processed->set_value();
+    }));
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+}
+
+TEST(ExecutorServiceTest, cancel_whenQueued_shouldNeverRunTheJob)
+{
+    ExecutorService executorService;
+
+    std::promise<void> firstJobStarted;
+    std::promise<void> firstJobReleased;
+    std::shared_future<void> firstJobReleasedFuture = firstJobReleased.get_future().share();
+    std::atomic<bool> secondJobRan(false);
+
+    executorService.submit(std::make_shared<FunctionJob>([&]() {
+        firstJobStarted.set_value();
+        firstJobReleasedFuture.wait_for(std::chrono::seconds(1));
+    }));
+    const std::shared_ptr<Job> secondJob = executorService.submit(
+        std::make_shared<FunctionJob>([&secondJobRan]() { secondJobRan = true; }));
+
+    /* The second job is still queued behind the first one */
+    ASSERT_EQ(firstJobStarted.get_future().wait_for(std::chrono::seconds(1)),
+              std::future_status::ready);
+    ASSERT_TRUE(secondJob->cancel(false));
+    firstJobReleased.set_value();
+
+    waitForPreviousJobs(executorService);
+
+    ASSERT_TRUE(secondJob->isCancelled());
+    ASSERT_FALSE(secondJobRan);
+}
+
+TEST(ExecutorServiceTest, cancel_whenDone_shouldReturnFalse)
+{
+    ExecutorService executorService;
+
+    const std::shared_ptr<Job> job = executorService.submit(std::make_shared<FunctionJob>([]() {}));
+    waitForPreviousJobs(executorService);
+
+    ASSERT_TRUE(job->isDone());
+    ASSERT_FALSE(job->cancel(false));
+    ASSERT_FALSE(job->isCancelled());
+}
+
+TEST(ExecutorServiceTest, cancel_whenMayInterruptIfRunning_shouldIAE)
+{
+    const std::shared_ptr<Job> job = std::make_shared<FunctionJob>([]() {});
+
+    EXPECT_THROW(job->cancel(true), IllegalArgumentException);
+}
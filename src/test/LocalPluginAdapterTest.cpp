@@ -10,6 +10,10 @@
  * SPDX-License-Identifier: EPL-2.0                                                               *
  **************************************************************************************************/
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -32,6 +36,7 @@
 
 /* Mock */
 #include "ObservableReaderSpiMock.h"
+#include "ParallelPluginSpiMock.h"
 #include "PluginSpiMock.h"
 #include "ReaderSpiMock.h"
 
@@ -173,6 +178,120 @@ TEST(LocalPluginAdapterTest,
     tearDown();
 }
 
+TEST(LocalPluginAdapterTest,
+     register_withParallelRegistrationSpi_shouldRegisterAndPublishAllReaders)
+{
+    setUp();
+
+    const int readerCount = 64;
+
+    std::vector<std::shared_ptr<ReaderSpiMock>> readerSpiMocks;
+    std::vector<std::shared_ptr<ReaderSpi>> readerSpis;
+    for (int i = 0; i < readerCount; i++) {
+        auto readerSpi = std::make_shared<ReaderSpiMock>("reader-" + std::to_string(i));
+        EXPECT_CALL(*readerSpi.get(), onUnregister()).WillRepeatedly(Return());
+        readerSpiMocks.push_back(readerSpi);
+        readerSpis.push_back(readerSpi);
+    }
+    readerSpis.push_back(observableReader);
+
+    auto parallelPluginSpi = std::make_shared<ParallelPluginSpiMock>();
+    EXPECT_CALL(*parallelPluginSpi.get(), getName()).WillRepeatedly(ReturnRef(PLUGIN_NAME));
+    EXPECT_CALL(*parallelPluginSpi.get(), onUnregister()).WillRepeatedly(Return());
+    EXPECT_CALL(*parallelPluginSpi.get(), getReaderRegistrationThreadCount())
+        .WillRepeatedly(Return(4));
+    EXPECT_CALL(*parallelPluginSpi.get(), searchAvailableReaders())
+        .WillRepeatedly(Return(readerSpis));
+
+    LocalPluginAdapter localPluginAdapter(parallelPluginSpi);
+    localPluginAdapter.doRegister();
+
+    ASSERT_EQ(localPluginAdapter.getReaders().size(), readerSpis.size());
+
+    for (const auto& readerSpi : readerSpis) {
+        const auto reader = std::dynamic_pointer_cast<LocalReaderAdapter>(
+                                localPluginAdapter.getReader(readerSpi->getName()));
+        ASSERT_NE(reader, nullptr);
+        reader->checkStatus();
+    }
+
+    ASSERT_NE(std::dynamic_pointer_cast<ObservableLocalReaderAdapter>(
+                  localPluginAdapter.getReader(OBSERVABLE_READER_NAME)),
+              nullptr);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPluginAdapterTest, getReadersSnapshot_whenReadersChange_shouldRemainUnchanged)
+{
+    setUp();
+
+    std::vector<std::shared_ptr<ReaderSpi>> readerSpis;
+    readerSpis.push_back(readerSpi1);
+    EXPECT_CALL(*pluginSpi.get(), searchAvailableReaders()).WillRepeatedly(Return(readerSpis));
+
+    LocalPluginAdapter localPluginAdapter(pluginSpi);
+    localPluginAdapter.doRegister();
+
+    const auto snapshot = localPluginAdapter.getReadersSnapshot();
+
+    localPluginAdapter.addReaderToMap(localPluginAdapter.buildLocalReaderAdapter(readerSpi2));
+    localPluginAdapter.removeReaderFromMap(READER_NAME_1);
+
+    ASSERT_EQ(snapshot->size(), 1);
+    ASSERT_NE(snapshot->find(READER_NAME_1), snapshot->end());
+    ASSERT_EQ(localPluginAdapter.getReaderNames(), std::vector<std::string>({READER_NAME_2}));
+
+    tearDown();
+}
+
+TEST(LocalPluginAdapterTest, getReader_whileReadersAreAddedAndRemoved_shouldAlwaysFindStableReader)
+{
+    setUp();
+
+    std::vector<std::shared_ptr<ReaderSpi>> readerSpis;
+    readerSpis.push_back(readerSpi1);
+    EXPECT_CALL(*pluginSpi.get(), searchAvailableReaders()).WillRepeatedly(Return(readerSpis));
+
+    LocalPluginAdapter localPluginAdapter(pluginSpi);
+    localPluginAdapter.doRegister();
+
+    const auto reader2 = localPluginAdapter.buildLocalReaderAdapter(readerSpi2);
+    std::atomic<bool> running(true);
+    std::atomic<int> errors(0);
+
+    std::vector<std::thread> lookups;
+    for (int i = 0; i < 4; i++) {
+        lookups.push_back(std::thread([&localPluginAdapter, &running, &errors]() {
+            while (running) {
+                const size_t count = localPluginAdapter.getReaders().size();
+                if (localPluginAdapter.getReader(READER_NAME_1) == nullptr ||
+                    count < 1 ||
+                    count > 2) {
+                    errors++;
+                }
+            }
+        }));
+    }
+
+    for (int i = 0; i < 10000; i++) {
+        localPluginAdapter.addReaderToMap(reader2);
+        localPluginAdapter.removeReaderFromMap(READER_NAME_2);
+    }
+
+    running = false;
+    for (auto& lookup : lookups) {
+        lookup.join();
+    }
+
+    ASSERT_EQ(errors, 0);
+    ASSERT_EQ(localPluginAdapter.getReaderNames(), std::vector<std::string>({READER_NAME_1}));
+
+    tearDown();
+}
+
 TEST(LocalPluginAdapterTest, getReaders_whenNotRegistered_shouldISE)
 {
     setUp();
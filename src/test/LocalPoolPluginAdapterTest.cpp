@@ -10,6 +10,11 @@
  * SPDX-License-Identifier: EPL-2.0                                                               *
  **************************************************************************************************/
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -27,8 +32,11 @@
 #include "LocalPluginAdapter.h"
 #include "LocalPoolPluginAdapter.h"
 #include "LocalReaderAdapter.h"
+#include "MetricsRegistry.h"
 #include "ObservableReader.h"
 #include "ObservableLocalReaderAdapter.h"
+#include "ReaderGroupSelectionStrategy.h"
+#include "ReaderLease.h"
 
 /* Mock */
 #include "ObservableReaderSpiMock.h"
@@ -207,6 +215,382 @@ TEST(LocalPoolPluginAdapterTest, allocateReader_whenReaderIsObservable_shouldRet
     tearDown();
 }
 
+TEST(LocalPoolPluginAdapterTest, allocateReader_afterRelease_shouldReuseTheWarmAdapter)
+{
+    setUp();
+
+    const auto metrics = MetricsRegistry::getInstance();
+    const auto hitCounter = metrics->getCounter(MetricsRegistry::POOL_WARM_ADAPTER_HIT,
+                                                "",
+                                                {{"plugin", PLUGIN_NAME}});
+    const auto missCounter = metrics->getCounter(MetricsRegistry::POOL_WARM_ADAPTER_MISS,
+                                                 "",
+                                                 {{"plugin", PLUGIN_NAME}});
+    const uint64_t hitsBefore = hitCounter->getValue();
+    const uint64_t missesBefore = missCounter->getValue();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<Reader> reader1 = localPluginAdapter.allocateReader(GROUP_1);
+    localPluginAdapter.releaseReader(reader1);
+
+    ASSERT_EQ(localPluginAdapter.getWarmAdapterCount(), 1);
+    ASSERT_TRUE(localPluginAdapter.getReaderNames().empty());
+
+    std::shared_ptr<Reader> reader2 = localPluginAdapter.allocateReader(GROUP_1);
+
+    ASSERT_EQ(reader2, reader1);
+    ASSERT_EQ(localPluginAdapter.getWarmAdapterCount(), 0);
+    ASSERT_EQ(localPluginAdapter.getReader(READER_NAME_1), reader2);
+    std::dynamic_pointer_cast<LocalReaderAdapter>(reader2)->checkStatus();
+
+    ASSERT_EQ(hitCounter->getValue(), hitsBefore + 1);
+    ASSERT_EQ(missCounter->getValue(), missesBefore + 1);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, allocateReader_whenNoReaderBeforeTimeout_shouldKPE)
+{
+    setUp();
+
+    EXPECT_CALL(*poolPluginSpi.get(), allocateReader(GROUP_1))
+        .WillRepeatedly(Throw(PluginIOException("Plugin IO Exception")));
+
+    const auto timeoutCounter =
+        MetricsRegistry::getInstance()->getCounter(MetricsRegistry::POOL_ALLOCATION_TIMEOUT,
+                                                   "",
+                                                   {{"plugin", PLUGIN_NAME},
+                                                    {"group", GROUP_1}});
+    const uint64_t timeoutsBefore = timeoutCounter->getValue();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    EXPECT_THROW(localPluginAdapter.allocateReader(GROUP_1, 50), KeyplePluginException);
+    ASSERT_EQ(timeoutCounter->getValue(), timeoutsBefore + 1);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, allocateReader_whenReaderReleasedWhileWaiting_shouldReturnReader)
+{
+    setUp();
+
+    /* Only one reader in the group: the SPI fails while it is allocated */
+    EXPECT_CALL(*poolPluginSpi.get(), allocateReader(GROUP_1))
+        .WillOnce(Return(readerSpi1))
+        .WillOnce(Throw(PluginIOException("Plugin IO Exception")))
+        .WillRepeatedly(Return(readerSpi1));
+
+    const auto waitCounter =
+        MetricsRegistry::getInstance()->getCounter(MetricsRegistry::POOL_ALLOCATION_WAIT,
+                                                   "",
+                                                   {{"plugin", PLUGIN_NAME},
+                                                    {"group", GROUP_1}});
+    const uint64_t waitsBefore = waitCounter->getValue();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<Reader> reader1 = localPluginAdapter.allocateReader(GROUP_1);
+
+    std::thread releaser([&localPluginAdapter, &reader1]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        localPluginAdapter.releaseReader(reader1);
+    });
+
+    std::shared_ptr<Reader> reader2 = localPluginAdapter.allocateReader(GROUP_1, 5000);
+    releaser.join();
+
+    ASSERT_NE(reader2, nullptr);
+    ASSERT_EQ(reader2->getName(), READER_NAME_1);
+    ASSERT_EQ(waitCounter->getValue(), waitsBefore + 1);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, allocateReader_whenReaderReleasedDuringAFailedAttempt_shouldRetry)
+{
+    setUp();
+
+    std::promise<void> attemptStarted;
+    std::promise<void> readerReleased;
+    std::shared_future<void> readerReleasedFuture = readerReleased.get_future().share();
+
+    /* The attempt of the waiter fails after the release of the only reader of the group */
+    EXPECT_CALL(*poolPluginSpi.get(), allocateReader(GROUP_1))
+        .WillOnce(Return(readerSpi1))
+        .WillOnce(InvokeWithoutArgs([&]() -> std::shared_ptr<ReaderSpi> {
+            attemptStarted.set_value();
+            readerReleasedFuture.wait_for(std::chrono::seconds(1));
+            throw PluginIOException("Plugin IO Exception");
+        }))
+        .WillRepeatedly(Return(readerSpi1));
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<Reader> reader1 = localPluginAdapter.allocateReader(GROUP_1);
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::future<std::shared_ptr<Reader>> reader2 =
+        std::async(std::launch::async, [&localPluginAdapter]() {
+            return localPluginAdapter.allocateReader(GROUP_1, 5000);
+        });
+
+    ASSERT_EQ(attemptStarted.get_future().wait_for(std::chrono::seconds(1)),
+              std::future_status::ready);
+    localPluginAdapter.releaseReader(reader1);
+    readerReleased.set_value();
+
+    ASSERT_EQ(reader2.get()->getName(), READER_NAME_1);
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, allocateReaderAsync_whenSucceeds_shouldReturnReader)
+{
+    setUp();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::future<std::shared_ptr<Reader>> future =
+        localPluginAdapter.allocateReaderAsync(GROUP_2, 1000);
+
+    ASSERT_EQ(future.get()->getName(), READER_NAME_2);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, allocateReader_whenLeastOutstanding_shouldChooseTheLessLoadedGroup)
+{
+    setUp();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    localPluginAdapter.allocateReader(GROUP_1);
+    ASSERT_EQ(localPluginAdapter.getAllocatedReaderCount(GROUP_1), 1);
+
+    std::shared_ptr<Reader> reader =
+        localPluginAdapter.allocateReader({GROUP_1, GROUP_2},
+                                          ReaderGroupSelectionStrategy::LEAST_OUTSTANDING);
+
+    ASSERT_EQ(reader->getName(), READER_NAME_2);
+    ASSERT_EQ(localPluginAdapter.getAllocatedReaderCount(GROUP_2), 1);
+
+    localPluginAdapter.releaseReader(reader);
+    ASSERT_EQ(localPluginAdapter.getAllocatedReaderCount(GROUP_2), 0);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, allocateReader_whenRoundRobin_shouldAlternateTheGroups)
+{
+    setUp();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<Reader> reader1 =
+        localPluginAdapter.allocateReader({GROUP_1, GROUP_2},
+                                          ReaderGroupSelectionStrategy::ROUND_ROBIN);
+    std::shared_ptr<Reader> reader2 =
+        localPluginAdapter.allocateReader({GROUP_1, GROUP_2},
+                                          ReaderGroupSelectionStrategy::ROUND_ROBIN);
+
+    ASSERT_EQ(reader1->getName(), READER_NAME_1);
+    ASSERT_EQ(reader2->getName(), READER_NAME_2);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, allocateReader_whenChosenGroupFails_shouldTryTheNextOne)
+{
+    setUp();
+
+    EXPECT_CALL(*poolPluginSpi.get(), allocateReader(GROUP_3))
+        .WillRepeatedly(Throw(PluginIOException("Plugin IO Exception")));
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<Reader> reader =
+        localPluginAdapter.allocateReader({GROUP_3, GROUP_2},
+                                          ReaderGroupSelectionStrategy::LATENCY_WEIGHTED);
+
+    ASSERT_EQ(reader->getName(), READER_NAME_2);
+    EXPECT_THROW(localPluginAdapter.allocateReader({GROUP_3},
+                                                   ReaderGroupSelectionStrategy::ROUND_ROBIN),
+                 KeyplePluginException);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, leaseReader_whenLeaseReleased_shouldReleaseReader)
+{
+    setUp();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<ReaderLease> lease = localPluginAdapter.leaseReader(GROUP_1, 10000);
+
+    ASSERT_EQ(lease->getReader()->getName(), READER_NAME_1);
+    ASSERT_TRUE(lease->isActive());
+    ASSERT_GT(lease->getRemainingMillis(), 0);
+
+    lease->release();
+
+    ASSERT_FALSE(lease->isActive());
+    ASSERT_EQ(lease->getRemainingMillis(), 0);
+    ASSERT_TRUE(localPluginAdapter.getReaderNames().empty());
+    EXPECT_THROW(lease->renew(1000), IllegalStateException);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, leaseReader_whenLeaseDestroyed_shouldReleaseReader)
+{
+    setUp();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    {
+        std::shared_ptr<ReaderLease> lease = localPluginAdapter.leaseReader(GROUP_1, 10000);
+        ASSERT_EQ(localPluginAdapter.getReaderNames().size(), 1);
+    }
+
+    ASSERT_TRUE(localPluginAdapter.getReaderNames().empty());
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, leaseReader_whenLeaseExpires_shouldReclaimReader)
+{
+    setUp();
+
+    EXPECT_CALL(*poolPluginSpi.get(), releaseReader(_)).Times(1).WillOnce(Return());
+
+    const auto reclaimedCounter =
+        MetricsRegistry::getInstance()->getCounter(MetricsRegistry::POOL_LEASE_RECLAIMED,
+                                                   "",
+                                                   {{"plugin", PLUGIN_NAME}});
+    const uint64_t reclaimedBefore = reclaimedCounter->getValue();
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<ReaderLease> lease = localPluginAdapter.leaseReader(GROUP_1, 50);
+    std::shared_ptr<Reader> reader = lease->getReader();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    ASSERT_FALSE(lease->isActive());
+    ASSERT_TRUE(localPluginAdapter.getReaderNames().empty());
+    ASSERT_EQ(reclaimedCounter->getValue(), reclaimedBefore + 1);
+
+    /* The stale reader is ignored, the SPI is not invoked again */
+    localPluginAdapter.releaseReader(reader);
+    lease.reset();
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, releaseReader_whenRacingTheLeaseSweeper_shouldReleaseOnce)
+{
+    setUp();
+
+    std::atomic<int> releaseCount(0);
+    std::promise<void> reclaimStarted;
+    std::promise<void> holderDone;
+    std::shared_future<void> holderDoneFuture = holderDone.get_future().share();
+
+    /* The sweeper is held in the SPI while the holder releases the reader */
+    EXPECT_CALL(*poolPluginSpi.get(), releaseReader(_))
+        .WillRepeatedly(InvokeWithoutArgs([&]() {
+            if (releaseCount++ == 0) {
+                reclaimStarted.set_value();
+                holderDoneFuture.wait_for(std::chrono::seconds(1));
+            }
+        }));
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<ReaderLease> lease = localPluginAdapter.leaseReader(GROUP_1, 10);
+    std::shared_ptr<Reader> reader = lease->getReader();
+
+    ASSERT_EQ(reclaimStarted.get_future().wait_for(std::chrono::seconds(1)),
+              std::future_status::ready);
+
+    localPluginAdapter.releaseReader(reader);
+    lease->release();
+    holderDone.set_value();
+
+    for (int i = 0; i < 100 && !localPluginAdapter.getReaderNames().empty(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_TRUE(localPluginAdapter.getReaderNames().empty());
+    ASSERT_EQ(releaseCount, 1);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
+TEST(LocalPoolPluginAdapterTest, releaseReader_whenReaderIsObservable_shouldNotKeepTheAdapter)
+{
+    setUp();
+
+    EXPECT_CALL(*poolPluginSpi.get(), allocateReader(GROUP_3))
+        .WillRepeatedly(Return(observableReader));
+
+    LocalPoolPluginAdapter localPluginAdapter(poolPluginSpi);
+    localPluginAdapter.doRegister();
+
+    std::shared_ptr<Reader> reader1 = localPluginAdapter.allocateReader(GROUP_3);
+    localPluginAdapter.releaseReader(reader1);
+
+    ASSERT_EQ(localPluginAdapter.getWarmAdapterCount(), 0);
+
+    std::shared_ptr<Reader> reader2 = localPluginAdapter.allocateReader(GROUP_3);
+
+    ASSERT_NE(reader2, reader1);
+
+    localPluginAdapter.doUnregister();
+
+    tearDown();
+}
+
 TEST(LocalPoolPluginAdapterTest, releaseReader_whenNotRegistered_shouldISE)
 {
     setUp();
@@ -35,9 +35,11 @@
 #include "ByteArrayUtil.h"
 
 /* Keyple Core Service */
+#include "CompiledCardSelectionRequest.h"
 #include "LocalReaderAdapter.h"
 #include "LocalConfigurableReaderAdapter.h"
 #include "MultiSelectionProcessing.h"
+#include "TransmitResult.h"
 
 /* Mock */
 #include "ApduRequestSpiMock.h"
@@ -283,6 +285,68 @@ TEST(LocalReaderAdapterTest,
     tearDown();
 }
 
+TEST(LocalReaderAdapterTest,
+     transmitCardSelectionRequests_withCompiledCardSelector_shouldNotQueryTheCardSelectorAgain)
+{
+    setUp();
+
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(ByteArrayUtil::fromHex("00A4040005112233445500")))
+        .Times(2)
+        .WillRepeatedly(Return(selectResponseApdu1));
+    EXPECT_CALL(*cardSelector.get(), getAid()).WillRepeatedly(Return(ByteArrayUtil::fromHex("1122334455")));
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardSelector()).WillRepeatedly(Return(cardSelector));
+
+    const std::vector<std::shared_ptr<CardSelectionRequestSpi>> cardSelectionRequests =
+        {std::make_shared<CompiledCardSelectionRequest>(cardSelectionRequestSpi)};
+
+    /* Everything is taken from the compiled selector from now on */
+    EXPECT_CALL(*cardSelector.get(), getAid()).Times(0);
+    EXPECT_CALL(*cardSelector.get(), getSuccessfulSelectionStatusWords()).Times(0);
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    for (int i = 0; i < 2; i++) {
+        const auto& cardSelectionResponses =
+            localReaderAdapter.transmitCardSelectionRequests(cardSelectionRequests,
+                                                             MultiSelectionProcessing::FIRST_MATCH,
+                                                             ChannelControl::CLOSE_AFTER);
+
+        ASSERT_EQ(cardSelectionResponses.size(), 1);
+        ASSERT_EQ(cardSelectionResponses[0]->getSelectApplicationResponse()->getApdu(), selectResponseApdu1);
+        ASSERT_TRUE(cardSelectionResponses[0]->hasMatched());
+    }
+
+    tearDown();
+}
+
+TEST(LocalReaderAdapterTest,
+     transmitCardSelectionRequests_withNonMatchingPowerOnDataCompiledCardSelector_shouldReturnNotMatchingResponse)
+{
+    setUp();
+
+    const std::string powerOnData = "FAILINGREGEX";
+    EXPECT_CALL(*cardSelector.get(), getPowerOnDataRegex()).WillRepeatedly(ReturnRef(powerOnData));
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardSelector()).WillRepeatedly(Return(cardSelector));
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    const auto& cardSelectionResponses =
+        localReaderAdapter.transmitCardSelectionRequests(
+            std::vector<std::shared_ptr<CardSelectionRequestSpi>>(
+                {std::make_shared<CompiledCardSelectionRequest>(cardSelectionRequestSpi)}),
+            MultiSelectionProcessing::FIRST_MATCH,
+            ChannelControl::CLOSE_AFTER);
+
+    ASSERT_EQ(cardSelectionResponses.size(), 1);
+    ASSERT_EQ(cardSelectionResponses[0]->getPowerOnData(), POWER_ON_DATA);
+    ASSERT_FALSE(cardSelectionResponses[0]->hasMatched());
+    ASSERT_FALSE(localReaderAdapter.isLogicalChannelOpen());
+
+    tearDown();
+}
+
 TEST(LocalReaderAdapterTest,
      transmitCardSelectionRequests_withMatchingDFNameFilteringCardSelectorInvalidatedRejected_shouldReturnNotMatchingResponseAndNotOpenChannel)
 {
@@ -464,6 +528,98 @@ TEST(LocalReaderAdapterTest,
     tearDown();
 }
 
+TEST(LocalReaderAdapterTest,
+     tryTransmitCardSelectionRequests_whenTransmitApduThrowsReaderIOException_shouldReturnFailure)
+{
+    setUp();
+
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardSelector()).WillRepeatedly(Return(cardSelector));
+    EXPECT_CALL(*cardSelector.get(), getAid()).WillRepeatedly(Return(ByteArrayUtil::fromHex("12341234")));
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(_)).Times(1).WillOnce(Throw(ReaderIOException("Reader IO Exception")));
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    const auto result = localReaderAdapter.tryTransmitCardSelectionRequests(
+                            std::vector<std::shared_ptr<CardSelectionRequestSpi>>(
+                                {cardSelectionRequestSpi}),
+                            MultiSelectionProcessing::FIRST_MATCH,
+                            ChannelControl::CLOSE_AFTER);
+
+    ASSERT_FALSE(result.isSuccess());
+    ASSERT_EQ(result.getFailure()->getType(),
+              TransmitFailure::Type::READER_BROKEN_COMMUNICATION);
+    EXPECT_THROW(result.getFailure()->raise(), ReaderBrokenCommunicationException);
+
+    tearDown();
+}
+
+TEST(LocalReaderAdapterTest,
+     tryProcessCardSelectionRequests_withUnsuccessfulStatusWord_shouldReturnFailure)
+{
+    setUp();
+
+    const std::vector<uint8_t> requestApdu = ByteArrayUtil::fromHex("0000");
+    const std::vector<int> resp = {0x9001};
+
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardSelector()).WillRepeatedly(Return(cardSelector));
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardRequest()).WillRepeatedly(Return(cardRequestSpi));
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(_)).WillRepeatedly(Return(ByteArrayUtil::fromHex("123456789000")));
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu()).WillRepeatedly(ReturnRef(requestApdu));
+    EXPECT_CALL(*apduRequestSpi.get(), getSuccessfulStatusWords()).WillRepeatedly(ReturnRef(resp));
+    EXPECT_CALL(*cardRequestSpi.get(), stopOnUnsuccessfulStatusWord()).WillRepeatedly(Return(true));
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    const auto result = localReaderAdapter.tryProcessCardSelectionRequests(
+                            std::vector<std::shared_ptr<CardSelectionRequestSpi>>(
+                                {cardSelectionRequestSpi}),
+                            MultiSelectionProcessing::FIRST_MATCH,
+                            ChannelControl::CLOSE_AFTER);
+
+    ASSERT_FALSE(result.isSuccess());
+    ASSERT_EQ(result.getFailure()->getType(), TransmitFailure::Type::UNEXPECTED_STATUS_WORD);
+    ASSERT_NE(result.getFailure()->getCardResponse(), nullptr);
+    EXPECT_THROW(result.getFailure()->raise(), UnexpectedStatusWordException);
+
+    tearDown();
+}
+
+TEST(LocalReaderAdapterTest,
+     tryTransmitCardSelectionRequests_withUnsuccessfulStatusWord_shouldReturnCardFailure)
+{
+    setUp();
+
+    const std::vector<uint8_t> requestApdu = ByteArrayUtil::fromHex("0000");
+    const std::vector<int> resp = {0x9001};
+
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardSelector()).WillRepeatedly(Return(cardSelector));
+    EXPECT_CALL(*cardSelectionRequestSpi.get(), getCardRequest()).WillRepeatedly(Return(cardRequestSpi));
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(_)).WillRepeatedly(Return(ByteArrayUtil::fromHex("123456789000")));
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu()).WillRepeatedly(ReturnRef(requestApdu));
+    EXPECT_CALL(*apduRequestSpi.get(), getSuccessfulStatusWords()).WillRepeatedly(ReturnRef(resp));
+    EXPECT_CALL(*cardRequestSpi.get(), stopOnUnsuccessfulStatusWord()).WillRepeatedly(Return(true));
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    const auto result = localReaderAdapter.tryTransmitCardSelectionRequests(
+                            std::vector<std::shared_ptr<CardSelectionRequestSpi>>(
+                                {cardSelectionRequestSpi}),
+                            MultiSelectionProcessing::FIRST_MATCH,
+                            ChannelControl::CLOSE_AFTER);
+
+    ASSERT_FALSE(result.isSuccess());
+    ASSERT_EQ(result.getFailure()->getType(), TransmitFailure::Type::CARD_BROKEN_COMMUNICATION);
+
+    const auto e = result.getFailure()->toException();
+    ASSERT_NE(std::dynamic_pointer_cast<CardBrokenCommunicationException>(e), nullptr);
+    ASSERT_NE(std::dynamic_pointer_cast<UnexpectedStatusWordException>(e->getCause()), nullptr);
+
+    tearDown();
+}
+
 TEST(LocalReaderAdapterTest,
      transmitCardSelectionRequests_whenFirstMatchAndSecondSelectionFails_shouldNotMatch)
 {
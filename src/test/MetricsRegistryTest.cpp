@@ -0,0 +1,249 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if !defined(WIN32)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Reader */
+#include "ReaderCommunicationException.h"
+
+/* Keyple Core Plugin */
+#include "ReaderIOException.h"
+
+/* Keyple Core Service */
+#include "LocalReaderAdapter.h"
+#include "MetricsRegistry.h"
+#include "MetricsSocketServer.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+/* Mock */
+#include "ReaderSpiMock.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::reader;
+using namespace keyple::core::plugin;
+using namespace keyple::core::service;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::string PLUGIN_NAME = "metricsPlugin";
+static const std::string READER_NAME = "metricsReader";
+
+static std::shared_ptr<MetricsRegistry> metrics;
+
+static void setUp()
+{
+    metrics = MetricsRegistry::getInstance();
+}
+
+static void tearDown()
+{
+    metrics.reset();
+}
+
+TEST(MetricsRegistryTest, getInstance_whenIsInvokedTwice_shouldReturnSameInstance)
+{
+    setUp();
+
+    ASSERT_EQ(MetricsRegistry::getInstance(), metrics);
+
+    tearDown();
+}
+
+TEST(MetricsRegistryTest, getCounter_whenSameNameAndLabels_shouldReturnSameCounter)
+{
+    setUp();
+
+    const auto counter1 = metrics->getCounter("test_same_total", "help", {{"a", "1"}});
+    const auto counter2 = metrics->getCounter("test_same_total", "help", {{"a", "1"}});
+    const auto counter3 = metrics->getCounter("test_same_total", "help", {{"a", "2"}});
+
+    ASSERT_EQ(counter1, counter2);
+    ASSERT_NE(counter1, counter3);
+
+    tearDown();
+}
+
+TEST(MetricsRegistryTest, getGauge_whenNameIsUsedByACounter_shouldIAE)
+{
+    setUp();
+
+    metrics->getCounter("test_type_total", "help");
+
+    EXPECT_THROW(metrics->getGauge("test_type_total", "help"), IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(MetricsRegistryTest, getCounter_whenNameIsEmpty_shouldIAE)
+{
+    setUp();
+
+    EXPECT_THROW(metrics->getCounter("", "help"), IllegalArgumentException);
+
+    tearDown();
+}
+
+TEST(MetricsRegistryTest, increment_fromSeveralThreads_shouldSumAllIncrements)
+{
+    setUp();
+
+    const auto counter = metrics->getCounter("test_threads_total", "help");
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; i++) {
+        threads.push_back(std::thread([counter]() {
+            for (int j = 0; j < 10000; j++) {
+                counter->increment();
+            }
+        }));
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(counter->getValue(), 80000u);
+
+    tearDown();
+}
+
+TEST(MetricsRegistryTest, gauge_shouldGoUpAndDown)
+{
+    setUp();
+
+    const auto gauge = metrics->getGauge("test_gauge", "help");
+    gauge->increment();
+    gauge->increment();
+    gauge->decrement();
+
+    ASSERT_EQ(gauge->getValue(), 1);
+
+    gauge->set(42);
+
+    ASSERT_EQ(gauge->getValue(), 42);
+
+    tearDown();
+}
+
+TEST(MetricsRegistryTest, renderPrometheusText_shouldRenderHelpTypeAndLabelledSamples)
+{
+    setUp();
+
+    metrics->getCounter("test_render_total", "Render \"help\"", {{"reader", "r\"1"}})
+           ->increment(3);
+    metrics->getGauge("test_render_gauge", "Gauge help")->set(-2);
+
+    const std::string text = metrics->renderPrometheusText();
+
+    ASSERT_NE(text.find("# HELP test_render_total Render \"help\"\n"), std::string::npos);
+    ASSERT_NE(text.find("# TYPE test_render_total counter\n"), std::string::npos);
+    ASSERT_NE(text.find("test_render_total{reader=\"r\\\"1\"} 3\n"), std::string::npos);
+    ASSERT_NE(text.find("# TYPE test_render_gauge gauge\n"), std::string::npos);
+    ASSERT_NE(text.find("test_render_gauge -2\n"), std::string::npos);
+
+    tearDown();
+}
+
+TEST(MetricsRegistryTest, writePrometheusTextToFile_shouldWriteTheRendering)
+{
+    setUp();
+
+    metrics->getCounter("test_file_total", "help")->increment();
+
+    const std::string path = "metrics_registry_test.prom";
+    metrics->writePrometheusTextToFile(path);
+
+    std::ifstream file(path);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    file.close();
+    std::remove(path.c_str());
+
+    ASSERT_NE(ss.str().find("test_file_total 1\n"), std::string::npos);
+
+    tearDown();
+}
+
+TEST(MetricsRegistryTest, isCardPresent_whenReaderSpiFails_shouldCountReaderIOException)
+{
+    setUp();
+
+    auto readerSpi = std::make_shared<ReaderSpiMock>(READER_NAME);
+    EXPECT_CALL(*readerSpi.get(), checkCardPresence())
+        .WillRepeatedly(Throw(ReaderIOException("Reader IO Exception")));
+
+    const auto counter = metrics->getCounter(MetricsRegistry::READER_IO_EXCEPTION,
+                                             "",
+                                             {{"plugin", PLUGIN_NAME}, {"reader", READER_NAME}});
+    const uint64_t before = counter->getValue();
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    EXPECT_THROW(localReaderAdapter.isCardPresent(), ReaderCommunicationException);
+    ASSERT_EQ(counter->getValue(), before + 1);
+
+    tearDown();
+}
+
+#if !defined(WIN32)
+TEST(MetricsSocketServerTest, start_whenClientConnects_shouldServeTheRendering)
+{
+    setUp();
+
+    metrics->getCounter("test_socket_total", "help")->increment(7);
+
+    const std::string path = "metrics_socket_server_test.sock";
+    MetricsSocketServer server(path, metrics);
+    server.start();
+
+    ASSERT_TRUE(server.isRunning());
+
+    const int client = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    ASSERT_EQ(::connect(client, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)), 0);
+
+    std::string received;
+    char buffer[256];
+    ssize_t length;
+    while ((length = ::read(client, buffer, sizeof(buffer))) > 0) {
+        received.append(buffer, static_cast<size_t>(length));
+    }
+    ::close(client);
+
+    server.stop();
+
+    ASSERT_FALSE(server.isRunning());
+    ASSERT_NE(received.find("test_socket_total 7\n"), std::string::npos);
+
+    tearDown();
+}
+#endif
@@ -26,6 +26,7 @@
 
 /* Mock */
 #include "ObservableLocalPluginSpiMock.h"
+#include "ObservableLocalPluginWaitForChangeSpiMock.h"
 #include "PluginObservationExceptionHandlerSpiMock.h"
 #include "PluginObserverSpiMock.h"
 #include "ReaderSpiMock.h"
@@ -40,6 +41,7 @@ using namespace keyple::core::util::cpp::exception;
 
 static const std::string PLUGIN_NAME = "plugin";
 static const std::string READER_NAME_1 = "reader1";
+static const std::string READER_NAME_2 = "reader2";
 
 static std::shared_ptr<ObservableLocalPluginSpiMock> observablePluginMock;
 static std::shared_ptr<ObservableLocalPluginAdapter> pluginAdapter;
@@ -242,6 +244,73 @@ TEST(ObservableLocalPluginAdapterTest,
     tearDown();
 }
 
+TEST(ObservableLocalPluginAdapterTest,
+     whileMonitoring_readerNames_replaced_shouldNotifyBoth_andUpdateReaders)
+{
+    setUp();
+
+    whileMonitoring_readerNames_appears_shouldNotify_andCreateReaders();
+
+    /* Replace reader name, the count of readers is unchanged */
+    observablePluginMock->removeReaderName({READER_NAME_1});
+    observablePluginMock->addReaderName({READER_NAME_2});
+
+    /* Wait until both events, should not take longer than 1 sec */
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    const std::shared_ptr<PluginEvent> disconnected =
+        observerMock->getLastEventOfType(PluginEvent::Type::READER_DISCONNECTED);
+    ASSERT_EQ(disconnected->getReaderNames(), std::vector<std::string>({READER_NAME_1}));
+
+    const std::shared_ptr<PluginEvent> connected =
+        observerMock->getLastEventOfType(PluginEvent::Type::READER_CONNECTED);
+    ASSERT_EQ(connected->getReaderNames(), std::vector<std::string>({READER_NAME_2}));
+
+    ASSERT_EQ(pluginAdapter->getReaderNames(), std::vector<std::string>({READER_NAME_2}));
+
+    tearDown();
+}
+
+TEST(ObservableLocalPluginAdapterTest,
+     whileMonitoring_withWaitForChangeSpi_readerNames_appears_shouldNotify_withoutPolling)
+{
+    setUp();
+
+    auto waitForChangePluginMock =
+        std::make_shared<ObservableLocalPluginWaitForChangeSpiMock>(PLUGIN_NAME);
+    pluginAdapter = std::make_shared<ObservableLocalPluginAdapter>(waitForChangePluginMock);
+
+    /* Start plugin */
+    pluginAdapter->doRegister();
+    pluginAdapter->setPluginObservationExceptionHandler(exceptionHandlerMock);
+    pluginAdapter->addObserver(observerMock);
+
+    /* Idle, the monitoring thread is waiting for a change instead of polling */
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    ASSERT_EQ(waitForChangePluginMock->getSearchCount(), 1);
+
+    /* Add reader name */
+    waitForChangePluginMock->addReaderName({READER_NAME_1});
+
+    /* Wait until READER_CONNECTED event, should be immediate */
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    const std::shared_ptr<PluginEvent> event =
+        observerMock->getLastEventOfType(PluginEvent::Type::READER_CONNECTED);
+    ASSERT_EQ(event->getReaderNames(), std::vector<std::string>({READER_NAME_1}));
+    ASSERT_EQ(pluginAdapter->getReaderNames(), std::vector<std::string>({READER_NAME_1}));
+    ASSERT_EQ(waitForChangePluginMock->getSearchCount(), 2);
+
+    /* Stop plugin, the pending wait is stopped */
+    pluginAdapter->removeObserver(observerMock);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    ASSERT_FALSE(pluginAdapter->isMonitoring());
+
+    tearDown();
+}
+
 TEST(ObservableLocalPluginAdapterTest,
      whileMonitoring_observerThrowException_isPassedTo_exceptionHandler)
 {
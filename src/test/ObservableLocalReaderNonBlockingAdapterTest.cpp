@@ -10,18 +10,28 @@
  * SPDX-License-Identifier: EPL-2.0                                                               *
  **************************************************************************************************/
 
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 /* Keyple Core Service */
 #include "ObservableLocalReaderAdapter.h"
+#include "TimerService.h"
 
 /* Keyple Core Util */
+#include "IllegalArgumentException.h"
 #include "LoggerFactory.h"
 
 /* Mock */
 #include "CardReaderObservationExceptionHandlerSpiMock.h"
 #include "ObservableReaderNonBlockingSpiMock.h"
+#include "ObservableReaderPresenceProbeSpiMock.h"
 #include "ReaderObserverSpiMock.h"
 
 /* Util */
@@ -50,6 +60,114 @@ static std::shared_ptr<ObservableLocalReaderSuite> testSuite;
  * WaitForCardRemovalNonBlockingSpi,
  * DontWaitForCardRemovalDuringProcessingSpi,
  */
+/*
+ * Observer recording the received events, blocked in its first notification until released.
+ */
+class BlockingReaderObserver final : public CardReaderObserverSpi {
+public:
+    BlockingReaderObserver() : mReleased(false) {}
+
+    void onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent) override
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mEventTypes.push_back(readerEvent->getType());
+        mCondition.notify_all();
+        mCondition.wait(lock, [this]() { return mReleased; });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mReleased = true;
+        mCondition.notify_all();
+    }
+
+    bool waitForEvents(const size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        return mCondition.wait_for(lock, std::chrono::seconds(5), [this, count]() {
+            return mEventTypes.size() >= count;
+        });
+    }
+
+    std::vector<CardReaderEvent::Type> getEventTypes()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mEventTypes;
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mReleased;
+    std::vector<CardReaderEvent::Type> mEventTypes;
+};
+
+/*
+ * Observer running an action in its notifications, then recording the received events.
+ */
+class ActingReaderObserver final : public CardReaderObserverSpi {
+public:
+    explicit ActingReaderObserver(const std::function<void()>& action) : mAction(action) {}
+
+    void onReaderEvent(const std::shared_ptr<CardReaderEvent> readerEvent) override
+    {
+        if (readerEvent->getType() == CardReaderEvent::Type::CARD_INSERTED) {
+            mAction();
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mEventTypes.push_back(readerEvent->getType());
+        mCondition.notify_all();
+    }
+
+    bool waitForEvents(const size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        return mCondition.wait_for(lock, std::chrono::seconds(5), [this, count]() {
+            return mEventTypes.size() >= count;
+        });
+    }
+
+    std::vector<CardReaderEvent::Type> getEventTypes()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        return mEventTypes;
+    }
+
+private:
+    const std::function<void()> mAction;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::vector<CardReaderEvent::Type> mEventTypes;
+};
+
+static bool waitForState(const std::shared_ptr<ObservableLocalReaderAdapter> reader,
+                         const MonitoringState monitoringState)
+{
+    for (int i = 0; i < 50; i++) {
+        if (reader->getCurrentMonitoringState() == monitoringState) {
+            return true;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    return false;
+}
+
+static bool waitForState(const MonitoringState monitoringState)
+{
+    return waitForState(_reader, monitoringState);
+}
+
 static void setUp()
 {
     readerSpi = std::make_shared<ObservableReaderNonBlockingSpiMock>(READER_NAME);
@@ -148,3 +266,280 @@ TEST(ObservableLocalReaderNonBlockingAdapterTest, removeCard_beforeFinalize_shou
 
     tearDown();
 }
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     insertCard_whenPipelined_shouldProcessNextCardWhileObserverIsBusy)
+{
+    setUp();
+
+    auto blockingObserver = std::make_shared<BlockingReaderObserver>();
+    _reader->setPipelinedCardProcessing(true);
+    _reader->setReaderObservationExceptionHandler(handler);
+    _reader->addObserver(blockingObserver);
+    _reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    /* First card, the observer is blocked in the CARD_INSERTED notification */
+    readerSpi->setCardPresent(true);
+    ASSERT_TRUE(blockingObserver->waitForEvents(1));
+
+    _reader->finalizeCardProcessing();
+    ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_CARD_REMOVAL));
+    readerSpi->setCardPresent(false);
+    ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_CARD_INSERTION));
+
+    /* Next card, processed while the observer is still busy with the previous one */
+    readerSpi->setCardPresent(true);
+    ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_CARD_PROCESSING));
+    ASSERT_EQ(blockingObserver->getEventTypes().size(), 1);
+
+    /* The pending events are then delivered in order */
+    blockingObserver->release();
+    ASSERT_TRUE(blockingObserver->waitForEvents(3));
+
+    const std::vector<CardReaderEvent::Type> eventTypes = blockingObserver->getEventTypes();
+    ASSERT_EQ(eventTypes[0], CardReaderEvent::Type::CARD_INSERTED);
+    ASSERT_EQ(eventTypes[1], CardReaderEvent::Type::CARD_REMOVED);
+    ASSERT_EQ(eventTypes[2], CardReaderEvent::Type::CARD_INSERTED);
+
+    tearDown();
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     setPipelinedCardProcessing_whenDisabledByObserver_shouldNotDeadlock)
+{
+    setUp();
+
+    auto actingObserver = std::make_shared<ActingReaderObserver>(
+        []() { _reader->setPipelinedCardProcessing(false); });
+    _reader->setPipelinedCardProcessing(true);
+    _reader->setReaderObservationExceptionHandler(handler);
+    _reader->addObserver(actingObserver);
+    _reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    readerSpi->setCardPresent(true);
+    ASSERT_TRUE(actingObserver->waitForEvents(1));
+
+    /* The next events are notified synchronously */
+    _reader->finalizeCardProcessing();
+    ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_CARD_REMOVAL));
+    readerSpi->setCardPresent(false);
+    ASSERT_TRUE(actingObserver->waitForEvents(2));
+    ASSERT_EQ(actingObserver->getEventTypes()[1], CardReaderEvent::Type::CARD_REMOVED);
+
+    tearDown();
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     doUnregister_whenCalledByObserverOfPipelinedReader_shouldNotDeadlock)
+{
+    setUp();
+
+    auto actingObserver = std::make_shared<ActingReaderObserver>(
+        []() { _reader->doUnregister(); });
+    _reader->setPipelinedCardProcessing(true);
+    _reader->setReaderObservationExceptionHandler(handler);
+    _reader->addObserver(actingObserver);
+    _reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    readerSpi->setCardPresent(true);
+
+    /* The events of the unregistration are delivered once the callback has returned */
+    ASSERT_TRUE(actingObserver->waitForEvents(3));
+
+    const std::vector<CardReaderEvent::Type> eventTypes = actingObserver->getEventTypes();
+    ASSERT_EQ(eventTypes[0], CardReaderEvent::Type::CARD_INSERTED);
+    ASSERT_EQ(eventTypes[1], CardReaderEvent::Type::CARD_REMOVED);
+    ASSERT_EQ(eventTypes[2], CardReaderEvent::Type::UNAVAILABLE);
+
+    /* The reader is released once the pending events are delivered */
+    const std::weak_ptr<ObservableLocalReaderAdapter> reader = _reader;
+    testSuite.reset();
+    _reader.reset();
+    for (int i = 0; i < 50 && !reader.expired(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    ASSERT_TRUE(reader.expired());
+
+    observer.reset();
+    handler.reset();
+    readerSpi.reset();
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     insertCard_whenProcessingIsNotFinalizedInTime_shouldAbortTheProcessing)
+{
+    setUp();
+
+    EXPECT_CALL(*handler.get(), onReaderObservationError(PLUGIN_NAME, READER_NAME, _)).Times(1);
+
+    _reader->setCardProcessingTimeout(300);
+    testSuite->addFirstObserver_should_startDetection();
+
+    /* The observer never finalizes the card processing */
+    readerSpi->setCardPresent(true);
+    ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_CARD_PROCESSING));
+    ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_CARD_REMOVAL));
+    ASSERT_FALSE(readerSpi->isPhysicalChannelOpen());
+
+    /* The card detection goes on once the card is removed */
+    readerSpi->setCardPresent(false);
+    ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_CARD_INSERTION));
+    ASSERT_TRUE(observer->hasReceived(CardReaderEvent::Type::CARD_REMOVED));
+
+    tearDown();
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     insertCard_whenProcessingIsNotFinalizedInTime_shouldAbortOutsideTheTimerThread)
+{
+    setUp();
+
+    std::thread::id timerThreadId;
+    std::thread::id abortThreadId;
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    /* The timer thread is identified by a task of its own */
+    TimerService::getInstance()->schedule(0, [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        timerThreadId = std::this_thread::get_id();
+        condition.notify_all();
+    });
+
+    EXPECT_CALL(*handler.get(), onReaderObservationError(PLUGIN_NAME, READER_NAME, _))
+        .WillOnce(InvokeWithoutArgs([&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            abortThreadId = std::this_thread::get_id();
+            condition.notify_all();
+        }));
+
+    _reader->setCardProcessingTimeout(100);
+    testSuite->addFirstObserver_should_startDetection();
+    readerSpi->setCardPresent(true);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(condition.wait_for(lock, std::chrono::seconds(5), [&]() {
+            return timerThreadId != std::thread::id() && abortThreadId != std::thread::id();
+        }));
+        ASSERT_NE(abortThreadId, timerThreadId);
+    }
+
+    ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_CARD_REMOVAL));
+
+    tearDown();
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     finalizeCardProcessing_whenRacingWithTheTimeout_shouldNotifyTheRemovalOnce)
+{
+    setUp();
+
+    const int cardCount = 10;
+    auto actingObserver = std::make_shared<ActingReaderObserver>([]() {});
+    _reader->setReaderObservationExceptionHandler(handler);
+    _reader->addObserver(actingObserver);
+    _reader->setCardProcessingTimeout(20);
+
+    for (int i = 0; i < cardCount; i++) {
+        _reader->startCardDetection(ObservableCardReader::DetectionMode::SINGLESHOT);
+        readerSpi->setCardPresent(true);
+        ASSERT_TRUE(actingObserver->waitForEvents(2 * i + 1));
+
+        /* Finalized around the expiry of the timer */
+        std::this_thread::sleep_for(std::chrono::milliseconds(18 + i % 4));
+        _reader->finalizeCardProcessing();
+        ASSERT_TRUE(actingObserver->waitForEvents(2 * i + 2));
+        ASSERT_TRUE(waitForState(MonitoringState::WAIT_FOR_START_DETECTION));
+        readerSpi->setCardPresent(false);
+    }
+
+    /* A duplicated removal would be notified by now */
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const std::vector<CardReaderEvent::Type> eventTypes = actingObserver->getEventTypes();
+    ASSERT_EQ(std::count(eventTypes.begin(), eventTypes.end(), CardReaderEvent::Type::CARD_REMOVED),
+              cardCount);
+
+    tearDown();
+}
+
+/**
+ * Inserts a card, finalizes its processing then removes it, the reader being in REPEATING mode.
+ */
+static void insertAndRemoveCard(const std::shared_ptr<ObservableLocalReaderAdapter> reader,
+                                const std::shared_ptr<ObservableReaderNonBlockingSpiMock> spi)
+{
+    reader->setReaderObservationExceptionHandler(handler);
+    reader->addObserver(observer);
+    reader->startCardDetection(ObservableCardReader::DetectionMode::REPEATING);
+
+    spi->setCardPresent(true);
+    ASSERT_TRUE(waitForState(reader, MonitoringState::WAIT_FOR_CARD_PROCESSING));
+
+    reader->finalizeCardProcessing();
+    ASSERT_TRUE(waitForState(reader, MonitoringState::WAIT_FOR_CARD_REMOVAL));
+
+    spi->setCardPresent(false);
+    ASSERT_TRUE(waitForState(reader, MonitoringState::WAIT_FOR_CARD_INSERTION));
+    ASSERT_TRUE(observer->hasReceived(CardReaderEvent::Type::CARD_REMOVED));
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest, removeCard_byDefault_shouldPingTheCard)
+{
+    setUp();
+
+    insertAndRemoveCard(_reader, readerSpi);
+
+    ASSERT_GT(readerSpi->getTransmittedApduCount(), 0);
+
+    tearDown();
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     removeCard_whenCheckCardPresenceStrategy_shouldNotPingTheCard)
+{
+    setUp();
+
+    _reader->setPresenceProbeStrategy(
+        ObservableLocalReaderAdapter::PresenceProbeStrategy::CHECK_CARD_PRESENCE);
+
+    insertAndRemoveCard(_reader, readerSpi);
+
+    ASSERT_EQ(readerSpi->getTransmittedApduCount(), 0);
+
+    tearDown();
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     setPresenceProbeStrategy_whenDriverProbeIsNotProvided_shouldIAE)
+{
+    setUp();
+
+    EXPECT_THROW(_reader->setPresenceProbeStrategy(
+                     ObservableLocalReaderAdapter::PresenceProbeStrategy::DRIVER_PROBE),
+                 IllegalArgumentException);
+    ASSERT_EQ(_reader->getPresenceProbeStrategy(),
+              ObservableLocalReaderAdapter::PresenceProbeStrategy::AUTO);
+
+    tearDown();
+}
+
+TEST(ObservableLocalReaderNonBlockingAdapterTest,
+     removeCard_whenDriverProbeIsProvided_shouldUseItByDefault)
+{
+    setUp();
+
+    auto probeSpi = std::make_shared<ObservableReaderPresenceProbeSpiMock>(READER_NAME);
+    auto reader = std::make_shared<ObservableLocalReaderAdapter>(probeSpi, PLUGIN_NAME);
+    reader->doRegister();
+
+    insertAndRemoveCard(reader, probeSpi);
+
+    ASSERT_GT(probeSpi->getProbeCount(), 0);
+    ASSERT_EQ(probeSpi->getTransmittedApduCount(), 0);
+
+    reader->doUnregister();
+
+    tearDown();
+}
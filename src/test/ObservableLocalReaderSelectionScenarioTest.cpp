@@ -19,6 +19,7 @@
 /* Keyple Core Service */
 #include "ObservableLocalReaderAdapter.h"
 #include "ScheduledCardSelectionsResponseAdapter.h"
+#include "TransmitResult.h"
 
 /* Mock */
 #include "CardReaderObservationExceptionHandlerSpiMock.h"
@@ -33,10 +34,6 @@
 #include "ObservableLocalReaderSuite.h"
 #include "ReaderAdapterTestUtils.h"
 
-/* Calypsonet Terminal Card */
-#include "CardBrokenCommunicationException.h"
-#include "ReaderBrokenCommunicationException.h"
-
 
 using namespace testing;
 
@@ -104,8 +101,10 @@ static void mockReaderWithSelectionResponses(
     const std::vector<std::shared_ptr<CardSelectionResponseApi>>& cardSelectionResponse,
     const ObservableCardReader::NotificationMode notificationMode)
 {
-    EXPECT_CALL(*readerSpy.get(), transmitCardSelectionRequests(_,_,_))
-        .WillRepeatedly(Return(cardSelectionResponse));
+    EXPECT_CALL(*readerSpy.get(), tryTransmitCardSelectionRequests(_,_,_))
+        .WillRepeatedly(Return(
+            TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>(
+                cardSelectionResponse)));
 
     const std::vector<std::shared_ptr<CardSelectionRequestSpi>> requests = {
         cardSelectionRequestSpi};
@@ -265,12 +264,14 @@ TEST(ObservableLocalReaderSelectionScenarioTest,
     setUp();
 
     EXPECT_CALL(*handler.get(), onReaderObservationError(_,_,_)).WillRepeatedly(Return());
-    EXPECT_CALL(*readerSpy.get(), transmitCardSelectionRequests(_,_,_))
-        .WillRepeatedly(Throw(ReaderBrokenCommunicationException(
-                                  nullptr, 
-                                  true, 
-                                  "",
-                                  std::make_shared<RuntimeException>())));
+    EXPECT_CALL(*readerSpy.get(), tryTransmitCardSelectionRequests(_,_,_))
+        .WillRepeatedly(Return(
+            TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>(
+                std::make_shared<const TransmitFailure>(TransmitFailure::Type::READER_BROKEN_COMMUNICATION,
+                                                        nullptr,
+                                                        true,
+                                                        "",
+                                                        std::make_shared<RuntimeException>()))));
 
     const std::vector<std::shared_ptr<CardSelectionRequestSpi>> req = {cardSelectionRequestSpi};
     auto adapter = std::make_shared<CardSelectionScenarioAdapter>(
@@ -295,12 +296,14 @@ TEST(ObservableLocalReaderSelectionScenarioTest,
     setUp();
 
     EXPECT_CALL(*handler.get(), onReaderObservationError(_,_,_)).WillRepeatedly(Return());
-    EXPECT_CALL(*readerSpy.get(), transmitCardSelectionRequests(_,_,_))
-        .WillRepeatedly(Throw(CardBrokenCommunicationException(
-                                  nullptr, 
-                                  true, 
-                                  "",
-                                  std::make_shared<RuntimeException>())));
+    EXPECT_CALL(*readerSpy.get(), tryTransmitCardSelectionRequests(_,_,_))
+        .WillRepeatedly(Return(
+            TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>(
+                std::make_shared<const TransmitFailure>(TransmitFailure::Type::CARD_BROKEN_COMMUNICATION,
+                                                        nullptr,
+                                                        true,
+                                                        "",
+                                                        std::make_shared<RuntimeException>()))));
 
     const std::vector<std::shared_ptr<CardSelectionRequestSpi>> req = {cardSelectionRequestSpi};
     auto adapter = std::make_shared<CardSelectionScenarioAdapter>(
@@ -0,0 +1,97 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+/* Keyple Core Service */
+#include "PollingPolicy.h"
+
+using namespace testing;
+
+using namespace keyple::core::service;
+using namespace keyple::core::util::cpp::exception;
+
+static const int NOON = 12 * 60;
+
+TEST(PollingPolicyTest, getCycleDuration_byDefault_shouldBeConstant)
+{
+    PollingPolicy policy;
+
+    ASSERT_EQ(policy.getCycleDuration(1, NOON), PollingPolicy::DEFAULT_CYCLE_DURATION);
+    ASSERT_EQ(policy.getCycleDuration(100, NOON), PollingPolicy::DEFAULT_CYCLE_DURATION);
+}
+
+TEST(PollingPolicyTest, getCycleDuration_whenIdle_shouldBackOffUpToTheMaximum)
+{
+    PollingPolicy policy;
+    policy.setCycleDurationBounds(50, 300);
+
+    ASSERT_EQ(policy.getCycleDuration(0, NOON), 50);
+    ASSERT_EQ(policy.getCycleDuration(1, NOON), 50);
+    ASSERT_EQ(policy.getCycleDuration(2, NOON), 100);
+    ASSERT_EQ(policy.getCycleDuration(3, NOON), 200);
+    ASSERT_EQ(policy.getCycleDuration(4, NOON), 300);
+    ASSERT_EQ(policy.getCycleDuration(1000000, NOON), 300);
+}
+
+TEST(PollingPolicyTest, setCycleDurationBounds_whenBoundsAreInvalid_shouldIAE)
+{
+    PollingPolicy policy;
+
+    EXPECT_THROW(policy.setCycleDurationBounds(0, 100), IllegalArgumentException);
+    EXPECT_THROW(policy.setCycleDurationBounds(200, 100), IllegalArgumentException);
+
+    ASSERT_EQ(policy.getMinCycleDuration(), PollingPolicy::DEFAULT_CYCLE_DURATION);
+    ASSERT_EQ(policy.getMaxCycleDuration(), PollingPolicy::DEFAULT_CYCLE_DURATION);
+}
+
+TEST(PollingPolicyTest, addTimeOfDayProfile_whenMinuteIsOutOfRange_shouldIAE)
+{
+    PollingPolicy policy;
+
+    EXPECT_THROW(policy.addTimeOfDayProfile(-1, 60, 10, 20), IllegalArgumentException);
+    EXPECT_THROW(policy.addTimeOfDayProfile(0, 24 * 60, 10, 20), IllegalArgumentException);
+    EXPECT_THROW(policy.addTimeOfDayProfile(0, 60, 20, 10), IllegalArgumentException);
+}
+
+TEST(PollingPolicyTest, getCycleDuration_withinAProfile_shouldUseItsBounds)
+{
+    PollingPolicy policy;
+    policy.setCycleDurationBounds(100, 400);
+    policy.addTimeOfDayProfile(7 * 60, 9 * 60, 20, 40);
+    policy.addTimeOfDayProfile(8 * 60, 10 * 60, 500, 1000);
+
+    ASSERT_EQ(policy.getCycleDuration(3, 7 * 60 - 1), 400);
+    ASSERT_EQ(policy.getCycleDuration(3, 7 * 60), 40);
+    ASSERT_EQ(policy.getCycleDuration(1, 8 * 60 + 30), 20);
+    ASSERT_EQ(policy.getCycleDuration(1, 9 * 60), 500);
+    ASSERT_EQ(policy.getCycleDuration(1, 10 * 60), 100);
+}
+
+TEST(PollingPolicyTest, getCycleDuration_withinAProfileSpanningMidnight_shouldUseItsBounds)
+{
+    PollingPolicy policy;
+    policy.addTimeOfDayProfile(22 * 60, 6 * 60, 1000, 5000);
+
+    ASSERT_EQ(policy.getCycleDuration(1, 23 * 60), 1000);
+    ASSERT_EQ(policy.getCycleDuration(1, 0), 1000);
+    ASSERT_EQ(policy.getCycleDuration(10, 5 * 60 + 59), 5000);
+    ASSERT_EQ(policy.getCycleDuration(1, 6 * 60), PollingPolicy::DEFAULT_CYCLE_DURATION);
+
+    policy.clearTimeOfDayProfiles();
+
+    ASSERT_EQ(policy.getCycleDuration(1, 23 * 60), PollingPolicy::DEFAULT_CYCLE_DURATION);
+}
@@ -0,0 +1,98 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Service */
+#include "ReaderCapabilities.h"
+
+/* Mock */
+#include "ConfigurableReaderSpiMock.h"
+#include "ObservableReaderAutonomousSpiMock.h"
+#include "ObservableReaderPresenceProbeSpiMock.h"
+#include "ObservableReaderSpiMock.h"
+#include "ReaderSpiMock.h"
+
+using namespace testing;
+
+using namespace keyple::core::service;
+
+static const std::string READER_NAME = "reader";
+
+TEST(ReaderCapabilitiesTest, constructor_whenBasicReader_shouldHaveNoCapability)
+{
+    auto readerSpi = std::make_shared<ReaderSpiMock>(READER_NAME);
+
+    const ReaderCapabilities capabilities(readerSpi);
+
+    ASSERT_EQ(capabilities.getMask(), 0u);
+    ASSERT_EQ(capabilities.getConfigurableReaderSpi(), nullptr);
+    ASSERT_EQ(capabilities.getAutonomousSelectionReaderSpi(), nullptr);
+    ASSERT_EQ(capabilities.getObservableReaderSpi(), nullptr);
+}
+
+TEST(ReaderCapabilitiesTest, constructor_whenConfigurableReader_shouldCacheConfigurableSpi)
+{
+    auto readerSpi = std::make_shared<ConfigurableReaderSpiMock>();
+
+    const ReaderCapabilities capabilities(readerSpi);
+
+    ASSERT_EQ(capabilities.getMask(), static_cast<uint32_t>(ReaderCapabilities::CONFIGURABLE));
+    ASSERT_EQ(capabilities.getConfigurableReaderSpi(), readerSpi);
+    ASSERT_FALSE(capabilities.has(ReaderCapabilities::OBSERVABLE));
+}
+
+TEST(ReaderCapabilitiesTest, constructor_whenBlockingObservableReader_shouldResolveMonitoringSpis)
+{
+    auto readerSpi = std::make_shared<ObservableReaderSpiMock>(READER_NAME);
+
+    const ReaderCapabilities capabilities(readerSpi);
+
+    ASSERT_EQ(capabilities.getMask(),
+              static_cast<uint32_t>(ReaderCapabilities::OBSERVABLE |
+                                    ReaderCapabilities::WAIT_FOR_CARD_INSERTION_BLOCKING |
+                                    ReaderCapabilities::WAIT_FOR_CARD_REMOVAL_BLOCKING |
+                                    ReaderCapabilities::DONT_WAIT_FOR_CARD_REMOVAL_DURING_PROCESSING));
+    ASSERT_EQ(capabilities.getObservableReaderSpi(), readerSpi);
+    ASSERT_EQ(capabilities.getWaitForCardInsertionBlockingSpi(), readerSpi);
+    ASSERT_EQ(capabilities.getWaitForCardRemovalBlockingSpi(), readerSpi);
+    ASSERT_EQ(capabilities.getWaitForCardInsertionAutonomousSpi(), nullptr);
+    ASSERT_EQ(capabilities.getWaitForCardRemovalDuringProcessingBlockingSpi(), nullptr);
+}
+
+TEST(ReaderCapabilitiesTest,
+     constructor_whenAutonomousObservableReader_shouldResolveAutonomousSpis)
+{
+    auto readerSpi = std::make_shared<ObservableReaderAutonomousSpiMock>(READER_NAME);
+
+    const ReaderCapabilities capabilities(readerSpi);
+
+    ASSERT_TRUE(capabilities.has(ReaderCapabilities::CONFIGURABLE));
+    ASSERT_TRUE(capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_INSERTION_AUTONOMOUS));
+    ASSERT_TRUE(capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_REMOVAL_AUTONOMOUS));
+    ASSERT_FALSE(capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_INSERTION_BLOCKING));
+    ASSERT_EQ(capabilities.getWaitForCardInsertionAutonomousSpi(), readerSpi);
+    ASSERT_EQ(capabilities.getWaitForCardRemovalAutonomousSpi(), readerSpi);
+}
+
+TEST(ReaderCapabilitiesTest, constructor_whenReaderProvidesPresenceProbe_shouldCacheProbeSpi)
+{
+    auto readerSpi = std::make_shared<ObservableReaderPresenceProbeSpiMock>(READER_NAME);
+
+    const ReaderCapabilities capabilities(readerSpi);
+
+    ASSERT_TRUE(capabilities.has(ReaderCapabilities::CARD_PRESENCE_PROBE));
+    ASSERT_TRUE(capabilities.has(ReaderCapabilities::WAIT_FOR_CARD_REMOVAL_NON_BLOCKING));
+    ASSERT_EQ(capabilities.getCardPresenceProbeSpi(), readerSpi);
+}
@@ -0,0 +1,183 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Service */
+#include "KeyplePluginException.h"
+#include "SmartCardServiceAdapter.h"
+
+/* Keyple Core Plugin */
+#include "PluginIOException.h"
+#include "ReaderSpi.h"
+
+/* Mock */
+#include "PluginFactoryMock.h"
+#include "PluginSpiMock.h"
+
+using namespace testing;
+
+using namespace keyple::core::plugin;
+using namespace keyple::core::plugin::spi;
+using namespace keyple::core::plugin::spi::reader;
+using namespace keyple::core::service;
+
+static const std::string STABLE_PLUGIN_NAME = "stablePlugin";
+static const std::string VOLATILE_PLUGIN_NAME = "volatilePlugin";
+static const std::string API_VERSION = "2.0";
+
+static const int LOOKUP_THREAD_COUNT = 4;
+static const int REGISTRATION_COUNT = 500;
+
+static std::shared_ptr<SmartCardServiceAdapter> service;
+static std::vector<std::shared_ptr<ReaderSpi>> emptyReaderSet;
+
+static void setUp()
+{
+    service = SmartCardServiceAdapter::getInstance();
+}
+
+static void tearDown()
+{
+    service->unregisterPlugin(STABLE_PLUGIN_NAME);
+    service->unregisterPlugin(VOLATILE_PLUGIN_NAME);
+    service.reset();
+}
+
+static std::shared_ptr<PluginFactoryMock> createPluginFactory(const std::string& pluginName)
+{
+    auto pluginSpi = std::make_shared<PluginSpiMock>();
+    EXPECT_CALL(*pluginSpi.get(), getName()).WillRepeatedly(ReturnRef(pluginName));
+    EXPECT_CALL(*pluginSpi.get(), searchAvailableReaders()).WillRepeatedly(Return(emptyReaderSet));
+    EXPECT_CALL(*pluginSpi.get(), onUnregister()).WillRepeatedly(Return());
+
+    auto pluginFactory = std::make_shared<PluginFactoryMock>();
+    EXPECT_CALL(*pluginFactory.get(), getPluginName()).WillRepeatedly(ReturnRef(pluginName));
+    EXPECT_CALL(*pluginFactory.get(), getCommonApiVersion()).WillRepeatedly(ReturnRef(API_VERSION));
+    EXPECT_CALL(*pluginFactory.get(), getPluginApiVersion()).WillRepeatedly(ReturnRef(API_VERSION));
+    EXPECT_CALL(*pluginFactory.get(), getPlugin()).WillRepeatedly(Return(pluginSpi));
+
+    return pluginFactory;
+}
+
+TEST(SmartCardServiceAdapterConcurrencyTest, getPlugin_whenPluginIsNotRegistered_shouldReturnNull)
+{
+    setUp();
+
+    ASSERT_EQ(service->getPlugin(VOLATILE_PLUGIN_NAME), nullptr);
+
+    tearDown();
+}
+
+TEST(SmartCardServiceAdapterConcurrencyTest,
+     getPluginsSnapshot_whenPluginIsRegisteredAfterwards_shouldRemainUnchanged)
+{
+    setUp();
+
+    const auto snapshot = service->getPluginsSnapshot();
+    ASSERT_EQ(snapshot->count(STABLE_PLUGIN_NAME), 0u);
+
+    service->registerPlugin(createPluginFactory(STABLE_PLUGIN_NAME));
+
+    ASSERT_EQ(snapshot->count(STABLE_PLUGIN_NAME), 0u);
+    ASSERT_EQ(service->getPluginsSnapshot()->count(STABLE_PLUGIN_NAME), 1u);
+    ASSERT_NE(service->getPlugin(STABLE_PLUGIN_NAME), nullptr);
+
+    tearDown();
+}
+
+TEST(SmartCardServiceAdapterConcurrencyTest, registerPlugin_whenRegistrationFails_shouldNotPublish)
+{
+    setUp();
+
+    auto pluginSpi = std::make_shared<PluginSpiMock>();
+    EXPECT_CALL(*pluginSpi.get(), getName()).WillRepeatedly(ReturnRef(VOLATILE_PLUGIN_NAME));
+    EXPECT_CALL(*pluginSpi.get(), searchAvailableReaders())
+        .WillRepeatedly(Throw(PluginIOException("Plugin IO Exception")));
+    EXPECT_CALL(*pluginSpi.get(), onUnregister()).WillRepeatedly(Return());
+
+    auto pluginFactory = std::make_shared<PluginFactoryMock>();
+    EXPECT_CALL(*pluginFactory.get(), getPluginName())
+        .WillRepeatedly(ReturnRef(VOLATILE_PLUGIN_NAME));
+    EXPECT_CALL(*pluginFactory.get(), getCommonApiVersion()).WillRepeatedly(ReturnRef(API_VERSION));
+    EXPECT_CALL(*pluginFactory.get(), getPluginApiVersion()).WillRepeatedly(ReturnRef(API_VERSION));
+    EXPECT_CALL(*pluginFactory.get(), getPlugin()).WillRepeatedly(Return(pluginSpi));
+
+    EXPECT_THROW(service->registerPlugin(pluginFactory), KeyplePluginException);
+
+    ASSERT_EQ(service->getPlugin(VOLATILE_PLUGIN_NAME), nullptr);
+    ASSERT_EQ(service->getPluginsSnapshot()->count(VOLATILE_PLUGIN_NAME), 0u);
+
+    tearDown();
+}
+
+TEST(SmartCardServiceAdapterConcurrencyTest,
+     lookups_whilePluginsAreRegisteredAndUnregistered_shouldAlwaysBeConsistent)
+{
+    setUp();
+
+    const auto stablePlugin = service->registerPlugin(createPluginFactory(STABLE_PLUGIN_NAME));
+    const auto volatilePluginFactory = createPluginFactory(VOLATILE_PLUGIN_NAME);
+
+    std::atomic<bool> running(true);
+    std::atomic<int> errors(0);
+    std::atomic<long> lookups(0);
+
+    std::vector<std::thread> lookupThreads;
+    for (int i = 0; i < LOOKUP_THREAD_COUNT; i++) {
+        lookupThreads.push_back(std::thread([&stablePlugin, &running, &errors, &lookups]() {
+            while (running) {
+                if (service->getPlugin(STABLE_PLUGIN_NAME) != stablePlugin) {
+                    errors++;
+                }
+
+                const size_t pluginCount = service->getPlugins().size();
+                const size_t nameCount = service->getPluginNames().size();
+                if (pluginCount < 1 || pluginCount > 2 || nameCount < 1 || nameCount > 2) {
+                    errors++;
+                }
+
+                const auto snapshot = service->getPluginsSnapshot();
+                for (const auto& pair : *snapshot) {
+                    if (pair.second == nullptr || pair.second->getName() != pair.first) {
+                        errors++;
+                    }
+                }
+
+                lookups++;
+            }
+        }));
+    }
+
+    for (int i = 0; i < REGISTRATION_COUNT; i++) {
+        service->registerPlugin(volatilePluginFactory);
+        service->unregisterPlugin(VOLATILE_PLUGIN_NAME);
+    }
+
+    running = false;
+    for (auto& lookupThread : lookupThreads) {
+        lookupThread.join();
+    }
+
+    ASSERT_EQ(errors, 0);
+    ASSERT_GT(lookups, 0);
+    ASSERT_EQ(service->getPlugin(VOLATILE_PLUGIN_NAME), nullptr);
+    ASSERT_EQ(service->getPlugin(STABLE_PLUGIN_NAME), stablePlugin);
+
+    tearDown();
+}
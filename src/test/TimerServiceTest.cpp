@@ -0,0 +1,95 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+/* Keyple Core Service */
+#include "TimerService.h"
+
+using namespace testing;
+
+using namespace keyple::core::service;
+using namespace keyple::core::util::cpp::exception;
+
+static void waitForPendingTimers()
+{
+    for (int i = 0; i < 100 && TimerService::getInstance()->getPendingTimerCount() != 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+TEST(TimerServiceTest, schedule_whenDelayIsNegative_shouldIAE)
+{
+    EXPECT_THROW(TimerService::getInstance()->schedule(-1, []() {}), IllegalArgumentException);
+}
+
+TEST(TimerServiceTest, schedule_shouldRunTheTasksInDeadlineOrder)
+{
+    std::mutex mutex;
+    std::vector<int> order;
+
+    const auto record = [&mutex, &order](const int value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(value);
+    };
+
+    TimerService::getInstance()->schedule(100, [&record]() { record(2); });
+    TimerService::getInstance()->schedule(10, [&record]() { record(1); });
+
+    waitForPendingTimers();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(order, std::vector<int>({1, 2}));
+}
+
+TEST(TimerServiceTest, cancel_whenPending_shouldNeverRunTheTask)
+{
+    std::atomic<bool> ran(false);
+
+    const uint64_t timerId = TimerService::getInstance()->schedule(50, [&ran]() { ran = true; });
+
+    ASSERT_TRUE(TimerService::getInstance()->cancel(timerId));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    ASSERT_FALSE(ran);
+    ASSERT_FALSE(TimerService::getInstance()->cancel(timerId));
+}
+
+TEST(TimerServiceTest, cancel_whenRunning_shouldWaitForTheEndOfTheTask)
+{
+    std::atomic<bool> started(false);
+    std::atomic<bool> ended(false);
+
+    const uint64_t timerId = TimerService::getInstance()->schedule(0, [&started, &ended]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        ended = true;
+    });
+
+    while (!started) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_FALSE(TimerService::getInstance()->cancel(timerId));
+    ASSERT_TRUE(ended);
+}
@@ -0,0 +1,218 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypsonet Terminal Card */
+#include "ChannelControl.h"
+
+/* Keyple Core Service */
+#include "LocalReaderAdapter.h"
+#include "TraceRecorder.h"
+
+/* Keyple Core Util */
+#include "ByteArrayUtil.h"
+
+/* Mock */
+#include "ApduRequestSpiMock.h"
+#include "CardRequestSpiMock.h"
+#include "ReaderSpiMock.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::card;
+using namespace keyple::core::service;
+using namespace keyple::core::util;
+
+static const std::string PLUGIN_NAME = "tracePlugin";
+static const std::string READER_NAME = "traceReader";
+
+static std::shared_ptr<TraceRecorder> traceRecorder;
+
+static void setUp()
+{
+    traceRecorder = TraceRecorder::getInstance();
+    traceRecorder->stop();
+    traceRecorder->clear();
+}
+
+static void tearDown()
+{
+    traceRecorder->stop();
+    traceRecorder->clear();
+    traceRecorder.reset();
+}
+
+TEST(TraceRecorderTest, span_whenNotRecording_shouldNotRecordAnything)
+{
+    setUp();
+
+    ASSERT_FALSE(TraceRecorder::isRecording());
+
+    {
+        TraceRecorder::Span span("notRecorded");
+    }
+
+    ASSERT_EQ(traceRecorder->getEventCount(), 0u);
+
+    tearDown();
+}
+
+TEST(TraceRecorderTest, span_whenRecording_shouldRecordACompleteEventWithDetail)
+{
+    setUp();
+
+    traceRecorder->start();
+
+    {
+        TraceRecorder::Span span("recorded", "reader \"1\"");
+    }
+
+    traceRecorder->stop();
+
+    {
+        TraceRecorder::Span span("afterStop");
+    }
+
+    ASSERT_EQ(traceRecorder->getEventCount(), 1u);
+
+    const std::string json = traceRecorder->renderChromeTrace();
+
+    ASSERT_NE(json.find("{\"traceEvents\":["), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"recorded\""), std::string::npos);
+    ASSERT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(json.find("\"tid\":"), std::string::npos);
+    ASSERT_NE(json.find("\"args\":{\"detail\":\"reader \\\"1\\\"\"}"), std::string::npos);
+    ASSERT_EQ(json.find("afterStop"), std::string::npos);
+
+    tearDown();
+}
+
+TEST(TraceRecorderTest, span_fromSeveralThreads_shouldRecordDistinctThreadIds)
+{
+    setUp();
+
+    traceRecorder->start();
+
+    {
+        TraceRecorder::Span span("mainThread");
+    }
+
+    std::thread thread([]() {
+        TraceRecorder::Span span("otherThread");
+    });
+    thread.join();
+
+    traceRecorder->stop();
+
+    ASSERT_EQ(traceRecorder->getEventCount(), 2u);
+
+    const std::string json = traceRecorder->renderChromeTrace();
+    const size_t mainPos = json.find("\"name\":\"mainThread\"");
+    const size_t otherPos = json.find("\"name\":\"otherThread\"");
+    ASSERT_NE(mainPos, std::string::npos);
+    ASSERT_NE(otherPos, std::string::npos);
+
+    const std::string mainTid = json.substr(json.find("\"tid\":", mainPos), 8);
+    const std::string otherTid = json.substr(json.find("\"tid\":", otherPos), 8);
+    ASSERT_NE(mainTid, otherTid);
+
+    tearDown();
+}
+
+TEST(TraceRecorderTest, span_whenBufferIsFull_shouldDropEvents)
+{
+    setUp();
+
+    traceRecorder->start();
+
+    for (size_t i = 0; i < TraceRecorder::MAX_EVENTS_PER_THREAD + 3; i++) {
+        TraceRecorder::Span span("loop");
+    }
+
+    traceRecorder->stop();
+
+    ASSERT_EQ(traceRecorder->getDroppedEventCount(), 3u);
+
+    tearDown();
+}
+
+TEST(TraceRecorderTest, writeChromeTraceToFile_shouldWriteTheRendering)
+{
+    setUp();
+
+    traceRecorder->start();
+
+    {
+        TraceRecorder::Span span("written");
+    }
+
+    traceRecorder->stop();
+
+    const std::string path = "trace_recorder_test.json";
+    traceRecorder->writeChromeTraceToFile(path);
+
+    std::ifstream file(path);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    file.close();
+    std::remove(path.c_str());
+
+    ASSERT_EQ(ss.str(), traceRecorder->renderChromeTrace());
+
+    tearDown();
+}
+
+TEST(TraceRecorderTest, transmitCardRequest_whenRecording_shouldRecordOneSpanPerApdu)
+{
+    setUp();
+
+    const std::vector<uint8_t> requestApdu = ByteArrayUtil::fromHex("0000");
+    const std::vector<int> successfulStatusWords({0x9000});
+
+    auto readerSpi = std::make_shared<ReaderSpiMock>(READER_NAME);
+    EXPECT_CALL(*readerSpi.get(), transmitApdu(_))
+        .WillRepeatedly(Return(ByteArrayUtil::fromHex("9000")));
+
+    auto apduRequestSpi = std::make_shared<ApduRequestSpiMock>();
+    EXPECT_CALL(*apduRequestSpi.get(), getApdu()).WillRepeatedly(ReturnRef(requestApdu));
+    EXPECT_CALL(*apduRequestSpi.get(), getSuccessfulStatusWords())
+        .WillRepeatedly(ReturnRef(successfulStatusWords));
+
+    std::vector<std::shared_ptr<ApduRequestSpi>> apduRequests = {apduRequestSpi, apduRequestSpi};
+    auto cardRequestSpi = std::make_shared<CardRequestSpiMock>();
+    EXPECT_CALL(*cardRequestSpi.get(), getApduRequests()).WillRepeatedly(ReturnRef(apduRequests));
+    EXPECT_CALL(*cardRequestSpi.get(), stopOnUnsuccessfulStatusWord()).WillRepeatedly(Return(false));
+
+    LocalReaderAdapter localReaderAdapter(readerSpi, PLUGIN_NAME);
+    localReaderAdapter.doRegister();
+
+    traceRecorder->start();
+    localReaderAdapter.transmitCardRequest(cardRequestSpi, ChannelControl::KEEP_OPEN);
+    traceRecorder->stop();
+
+    const std::string json = traceRecorder->renderChromeTrace();
+    const std::string span = "\"name\":\"ReaderSpi::transmitApdu\"";
+    const size_t first = json.find(span);
+
+    ASSERT_NE(first, std::string::npos);
+    ASSERT_NE(json.find(span, first + 1), std::string::npos);
+    ASSERT_NE(json.find("\"detail\":\"" + READER_NAME + "\""), std::string::npos);
+
+    tearDown();
+}
@@ -0,0 +1,95 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Service */
+#include "WorkerPool.h"
+
+using namespace testing;
+
+using namespace keyple::core::service;
+
+TEST(WorkerPoolTest, run_shouldRunTheWorkerOnTheCallingThreadAndOnThePool)
+{
+    std::mutex mutex;
+    std::set<std::thread::id> threadIds;
+    std::atomic<int> remaining(64);
+
+    const std::function<void()> worker = [&]() {
+        while (remaining-- > 0) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                threadIds.insert(std::this_thread::get_id());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    WorkerPool::getInstance()->run(worker, 2);
+
+    ASSERT_EQ(threadIds.count(std::this_thread::get_id()), 1u);
+    ASSERT_EQ(threadIds.size(), 2u);
+}
+
+TEST(WorkerPoolTest, run_whenParallelismExceedsThePool_shouldBoundTheThreads)
+{
+    std::atomic<int> running(0);
+    std::atomic<int> maxRunning(0);
+
+    const std::function<void()> worker = [&]() {
+        const int count = ++running;
+        int max = maxRunning;
+        while (count > max && !maxRunning.compare_exchange_weak(max, count)) {}
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        running--;
+    };
+
+    WorkerPool::getInstance()->run(worker, 1000);
+
+    ASSERT_LE(maxRunning, static_cast<int>(WorkerPool::getInstance()->getMaxThreadCount()) + 1);
+}
+
+TEST(WorkerPoolTest, run_whenCalledFromAWorker_shouldNotDeadlock)
+{
+    std::atomic<int> innerCalls(0);
+
+    const std::function<void()> inner = [&innerCalls]() { innerCalls++; };
+    const std::function<void()> worker = [&inner]() {
+        WorkerPool::getInstance()->run(inner, 1000);
+    };
+
+    WorkerPool::getInstance()->run(worker, 1000);
+
+    ASSERT_GE(innerCalls, 1);
+}
+
+TEST(WorkerPoolTest, run_whenReturned_shouldNeverRunTheWorkerAgain)
+{
+    std::atomic<int> calls(0);
+
+    const std::function<void()> worker = [&calls]() { calls++; };
+
+    WorkerPool::getInstance()->run(worker, 4);
+    const int callsAtReturn = calls;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    ASSERT_LE(callsAtReturn, 4);
+    ASSERT_EQ(calls, callsAtReturn);
+}
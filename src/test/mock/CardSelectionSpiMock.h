@@ -0,0 +1,35 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Calypso Terminal Card */
+#include "CardSelectionSpi.h"
+
+using namespace testing;
+
+using namespace calypsonet::terminal::card::spi;
+
+class CardSelectionSpiMock final : public CardSelectionSpi {
+public:
+    MOCK_METHOD((const std::shared_ptr<CardSelectionRequestSpi>),
+                getCardSelectionRequest,
+                (),
+                (override));
+    MOCK_METHOD((const std::shared_ptr<SmartCardSpi>),
+                parse,
+                (const std::shared_ptr<CardSelectionResponseApi> cardSelectionResponse),
+                (override));
+};
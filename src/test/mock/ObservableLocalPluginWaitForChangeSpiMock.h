@@ -0,0 +1,142 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Keyple Core Common */
+#include "KeyplePluginExtension.h"
+
+/* Keyple Core Plugin */
+#include "ObservablePluginSpi.h"
+#include "TaskCanceledException.h"
+
+/* Keyple Core Service */
+#include "WaitForReaderListChangeBlockingSpi.h"
+
+/* Mock */
+#include "ReaderSpiMock.h"
+
+using namespace testing;
+
+using namespace keyple::core::plugin;
+using namespace keyple::core::plugin::spi;
+using namespace keyple::core::service::spi;
+
+class ObservableLocalPluginWaitForChangeSpiMock final
+: public KeyplePluginExtension,
+  public ObservablePluginSpi,
+  public WaitForReaderListChangeBlockingSpi {
+public:
+    ObservableLocalPluginWaitForChangeSpiMock(const std::string& name)
+    : mName(name), mSearchCount(0), mChanged(false), mStopRequested(false) {}
+
+    virtual int getMonitoringCycleDuration() const override { return 0; }
+    virtual const std::string& getName() const override { return mName; }
+    virtual void onUnregister() override {}
+
+    virtual const std::vector<std::string> searchAvailableReaderNames() override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mSearchCount++;
+
+        std::vector<std::string> readerNames;
+        for (const auto& reader : mStubReaders) {
+            readerNames.push_back(reader.first);
+        }
+
+        return readerNames;
+    }
+
+    virtual std::shared_ptr<ReaderSpi> searchReader(const std::string& readerName) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        const auto it = mStubReaders.find(readerName);
+        if (it != mStubReaders.end()) {
+            return it->second;
+        }
+
+        return nullptr;
+    }
+
+    virtual const std::vector<std::shared_ptr<ReaderSpi>> searchAvailableReaders() override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        std::vector<std::shared_ptr<ReaderSpi>> readers;
+        for (const auto& reader : mStubReaders) {
+            readers.push_back(reader.second);
+        }
+
+        return readers;
+    }
+
+    virtual void waitForReaderListChange() override
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        mCondition.wait(lock, [this]() { return mChanged || mStopRequested; });
+
+        const bool stopped = mStopRequested;
+        mChanged = false;
+        mStopRequested = false;
+
+        if (stopped) {
+            throw TaskCanceledException("The wait has been stopped.");
+        }
+    }
+
+    virtual void stopWaitForReaderListChange() override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopRequested = true;
+        mCondition.notify_all();
+    }
+
+    void addReaderName(const std::vector<std::string>& names)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (const auto& readerName : names) {
+            auto readerSpi = std::make_shared<ReaderSpiMock>(readerName);
+            EXPECT_CALL(*readerSpi.get(), onUnregister).WillRepeatedly(Return());
+            mStubReaders.insert({readerName, readerSpi});
+        }
+
+        mChanged = true;
+        mCondition.notify_all();
+    }
+
+    int getSearchCount() const
+    {
+        return mSearchCount;
+    }
+
+private:
+    const std::string mName;
+    std::map<std::string, std::shared_ptr<ReaderSpi>> mStubReaders;
+    std::atomic<int> mSearchCount;
+    bool mChanged;
+    bool mStopRequested;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+};
@@ -28,8 +28,8 @@ public:
       std::shared_ptr<ObservableReaderSpi> observableReaderSpi, const std::string& pluginName)
     : ObservableLocalReaderAdapter(observableReaderSpi, pluginName) {}
 
-    MOCK_METHOD(const std::vector<std::shared_ptr<CardSelectionResponseApi>>, 
-                transmitCardSelectionRequests,
+    MOCK_METHOD((TransmitResult<std::vector<std::shared_ptr<CardSelectionResponseApi>>>),
+                tryTransmitCardSelectionRequests,
                 (const std::vector<std::shared_ptr<CardSelectionRequestSpi>>& cardSelectionRequests,
                  const MultiSelectionProcessing multiSelectionProcessing,
                  const ChannelControl channelControl),
@@ -47,7 +47,7 @@ using namespace keyple::core::plugin::spi::reader::observable::state::removal;
 using namespace keyple::core::util::cpp;
 using namespace keyple::core::util::cpp::exception;
 
-class ObservableReaderNonBlockingSpiMock final
+class ObservableReaderNonBlockingSpiMock
 : public KeypleReaderExtension,
   public ConfigurableReaderSpi,
   public ObservableReaderSpi,
@@ -57,7 +57,11 @@ class ObservableReaderNonBlockingSpiMock final
   public ControllableReaderSpiMock {
 public:
     ObservableReaderNonBlockingSpiMock(const std::string& name)
-    : mDetectionStarted(false), mPhysicalChannelOpen(false), mCardPresent(false), mName(name) {}
+    : mDetectionStarted(false),
+      mPhysicalChannelOpen(false),
+      mCardPresent(false),
+      mTransmittedApduCount(0),
+      mName(name) {}
 
     void onStartDetection()
     {
@@ -126,7 +130,9 @@ public:
     const std::vector<uint8_t> transmitApdu(const std::vector<uint8_t>& apduIn)
     {
         (void)apduIn;
-        
+
+        mTransmittedApduCount++;
+
         if (mCardPresent) {
             return std::vector<uint8_t>();
         } else {
@@ -146,10 +152,16 @@ public:
         mCardPresent = cardPresent;
     }
 
+    int getTransmittedApduCount() const
+    {
+        return mTransmittedApduCount;
+    }
+
 private:
     bool mDetectionStarted;
     bool mPhysicalChannelOpen;
     std::atomic<bool> mCardPresent;
+    std::atomic<int> mTransmittedApduCount;
     std::string mName;
 };
 
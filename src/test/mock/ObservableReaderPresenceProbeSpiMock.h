@@ -0,0 +1,45 @@
+/**************************************************************************************************
+ * Copyright (c) 2021 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+
+/* Keyple Core Service */
+#include "CardPresenceProbeSpi.h"
+
+/* Mock */
+#include "ObservableReaderNonBlockingSpiMock.h"
+
+using namespace keyple::core::service::spi;
+
+class ObservableReaderPresenceProbeSpiMock final
+: public ObservableReaderNonBlockingSpiMock, public CardPresenceProbeSpi {
+public:
+    ObservableReaderPresenceProbeSpiMock(const std::string& name)
+    : ObservableReaderNonBlockingSpiMock(name), mProbeCount(0) {}
+
+    Result probeCardPresence() override
+    {
+        mProbeCount++;
+
+        return checkCardPresence() ? Result::CARD_PRESENT : Result::CARD_ABSENT;
+    }
+
+    int getProbeCount() const
+    {
+        return mProbeCount;
+    }
+
+private:
+    std::atomic<int> mProbeCount;
+};
@@ -28,7 +28,7 @@ public:
 
     virtual void onPluginEvent(const std::shared_ptr<PluginEvent> pluginEvent) override final
     {
-        mEventTypeReceived.insert({pluginEvent->getType(), pluginEvent});
+        mEventTypeReceived[pluginEvent->getType()] = pluginEvent;
         if (mThrowEx) {
             throw *mThrowEx.get();
         }